@@ -23,6 +23,7 @@
 #include <QWebSocket>
 #include <QUrl>
 #include <QCryptographicHash>
+#include <limits>
 #include <traintastic/network/message.hpp>
 #include "serverlogtablemodel.hpp"
 #include "object.hpp"
@@ -373,7 +374,7 @@ void Connection::setObjectPropertyById(const ObjectProperty& property, const QSt
 {
   auto event = Message::newEvent(Message::Command::ObjectSetObjectPropertyById);
   event->write(static_cast<Object*>(property.parent())->m_handle);
-  event->write(property.name().toLatin1());
+  event->write(property.index());
   event->write(value.toLatin1());
   send(event);
 }
@@ -489,6 +490,16 @@ void Connection::setTableModelRegion(TableModel* tableModel, uint32_t columnMin,
   send(event);
 }
 
+void Connection::setTableModelView(TableModel* tableModel, int sortColumn, bool sortDescending, const QString& search)
+{
+  auto event = Message::newEvent(Message::Command::TableModelSetView);
+  event->write(tableModel->handle());
+  event->write(sortColumn >= 0 ? static_cast<uint32_t>(sortColumn) : std::numeric_limits<uint32_t>::max()); // max = unsorted
+  event->write(sortDescending);
+  event->write(search.toUtf8());
+  send(event);
+}
+
 int Connection::getTileData(Board& object)
 {
   auto request = Message::newRequest(Message::Command::BoardGetTileData);
@@ -501,6 +512,42 @@ int Connection::getTileData(Board& object)
   return request->requestId();
 }
 
+int Connection::getTimeSeries(const Object& object, const QString& name, TimeSeriesResolution resolution, qint64 from, qint64 to, std::function<void(const TimeSeries&, std::optional<const Error>)> callback)
+{
+  std::unique_ptr<Message> request{Message::newRequest(Message::Command::GetTimeSeries)};
+  request->write(object.handle());
+  request->write(name.toUtf8());
+  request->write(resolution);
+  request->write<int64_t>(from);
+  request->write<int64_t>(to);
+  send(request,
+    [callback](const std::shared_ptr<Message> message)
+    {
+      if(!message->isError())
+      {
+        TimeSeries series;
+        series.start = message->read<int64_t>();
+        series.period = message->read<int64_t>();
+        const auto count = message->read<uint32_t>();
+        series.min.reserve(count);
+        series.average.reserve(count);
+        series.max.reserve(count);
+        for(uint32_t i = 0; i < count; i++)
+        {
+          series.min.emplace_back(message->read<float>());
+          series.average.emplace_back(message->read<float>());
+          series.max.emplace_back(message->read<float>());
+        }
+        callback(series, {});
+      }
+      else
+      {
+        callback({}, *message);
+      }
+    });
+  return request->requestId();
+}
+
 int Connection::getServerDiagnosticReport(std::function<void(const QString&, const QString&, const QByteArray&)> callback)
 {
   std::unique_ptr<Message> request{Message::newRequest(Message::Command::GetDiagnosticReport)};
@@ -582,162 +629,96 @@ ObjectPtr Connection::readObject(const Message& message)
     if(m_handleCounter[handle] > 1) // object was still in memory
       return obj;
 
-    message.readBlock(); // items
-    while(!message.endOfBlock())
+    const uint32_t schemaId = message.read<uint32_t>();
+    const bool isNewSchema = message.read<bool>();
+    if(isNewSchema)
+      readObjectSchema(message, m_objectSchemas[schemaId]);
+
+    auto schema = m_objectSchemas.find(schemaId);
+    Q_ASSERT(schema != m_objectSchemas.end());
+
+    message.readBlock(); // values
+    for(auto& schemaItem : schema->second)
     {
       message.readBlock(); // item
+      const QString& name = schemaItem.name;
+      const PropertyFlags flags = schemaItem.flags;
+      const ValueType valueType = schemaItem.valueType;
       InterfaceItem* item = nullptr;
-      const QString name = QString::fromLatin1(message.read<QByteArray>());
-      const InterfaceItemType type = message.read<InterfaceItemType>();
-      switch(type)
+      switch(schemaItem.type)
       {
-        case InterfaceItemType::Property:
-        case InterfaceItemType::UnitProperty:
         case InterfaceItemType::VectorProperty:
         {
-          const PropertyFlags flags = message.read<PropertyFlags>();
-          const ValueType valueType = message.read<ValueType>();
-
-          QString enumOrSetName;
-          if(valueType == ValueType::Enum || valueType == ValueType::Set)
-            enumOrSetName = QString::fromLatin1(message.read<QByteArray>());
+          const int length = message.read<int>(); // read uint32_t as int, Qt uses int for length
 
-          if(type == InterfaceItemType::VectorProperty)
+          if(valueType == ValueType::Object)
           {
-            const int length = message.read<int>(); // read uint32_t as int, Qt uses int for length
+            item = new ObjectVectorProperty(*obj, name, flags, readObjectIdArray(message, length));
+          }
+          else
+          {
+            VectorProperty* p = new VectorProperty(*obj, name, valueType, flags, readArray(message, valueType, length));
+            assert(p->size() == length);
+            if(valueType == ValueType::Enum || valueType == ValueType::Set)
+              p->m_enumOrSetName = schemaItem.enumOrSetName;
+            item = p;
+          }
+          break;
+        }
+        case InterfaceItemType::Property:
+        case InterfaceItemType::UnitProperty:
+        {
+          QVariant value = readValue(message, valueType);
 
-            if(valueType == ValueType::Object)
+          if(Q_LIKELY(value.isValid()))
+          {
+            if(schemaItem.type == InterfaceItemType::UnitProperty)
+            {
+              qint64 unitValue = message.read<qint64>();
+              item = new UnitProperty(*obj, name, valueType, flags, value, schemaItem.unitName, unitValue);
+            }
+            else if(valueType == ValueType::Object)
             {
-              item = new ObjectVectorProperty(*obj, name, flags, readObjectIdArray(message, length));
+              item = new ObjectProperty(*obj, name, flags, value.toString());
             }
             else
             {
-              VectorProperty* p = new VectorProperty(*obj, name, valueType, flags, readArray(message, valueType, length));
-              assert(p->size() == length);
+              Property* p = new Property(*obj, name, valueType, flags, value);
               if(valueType == ValueType::Enum || valueType == ValueType::Set)
-                p->m_enumOrSetName = enumOrSetName;
+                p->m_enumOrSetName = schemaItem.enumOrSetName;
               item = p;
             }
           }
-          else
-          {
-            Q_ASSERT(type == InterfaceItemType::Property || type == InterfaceItemType::UnitProperty);
-
-            QVariant value = readValue(message, valueType);
-
-            if(Q_LIKELY(value.isValid()))
-            {
-              if(type == InterfaceItemType::UnitProperty)
-              {
-                QString unitName = QString::fromLatin1(message.read<QByteArray>());
-                qint64 unitValue = message.read<qint64>();
-                item = new UnitProperty(*obj, name, valueType, flags, value, unitName, unitValue);
-              }
-              else if(valueType == ValueType::Object)
-              {
-                item = new ObjectProperty(*obj, name, flags, value.toString());
-              }
-              else
-              {
-                Property* p = new Property(*obj, name, valueType, flags, value);
-                if(valueType == ValueType::Enum || valueType == ValueType::Set)
-                  p->m_enumOrSetName = enumOrSetName;
-                item = p;
-              }
-            }
-          }
           break;
         }
         case InterfaceItemType::Method:
-        {
-          const ValueType resultType = message.read<ValueType>();
-          const uint8_t argumentCount = message.read<uint8_t>();
-          QVector<ValueType> argumentTypes;
-          for(uint8_t i = 0; i < argumentCount; i++)
-            argumentTypes.append(message.read<ValueType>());
-          item = new Method(*obj, name, resultType, argumentTypes);
+          item = new Method(*obj, name, schemaItem.valueType, QVector<ValueType>(schemaItem.argumentTypes.begin(), schemaItem.argumentTypes.end()));
           break;
-        }
+
         case InterfaceItemType::Event:
-        {
-          const uint8_t argumentCount = message.read<uint8_t>();
-          std::vector<ValueType> argumentTypes;
-          for(uint8_t i = 0; i < argumentCount; i++)
-          {
-            const auto argumentType = message.read<ValueType>();
-            argumentTypes.emplace_back(argumentType);
-            if(argumentType == ValueType::Enum || argumentType == ValueType::Set)
-              message.read<QByteArray>(); // enum/set type, currently unused
-          }
-          item = new Event(*obj, name, std::move(argumentTypes));
+          item = new Event(*obj, name, schemaItem.argumentTypes);
           break;
-        }
       }
 
-      if(Q_LIKELY(item))
-      {
-        message.readBlock(); // attributes
-        while(!message.endOfBlock())
-        {
-          message.readBlock(); // item
-          const AttributeName attributeName = message.read<AttributeName>();
-          const ValueType valueType = message.read<ValueType>();
-
-          switch(message.read<AttributeType>())
-          {
-            case AttributeType::Value:
-            {
-              QVariant value;
-              switch(valueType)
-              {
-                case ValueType::Boolean:
-                  value = message.read<bool>();
-                  break;
-
-                case ValueType::Enum:
-                case ValueType::Integer:
-                  value = message.read<qint64>();
-                  break;
-
-                case ValueType::Float:
-                  value = message.read<double>();
-                  break;
-
-                case ValueType::String:
-                  value = QString::fromUtf8(message.read<QByteArray>());
-                  break;
-
-                case ValueType::Object:
-                case ValueType::Invalid:
-                default:
-                  Q_ASSERT(false);
-                  break;
-              }
-              if(Q_LIKELY(value.isValid()))
-                item->m_attributes[attributeName] = value;
-              break;
-            }
-            case AttributeType::Values:
-            {
-              const int length = message.read<int>(); // read uint32_t as int, Qt uses int for length
-              QList<QVariant> values = readArray(message, valueType, length);
-              if(Q_LIKELY(values.length() == length))
-                item->m_attributes[attributeName] = values;
-              break;
-            }
+      // attributes are only sent if they differ from the ones received with the schema:
+      QMap<AttributeName, QVariant> attributes;
+      if(message.read<bool>())
+        attributes = readAttributes(message);
+      else
+        attributes = schemaItem.attributes;
 
-            default:
-              Q_ASSERT(false);
-          }
-          message.readBlockEnd(); // end attribute
-        }
-        message.readBlockEnd(); // end attributes
+      if(isNewSchema)
+        schemaItem.attributes = attributes;
 
+      if(Q_LIKELY(item))
+      {
+        item->m_index = schemaItem.index;
+        item->m_attributes = std::move(attributes);
         obj->m_interfaceItems.add(*item);
       }
       message.readBlockEnd(); // end item
     }
-    message.readBlockEnd(); // end items
+    message.readBlockEnd(); // end values
 
     obj->created();
   }
@@ -749,6 +730,121 @@ ObjectPtr Connection::readObject(const Message& message)
   return obj;
 }
 
+void Connection::readObjectSchema(const Message& message, std::vector<ObjectSchemaItem>& schema)
+{
+  schema.clear();
+
+  message.readBlock(); // items
+  while(!message.endOfBlock())
+  {
+    message.readBlock(); // item
+    ObjectSchemaItem& item = schema.emplace_back();
+    item.name = QString::fromLatin1(message.read<QByteArray>());
+    item.index = message.read<quint16>();
+    item.type = message.read<InterfaceItemType>();
+    switch(item.type)
+    {
+      case InterfaceItemType::Property:
+      case InterfaceItemType::UnitProperty:
+      case InterfaceItemType::VectorProperty:
+        item.flags = message.read<PropertyFlags>();
+        item.valueType = message.read<ValueType>();
+        if(item.valueType == ValueType::Enum || item.valueType == ValueType::Set)
+          item.enumOrSetName = QString::fromLatin1(message.read<QByteArray>());
+        if(item.type == InterfaceItemType::UnitProperty)
+          item.unitName = QString::fromLatin1(message.read<QByteArray>());
+        break;
+
+      case InterfaceItemType::Method:
+      {
+        item.valueType = message.read<ValueType>(); // result type
+        const uint8_t argumentCount = message.read<uint8_t>();
+        for(uint8_t i = 0; i < argumentCount; i++)
+          item.argumentTypes.emplace_back(message.read<ValueType>());
+        break;
+      }
+      case InterfaceItemType::Event:
+      {
+        const uint8_t argumentCount = message.read<uint8_t>();
+        for(uint8_t i = 0; i < argumentCount; i++)
+        {
+          const auto argumentType = message.read<ValueType>();
+          item.argumentTypes.emplace_back(argumentType);
+          if(argumentType == ValueType::Enum || argumentType == ValueType::Set)
+            message.read<QByteArray>(); // enum/set type, currently unused
+        }
+        break;
+      }
+    }
+    message.readBlockEnd(); // end item
+  }
+  message.readBlockEnd(); // end items
+}
+
+QMap<AttributeName, QVariant> Connection::readAttributes(const Message& message)
+{
+  QMap<AttributeName, QVariant> attributes;
+
+  message.readBlock(); // attributes
+  while(!message.endOfBlock())
+  {
+    message.readBlock(); // attribute
+    const AttributeName attributeName = message.read<AttributeName>();
+    const ValueType valueType = message.read<ValueType>();
+
+    switch(message.read<AttributeType>())
+    {
+      case AttributeType::Value:
+      {
+        QVariant value;
+        switch(valueType)
+        {
+          case ValueType::Boolean:
+            value = message.read<bool>();
+            break;
+
+          case ValueType::Enum:
+          case ValueType::Integer:
+            value = message.read<qint64>();
+            break;
+
+          case ValueType::Float:
+            value = message.read<double>();
+            break;
+
+          case ValueType::String:
+            value = QString::fromUtf8(message.read<QByteArray>());
+            break;
+
+          case ValueType::Object:
+          case ValueType::Invalid:
+          default:
+            Q_ASSERT(false);
+            break;
+        }
+        if(Q_LIKELY(value.isValid()))
+          attributes[attributeName] = value;
+        break;
+      }
+      case AttributeType::Values:
+      {
+        const int length = message.read<int>(); // read uint32_t as int, Qt uses int for length
+        QList<QVariant> values = readArray(message, valueType, length);
+        if(Q_LIKELY(values.length() == length))
+          attributes[attributeName] = values;
+        break;
+      }
+
+      default:
+        Q_ASSERT(false);
+    }
+    message.readBlockEnd(); // end attribute
+  }
+  message.readBlockEnd(); // end attributes
+
+  return attributes;
+}
+
 TableModelPtr Connection::readTableModel(const Message& message)
 {
   message.readBlock(); // model
@@ -760,6 +856,7 @@ TableModelPtr Connection::readTableModel(const Message& message)
     tableModel->m_columnHeaders.push_back(Locale::tr(QString::fromLatin1(message.read<QByteArray>())));
   Q_ASSERT(tableModel->m_columnHeaders.size() == columnCount);
   message.read(tableModel->m_rowCount);
+  message.read(tableModel->m_viewSupported);
   message.readBlockEnd(); // end model
   return tableModel;
 }
@@ -801,6 +898,100 @@ void Connection::setState(State state)
   }
 }
 
+void Connection::processPropertyChanged(const Message& message)
+{
+  if(ObjectPtr object = m_objects.value(message.read<Handle>()).lock())
+  {
+    InterfaceItem* item = object->interfaceItems().get(message.read<quint16>());
+    const ValueType valueType = message.read<ValueType>();
+
+    if(auto* property = dynamic_cast<AbstractProperty*>(item))
+    {
+      switch(valueType)
+      {
+        case ValueType::Boolean:
+        {
+          const bool value = message.read<bool>();
+          static_cast<Property*>(property)->m_value = value;
+          emit property->valueChanged();
+          emit property->valueChangedBool(value);
+          break;
+        }
+        case ValueType::Integer:
+        case ValueType::Enum:
+        case ValueType::Set:
+        {
+          const qlonglong value = message.read<qlonglong>();
+          static_cast<Property*>(property)->m_value = value;
+          if(valueType == ValueType::Integer)
+          {
+            if(UnitProperty* unitProperty = dynamic_cast<UnitProperty*>(property))
+            {
+              const auto unit = message.read<qint64>();
+              if(unitProperty->m_unitValue != unit)
+              {
+                unitProperty->m_unitValue = unit;
+                emit unitProperty->unitChanged();
+              }
+            }
+          }
+          emit property->valueChanged();
+          emit property->valueChangedInt64(value);
+          if(value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max())
+            emit property->valueChangedInt(static_cast<int>(value));
+          break;
+        }
+        case ValueType::Float:
+        {
+          const double value = message.read<double>();
+          static_cast<Property*>(property)->m_value = value;
+          if(UnitProperty* unitProperty = dynamic_cast<UnitProperty*>(property))
+          {
+            const auto unit = message.read<qint64>();
+            if(unitProperty->m_unitValue != unit)
+            {
+              unitProperty->m_unitValue = unit;
+              emit unitProperty->unitChanged();
+            }
+          }
+          emit property->valueChanged();
+          emit property->valueChangedDouble(value);
+          break;
+        }
+        case ValueType::String:
+        {
+          const QString value = QString::fromUtf8(message.read<QByteArray>());
+          static_cast<Property*>(property)->m_value = value;
+          emit property->valueChanged();
+          emit property->valueChangedString(value);
+          break;
+        }
+        case ValueType::Object:
+        {
+          const QString id = QString::fromLatin1(message.read<QByteArray>());
+          static_cast<ObjectProperty*>(property)->m_id = id;
+          emit property->valueChanged();
+          break;
+        }
+        case ValueType::Invalid:
+          Q_ASSERT(false);
+          break;
+      }
+    }
+    else if(auto* vectorProperty = dynamic_cast<AbstractVectorProperty*>(item))
+    {
+      const int length = message.read<int>(); // read uint32_t as int, Qt uses int for length
+
+      if(valueType == ValueType::Object)
+        static_cast<ObjectVectorProperty*>(vectorProperty)->m_ids = readObjectIdArray(message, length);
+      else
+        static_cast<VectorProperty*>(vectorProperty)->m_values = readArray(message, valueType, length);
+
+      emit vectorProperty->valueChanged();
+    }
+  }
+}
+
 void Connection::processMessage(const std::shared_ptr<Message> message)
 {
   if(message->isResponse())
@@ -829,102 +1020,24 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
         break;
       }
       case Message::Command::ObjectPropertyChanged:
-        if(ObjectPtr object = m_objects.value(message->read<Handle>()).lock())
-        {
-          const QString name = QString::fromLatin1(message->read<QByteArray>());
-          const ValueType valueType = message->read<ValueType>();
-
-          if(AbstractProperty* property = object->getProperty(name))
-          {
-            switch(valueType)
-            {
-              case ValueType::Boolean:
-              {
-                const bool value = message->read<bool>();
-                static_cast<Property*>(property)->m_value = value;
-                emit property->valueChanged();
-                emit property->valueChangedBool(value);
-                break;
-              }
-              case ValueType::Integer:
-              case ValueType::Enum:
-              case ValueType::Set:
-              {
-                const qlonglong value = message->read<qlonglong>();
-                static_cast<Property*>(property)->m_value = value;
-                if(valueType == ValueType::Integer)
-                {
-                  if(UnitProperty* unitProperty = dynamic_cast<UnitProperty*>(property))
-                  {
-                    const auto unit = message->read<qint64>();
-                    if(unitProperty->m_unitValue != unit)
-                    {
-                      unitProperty->m_unitValue = unit;
-                      emit unitProperty->unitChanged();
-                    }
-                  }
-                }
-                emit property->valueChanged();
-                emit property->valueChangedInt64(value);
-                if(value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max())
-                  emit property->valueChangedInt(static_cast<int>(value));
-                break;
-              }
-              case ValueType::Float:
-              {
-                const double value = message->read<double>();
-                static_cast<Property*>(property)->m_value = value;
-                if(UnitProperty* unitProperty = dynamic_cast<UnitProperty*>(property))
-                {
-                  const auto unit = message->read<qint64>();
-                  if(unitProperty->m_unitValue != unit)
-                  {
-                    unitProperty->m_unitValue = unit;
-                    emit unitProperty->unitChanged();
-                  }
-                }
-                emit property->valueChanged();
-                emit property->valueChangedDouble(value);
-                break;
-              }
-              case ValueType::String:
-              {
-                const QString value = QString::fromUtf8(message->read<QByteArray>());
-                static_cast<Property*>(property)->m_value = value;
-                emit property->valueChanged();
-                emit property->valueChangedString(value);
-                break;
-              }
-              case ValueType::Object:
-              {
-                const QString id = QString::fromLatin1(message->read<QByteArray>());
-                static_cast<ObjectProperty*>(property)->m_id = id;
-                emit property->valueChanged();
-                break;
-              }
-              case ValueType::Invalid:
-                Q_ASSERT(false);
-                break;
-            }
-          }
-          else if(AbstractVectorProperty* vectorProperty = object->getVectorProperty(name))
-          {
-            const int length = message->read<int>(); // read uint32_t as int, Qt uses int for length
-
-            if(valueType == ValueType::Object)
-              static_cast<ObjectVectorProperty*>(vectorProperty)->m_ids = readObjectIdArray(*message, length);
-            else
-              static_cast<VectorProperty*>(vectorProperty)->m_values = readArray(*message, valueType, length);
+        processPropertyChanged(*message);
+        break;
 
-            emit vectorProperty->valueChanged();
-          }
+      case Message::Command::ObjectPropertiesChanged:
+      {
+        const uint32_t count = message->read<uint32_t>();
+        for(uint32_t i = 0; i < count; i++)
+        {
+          message->readBlock(); // property
+          processPropertyChanged(*message);
+          message->readBlockEnd(); // end property
         }
         break;
-
+      }
       case Message::Command::ObjectAttributeChanged:
         if(ObjectPtr object = m_objects.value(message->read<Handle>()).lock())
         {
-          if(InterfaceItem* item = object->getInterfaceItem(QString::fromLatin1(message->read<QByteArray>())))
+          if(InterfaceItem* item = object->interfaceItems().get(message->read<quint16>()))
           {
             AttributeName attributeName = message->read<AttributeName>();
             const ValueType type = message->read<ValueType>();
@@ -1046,23 +1159,56 @@ void Connection::processMessage(const std::shared_ptr<Message> message)
       case Message::Command::TableModelUpdateRegion:
         if(TableModel* model = m_tableModels.value(message->read<Handle>(), nullptr))
         {
-          const uint32_t columnMin = message->read<uint32_t>();
-          const uint32_t columnMax = message->read<uint32_t>();
-          const uint32_t rowMin = message->read<uint32_t>();
-          const uint32_t rowMax = message->read<uint32_t>();
-
-          model->beginResetModel();
+          // only changed cells are sent:
+          const uint32_t count = message->read<uint32_t>();
+          uint32_t columnMin = std::numeric_limits<uint32_t>::max();
+          uint32_t columnMax = 0;
+          uint32_t rowMin = std::numeric_limits<uint32_t>::max();
+          uint32_t rowMax = 0;
 
           TableModel::ColumnRow index;
-          QByteArray data;
-          for(index.second = rowMin; index.second <= rowMax; index.second++)
-            for(index.first = columnMin; index.first <= columnMax; index.first++)
+          for(uint32_t i = 0; i < count; i++)
+          {
+            index.first = message->read<uint32_t>();
+            index.second = message->read<uint32_t>();
+
+            QVariant value;
+            switch(message->read<ValueType>())
             {
-              message->read(data);
-              model->m_texts[index] = Locale::instance->parse(QString::fromUtf8(data));
+              case ValueType::Boolean:
+                value = message->read<bool>();
+                break;
+
+              case ValueType::Integer:
+                value = message->read<qint64>();
+                break;
+
+              case ValueType::Float:
+                value = message->read<double>();
+                break;
+
+              case ValueType::String:
+                value = Locale::instance->parse(QString::fromUtf8(message->read<QByteArray>()));
+                break;
+
+              default:
+                Q_ASSERT(false);
+                break;
             }
+            model->m_values[index] = value;
 
-          model->endResetModel();
+            columnMin = std::min(columnMin, index.first);
+            columnMax = std::max(columnMax, index.first);
+            rowMin = std::min(rowMin, index.second);
+            rowMax = std::max(rowMax, index.second);
+          }
+
+          if(count != 0 && rowMin < static_cast<uint32_t>(model->rowCount()) && columnMin < static_cast<uint32_t>(model->columnCount()))
+          {
+            rowMax = std::min(rowMax, static_cast<uint32_t>(model->rowCount() - 1));
+            columnMax = std::min(columnMax, static_cast<uint32_t>(model->columnCount() - 1));
+            emit model->dataChanged(model->index(rowMin, columnMin), model->index(rowMax, columnMax));
+          }
         }
         break;
 
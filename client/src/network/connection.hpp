@@ -29,8 +29,14 @@
 #include <QAbstractSocket>
 #include <QHostAddress>
 #include <QMap>
+#include <QVariant>
 #include <QUuid>
 #include <traintastic/network/message.hpp>
+#include <traintastic/enum/attributename.hpp>
+#include <traintastic/enum/interfaceitemtype.hpp>
+#include <traintastic/enum/propertyflags.hpp>
+#include <traintastic/enum/timeseriesresolution.hpp>
+#include <traintastic/enum/valuetype.hpp>
 #include "handle.hpp"
 #include "objectptr.hpp"
 #include "tablemodelptr.hpp"
@@ -72,6 +78,16 @@ class Connection : public QObject, public std::enable_shared_from_this<Connectio
 
     using SocketError = QAbstractSocket::SocketError;
 
+    //! \brief Time series buckets, values are NaN for buckets without data
+    struct TimeSeries
+    {
+      qint64 start = 0; //!< Start of the first bucket, seconds since epoch
+      qint64 period = 0; //!< Bucket length in seconds
+      std::vector<float> min;
+      std::vector<float> average;
+      std::vector<float> max;
+    };
+
   protected:
     QWebSocket* m_socket;
     State m_state;
@@ -95,10 +111,29 @@ class Connection : public QObject, public std::enable_shared_from_this<Connectio
     std::unordered_map<Handle, std::unique_ptr<Object>> m_requestForRelease;
     QMap<Handle, TableModel*> m_tableModels;
 
+    //! \brief Interface item description, received once per session per schema
+    struct ObjectSchemaItem
+    {
+      QString name;
+      quint16 index = 0;
+      InterfaceItemType type{};
+      PropertyFlags flags{};
+      ValueType valueType = ValueType::Invalid; //!< value type for properties, result type for methods
+      QString enumOrSetName;
+      QString unitName;
+      std::vector<ValueType> argumentTypes;
+      QMap<AttributeName, QVariant> attributes; //!< attributes of the first object using the schema
+    };
+
+    std::unordered_map<uint32_t, std::vector<ObjectSchemaItem>> m_objectSchemas;
+
     void setState(State state);
     void processMessage(const std::shared_ptr<Message> message);
+    void processPropertyChanged(const Message& message);
 
     ObjectPtr readObject(const Message &message);
+    static void readObjectSchema(const Message& message, std::vector<ObjectSchemaItem>& schema);
+    static QMap<AttributeName, QVariant> readAttributes(const Message& message);
     TableModelPtr readTableModel(const Message& message);
 
     void getWorld();
@@ -159,9 +194,12 @@ class Connection : public QObject, public std::enable_shared_from_this<Connectio
     [[nodiscard]] int getTableModel(const ObjectPtr& object, std::function<void(const TableModelPtr&, std::optional<const Error>)> callback);
     void releaseTableModel(TableModel* tableModel);
     void setTableModelRegion(TableModel* tableModel, uint32_t columnMin, uint32_t columnMax, uint32_t rowMin, uint32_t rowMax);
+    void setTableModelView(TableModel* tableModel, int sortColumn, bool sortDescending, const QString& search);
 
     [[nodiscard]] int getTileData(Board& object);
 
+    [[nodiscard]] int getTimeSeries(const Object& object, const QString& name, TimeSeriesResolution resolution, qint64 from, qint64 to, std::function<void(const TimeSeries&, std::optional<const Error>)> callback);
+
     int getServerDiagnosticReport(std::function<void(const QString&, const QString&, const QByteArray&)> callback);
 
   signals:
@@ -38,6 +38,7 @@ class InterfaceItem : public QObject
 
   protected:
     const QString m_name;
+    quint16 m_index = 0;
     QMap<AttributeName, QVariant> m_attributes;
 
   public:
@@ -46,6 +47,8 @@ class InterfaceItem : public QObject
     const Object& object() const;
     Object& object();
     const QString& name() const { return m_name; }
+    //! \brief Index of the item on the wire, assigned by the server.
+    quint16 index() const { return m_index; }
     QString displayName() const;
     QString helpText() const;
 
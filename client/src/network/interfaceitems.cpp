@@ -71,4 +71,7 @@ void InterfaceItems::add(InterfaceItem& item)
 {
   m_items.insert(item.name(), &item);
   m_itemOrder.append(item.name());
+  if(item.index() >= m_itemByIndex.size())
+    m_itemByIndex.resize(item.index() + 1, nullptr);
+  m_itemByIndex[item.index()] = &item;
 }
@@ -25,6 +25,7 @@
 
 #include <QMap>
 #include <QStringList>
+#include <vector>
 
 class InterfaceItem;
 
@@ -33,6 +34,7 @@ class InterfaceItems
   protected:
     QMap<QString, InterfaceItem*> m_items;
     QStringList m_itemOrder;
+    std::vector<InterfaceItem*> m_itemByIndex;
 
   public:
     const QStringList& names() const { return m_itemOrder; }
@@ -43,6 +45,7 @@ class InterfaceItems
     std::vector<InterfaceItem*> items(const QString& category) const;
 
     inline InterfaceItem* find(const QString& name) const { return m_items.value(name, nullptr); }
+    inline InterfaceItem* get(quint16 index) const { return index < m_itemByIndex.size() ? m_itemByIndex[index] : nullptr; }
 
     void add(InterfaceItem& item);
 };
@@ -181,7 +181,7 @@ void Object::processMessage(const Message& message)
   {
     case Message::Command::ObjectEventFired:
     {
-      if(Event* event = getEvent(QString::fromLatin1(message.read<QByteArray>())))
+      if(Event* event = dynamic_cast<Event*>(m_interfaceItems.get(message.read<quint16>())))
       {
         const auto& argumentTypes = event->argumentTypes();
         const auto argumentCount = message.read<uint32_t>();
@@ -53,7 +53,9 @@ QVariant TableModel::headerData(int section, Qt::Orientation orientation, int ro
 QVariant TableModel::data(const QModelIndex& index, int role) const
 {
   if(role == Qt::DisplayRole)
-    return m_texts.value(ColumnRow(index.column(), index.row()));
+    return m_values.value(ColumnRow(index.column(), index.row())).toString();
+  if(role == Qt::EditRole)
+    return m_values.value(ColumnRow(index.column(), index.row()));
 
   return QVariant{};
 }
@@ -62,14 +64,14 @@ QString TableModel::getRowObjectId(int row) const
 {
   // TODO: rename to get row id and get it from the server
   if(m_classId == "world_list_table_model")
-    return m_texts.value(ColumnRow(1, row));
+    return m_values.value(ColumnRow(1, row)).toString();
   else
-    return m_texts.value(ColumnRow(0, row));
+    return m_values.value(ColumnRow(0, row)).toString();
 }
 
 QString TableModel::getValue(int column, int row) const
 {
-  return m_texts.value(ColumnRow(column, row));
+  return m_values.value(ColumnRow(column, row)).toString();
 }
 
 void TableModel::setRegionAll(bool enable)
@@ -97,6 +99,35 @@ void TableModel::setRegion(uint32_t columnMin, uint32_t columnMax, uint32_t rowM
   }
 }
 
+void TableModel::sort(int column, Qt::SortOrder order)
+{
+  if(m_viewSupported && (m_sortColumn != column || m_sortOrder != order))
+  {
+    m_sortColumn = column;
+    m_sortOrder = order;
+    updateView();
+  }
+}
+
+void TableModel::setSearch(const QString& text)
+{
+  if(m_viewSupported && m_search != text)
+  {
+    m_search = text;
+    updateView();
+  }
+}
+
+void TableModel::updateView()
+{
+  // rows are reordered by the server, it resends the values of the region:
+  beginResetModel();
+  m_values.clear();
+  endResetModel();
+
+  m_connection->setTableModelView(this, m_sortColumn, m_sortOrder == Qt::DescendingOrder, m_search);
+}
+
 void TableModel::setColumnHeaders(const QVector<QString>& values)
 {
   if(m_columnHeaders != values)
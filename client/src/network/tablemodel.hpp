@@ -52,12 +52,17 @@ class TableModel final : public QAbstractTableModel
       uint32_t columnMax = 0;
     } m_region;
     bool m_regionAll = false;
-    QMap<ColumnRow, QString> m_texts;
+    QMap<ColumnRow, QVariant> m_values;
+    bool m_viewSupported = false;
+    int m_sortColumn = -1;
+    Qt::SortOrder m_sortOrder = Qt::AscendingOrder;
+    QString m_search;
 
     void setColumnHeaders(const QVector<QString>& values);
     void setRowCount(int value);
 
     void updateRegionAll();
+    void updateView();
 
   public:
     explicit TableModel(std::shared_ptr<Connection> connection, Handle handle, const QString& classId, QObject* parent = nullptr);
@@ -77,6 +82,11 @@ class TableModel final : public QAbstractTableModel
 
     void setRegionAll(bool enable);
     void setRegion(uint32_t columnMin, uint32_t columnMax, uint32_t rowMin, uint32_t rowMax);
+
+    //! \brief If the server can sort and search the rows, see sort() and setSearch().
+    bool isViewSupported() const { return m_viewSupported; }
+    void sort(int column, Qt::SortOrder order = Qt::AscendingOrder) final;
+    void setSearch(const QString& text);
 };
 
 #endif
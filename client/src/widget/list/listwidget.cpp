@@ -22,12 +22,16 @@
 
 #include "listwidget.hpp"
 #include <QVBoxLayout>
+#include <QHeaderView>
+#include <QLineEdit>
+#include <traintastic/locale/locale.hpp>
 #include <QtWaitingSpinner/waitingspinnerwidget.h>
 #include "../alertwidget.hpp"
 #include "../tablewidget.hpp"
 #include "../../network/connection.hpp"
 #include "../../network/object.hpp"
 #include "../../network/error.hpp"
+#include "../../network/tablemodel.hpp"
 #include "../../theme/theme.hpp"
 
 ListWidget::ListWidget(const ObjectPtr& object, QWidget* parent)
@@ -75,6 +79,20 @@ ListWidget::~ListWidget()
 void ListWidget::setTableModel(const TableModelPtr& tableModel)
 {
   m_tableWidget->setTableModel(tableModel);
+
+  // sort and search are done by the server, lists that can be reordered are always shown in list order:
+  if(tableModel->isViewSupported() && !m_object->getMethod("move"))
+  {
+    m_tableWidget->horizontalHeader()->setSortIndicator(-1, Qt::AscendingOrder);
+    m_tableWidget->setSortingEnabled(true);
+
+    auto* search = new QLineEdit(this);
+    search->setPlaceholderText(Locale::tr("qtapp.list:search"));
+    search->setClearButtonEnabled(true);
+    connect(search, &QLineEdit::textChanged, tableModel.get(), &TableModel::setSearch);
+    auto* layout = static_cast<QVBoxLayout*>(this->layout());
+    layout->insertWidget(layout->indexOf(m_tableWidget), search);
+  }
   connect(m_tableWidget, &TableWidget::doubleClicked, this,
     [this](const QModelIndex& index)
     {
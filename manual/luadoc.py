@@ -185,6 +185,11 @@ class LuaDoc:
         # lua libs:
         globals += re.findall(r'addLib\(\s*L\s*,\s*LUA_[A-Z]+\s*,\s*luaopen_([a-z]+)\s*,', sandbox_cpp)
 
+        # extensions:
+        for args in re.findall(r'addExtensions\(\s*L\s*,\s*{(.+?)}\);', sandbox_cpp, flags=re.DOTALL):
+            for name in re.findall(r'{\s*"([a-z0-9_]+)"\s*,', args):
+                globals.append(name)
+
         # setfield:
         for name in re.findall(r'lua_setfield\(\s*L\s*,\s*-2\s*,\s*"([A-Za-z][A-Za-z_]*)"\s*\);', sandbox_cpp):
             globals.append(name)
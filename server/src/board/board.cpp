@@ -24,8 +24,10 @@
 #include "boardlist.hpp"
 #include "boardlisttablemodel.hpp"
 #include "map/link.hpp"
+#include "map/node.hpp"
 #include "tile/tiles.hpp"
 #include "tile/hidden/hiddencrossoverrailtile.hpp"
+#include "tile/rail/linkrailtile.hpp"
 #include "../core/method.tpp"
 #include "../core/objectproperty.tpp"
 #include "../world/world.hpp"
@@ -36,6 +38,73 @@
 
 #include "../log/log.hpp"
 
+namespace {
+
+constexpr size_t blocksAheadMax = 2; //!< Signal paths look up to two blocks ahead.
+
+//! Collect the tiles which depend on the network near the given node tiles,
+//! block and signal paths can pass other blocks so the search continues beyond them.
+void collectAffectedTiles(const std::vector<std::shared_ptr<Tile>>& nodeTiles, std::vector<std::shared_ptr<Tile>>& tiles, std::unordered_map<const Node*, size_t>& visited)
+{
+  struct Item
+  {
+    Node* node;
+    size_t blocks; //!< number of blocks passed
+    bool start;
+  };
+
+  std::vector<Item> todo;
+  todo.reserve(nodeTiles.size());
+  for(const auto& tile : nodeTiles)
+  {
+    todo.emplace_back(Item{&tile->node()->get(), 0, true});
+  }
+
+  while(!todo.empty())
+  {
+    const Item item = todo.back();
+    todo.pop_back();
+
+    if(auto it = visited.find(item.node); it != visited.end())
+    {
+      if(it->second <= item.blocks)
+        continue;
+      it->second = item.blocks;
+    }
+    else
+    {
+      visited.emplace(item.node, item.blocks);
+      tiles.emplace_back(item.node->tile().shared_ptr<Tile>());
+    }
+
+    Tile& tile = item.node->tile();
+    size_t blocks = item.blocks;
+    if(tile.tileId == TileId::RailBlock && !item.start)
+    {
+      if(++blocks >= blocksAheadMax)
+        continue;
+    }
+
+    for(const auto& link : item.node->links())
+    {
+      if(link)
+      {
+        todo.emplace_back(Item{&link->getNext(*item.node), blocks, false});
+      }
+    }
+
+    if(tile.tileId == TileId::RailLink) // continue on the linked board
+    {
+      if(const auto& linked = static_cast<LinkRailTile&>(tile).link.value(); linked && linked->node())
+      {
+        todo.emplace_back(Item{&linked->node()->get(), blocks, false});
+      }
+    }
+  }
+}
+
+}
+
 CREATE_IMPL(Board)
 
 Board::Board(World& world, std::string_view _id) :
@@ -112,7 +181,7 @@ Board::Board(World& world, std::string_view _id) :
 
       tileDataChanged(*this, tile->location(), tile->data());
       updateSize();
-      m_modified = true;
+      setModified(*tile);
       return true;
     }},
   moveTile{*this, "move_tile",
@@ -164,6 +233,7 @@ Board::Board(World& world, std::string_view _id) :
           }
 
       // remove tile at tile origin
+      setModified(*tile);
       removeTile(tile->location().x, tile->location().y);
 
       // set new params
@@ -184,7 +254,7 @@ Board::Board(World& world, std::string_view _id) :
       tileDataChanged(*this, tile->location(), tile->data());
 
       updateSize();
-      m_modified = true;
+      setModified(*tile);
       return true;
     }},
   resizeTile{*this, "resize_tile",
@@ -226,10 +296,13 @@ Board::Board(World& world, std::string_view _id) :
 
         for(int16_t xx = x; xx < x2; xx++)
           for(int16_t yy = y; yy < y2; yy++)
+          {
             if(xx < xNew && yy < yNew)
               m_tiles[{xx, yy}] = tile;
             else
               m_tiles.erase({xx, yy});
+            m_modifiedLocations.emplace(TileLocation{xx, yy});
+          }
       }
 
       tileDataChanged(*this, tile->location(), tile->data());
@@ -242,10 +315,10 @@ Board::Board(World& world, std::string_view _id) :
       auto tile = getTile({x, y});
       if(tile)
       {
+        setModified(*tile);
         removeTile(x, y);
         tile->destroy();
         updateSize();
-        m_modified = true;
       }
       return true;
     }},
@@ -367,140 +440,251 @@ void Board::loaded()
 {
   IdObject::loaded();
 
+  m_modifiedLocations.clear(); // rebuild all
   m_modified = true;
   modified();
 }
 
+void Board::setModified(const Tile& tile)
+{
+  const auto l = tile.location();
+  const int16_t x2 = l.x + tile.width;
+  const int16_t y2 = l.y + tile.height;
+  for(int16_t x = l.x; x < x2; x++)
+    for(int16_t y = l.y; y < y2; y++)
+      m_modifiedLocations.emplace(TileLocation{x, y});
+  m_modified = true;
+}
+
 void Board::modified()
 {
   if(!m_modified)
     return;
 
-  auto updateLink =
-    [this](const std::shared_ptr<Tile>& startTile, const Connector& startConnector)
-    {
-      assert(startTile->node());
+  if(m_modifiedLocations.empty()) // rebuild all links
+  {
+    for(auto& [l, tile] : m_tiles)
+      if(tile->node() && l == tile->location())
+        updateLinks(tile);
 
-      std::vector<std::shared_ptr<Tile>> tiles;
-      std::vector<Connector> connectors;
-      connectors.reserve(2);
+    removeUnconnectedCrossOvers();
 
-      Connector connector{startConnector.opposite()};
-      while(auto nextTile = getTile(connector.location))
-      {
-        if(isIntercardinal(connector.direction)) // check for crossover
-        {
-          auto prevTile = getTile(TileLocation{ nextTile->x, nextTile->y } + connector.direction);
+    // notify board changed:
+    for(auto& [l, tile] : m_tiles)
+      if(l == tile->location()) // check origin to notify each tile once
+        tile->boardModified();
+  }
+  else // only update links passing the modified locations
+  {
+    const auto nodeTiles = findModifiedNodeTiles();
 
-          if(prevTile)
-          {
-            auto otherTile1 = getTile({prevTile->x, nextTile->y});
-            auto otherTile2 = getTile({nextTile->x, prevTile->y});
+    // collect affected tiles in the network before and after the update:
+    std::vector<std::shared_ptr<Tile>> affectedTiles;
+    std::unordered_map<const Node*, size_t> visited;
+    collectAffectedTiles(nodeTiles, affectedTiles, visited);
 
-            if(otherTile1 && otherTile2)
-            {
-              const auto perpendicular =
-                (connector.direction == Connector::Direction::NorthEast) || (connector.direction == Connector::Direction::SouthWest)
-                ? ~rotate90cw(connector.direction) : rotate90cw(connector.direction);
-
-              auto otherConnector1 = otherTile1->getConnector(perpendicular);
-              auto otherConnector2 = otherTile2->getConnector(~perpendicular);
-
-              if(otherConnector1 && otherConnector2) // crossover found!
-              {
-                const TileLocation topLeft{ std::min<int16_t>(prevTile->x, nextTile->x), std::min<int16_t>(prevTile->y, nextTile->y) };
-                auto it = m_railCrossOver.find(topLeft);
-                if(it == m_railCrossOver.end())
-                {
-                  it = m_railCrossOver.emplace(topLeft, std::make_shared<HiddenCrossOverRailTile>(world())).first;
-                  it->second->x.setValueInternal(topLeft.x);
-                  it->second->y.setValueInternal(topLeft.y);
-                }
-                auto& crossOver = it->second;
-                auto crossOverConnector = crossOver->getConnector(connector.direction);
-                assert(crossOverConnector);
-
-                auto link = std::make_shared<Link>(std::move(tiles));
-                link->connect(*startTile->node(), startConnector, *crossOver->node(), *crossOverConnector);
-                return;
-              }
-            }
-          }
-        }
+    for(const auto& tile : nodeTiles)
+      updateLinks(tile);
 
-        if(nextTile->node())
-        {
-          auto link = std::make_shared<Link>(std::move(tiles));
-          link->connect(*startTile->node(), startConnector, *nextTile->node(), connector);
-          return;
-        }
-        tiles.emplace_back(nextTile);
-        connectors.clear();
-        nextTile->getConnectors(connectors);
-        if(connectors.size() == 2 && (connectors[0] == connector || connectors[1] == connector))
-        {
-          connector = connectors[connectors[0] == connector ? 1 : 0].opposite();
-        }
-        else
-        {
-          break;
-        }
-      }
+    removeUnconnectedCrossOvers();
 
-      startTile->node()->get().disconnect(startConnector);
-    };
+    visited.clear();
+    collectAffectedTiles(nodeTiles, affectedTiles, visited);
+
+    // notify board changed:
+    std::unordered_set<const Tile*> notified;
+    for(const auto& tile : affectedTiles)
+      if(!tile->dying() && notified.emplace(tile.get()).second)
+        tile->boardModified();
+  }
 
-  // check/rebuild links:
+  m_modifiedLocations.clear();
+  m_modified = false;
+}
+
+void Board::updateLinks(const std::shared_ptr<Tile>& tile)
+{
+  assert(tile->node());
+
+  std::vector<Connector> connectors;
+  tile->getConnectors(connectors);
+
+  assert(!connectors.empty());
+  for(const auto connector : connectors)
   {
-    std::vector<Connector> connectors;
+    updateLink(tile, connector);
+  }
+}
 
-    for(auto& [l, tile] : m_tiles)
-    {
-      if(auto node = tile->node(); node && l == tile->location())
-      {
-        connectors.clear();
+void Board::updateLink(const std::shared_ptr<Tile>& startTile, const Connector& startConnector)
+{
+  assert(startTile->node());
 
-        tile->getConnectors(connectors);
+  std::vector<std::shared_ptr<Tile>> tiles;
+  std::vector<Connector> connectors;
+  connectors.reserve(2);
 
-        assert(!connectors.empty());
-        for(const auto connector : connectors)
+  Connector connector{startConnector.opposite()};
+  while(auto nextTile = getTile(connector.location))
+  {
+    if(isIntercardinal(connector.direction)) // check for crossover
+    {
+      if(const auto crossing = findCrossing(*nextTile, connector)) // crossover found!
+      {
+        auto it = m_railCrossOver.find(crossing->topLeft);
+        if(it == m_railCrossOver.end())
         {
-          updateLink(tile, connector);
+          it = m_railCrossOver.emplace(crossing->topLeft, std::make_shared<HiddenCrossOverRailTile>(world())).first;
+          it->second->x.setValueInternal(crossing->topLeft.x);
+          it->second->y.setValueInternal(crossing->topLeft.y);
         }
+        auto& crossOver = it->second;
+        auto crossOverConnector = crossOver->getConnector(connector.direction);
+        assert(crossOverConnector);
+
+        auto link = std::make_shared<Link>(std::move(tiles));
+        link->connect(*startTile->node(), startConnector, *crossOver->node(), *crossOverConnector);
+        return;
       }
     }
 
-    // remove unconnected crossovers:
-    auto it = m_railCrossOver.begin();
-    while(it != m_railCrossOver.end())
+    if(nextTile->node())
+    {
+      auto link = std::make_shared<Link>(std::move(tiles));
+      link->connect(*startTile->node(), startConnector, *nextTile->node(), connector);
+      return;
+    }
+    tiles.emplace_back(nextTile);
+    connectors.clear();
+    nextTile->getConnectors(connectors);
+    if(connectors.size() == 2 && (connectors[0] == connector || connectors[1] == connector))
+    {
+      connector = connectors[connectors[0] == connector ? 1 : 0].opposite();
+    }
+    else
     {
-      bool remove = false;
-      assert(it->second->node());
-      for(const auto& link : (*it->second->node()).get().links())
+      break;
+    }
+  }
+
+  startTile->node()->get().disconnect(startConnector);
+}
+
+std::optional<Board::Crossing> Board::findCrossing(const Tile& nextTile, const Connector& connector)
+{
+  assert(isIntercardinal(connector.direction));
+
+  auto prevTile = getTile(TileLocation{nextTile.x, nextTile.y} + connector.direction);
+  if(!prevTile)
+    return std::nullopt;
+
+  auto otherTile1 = getTile({prevTile->x, nextTile.y});
+  auto otherTile2 = getTile({nextTile.x, prevTile->y});
+  if(!otherTile1 || !otherTile2)
+    return std::nullopt;
+
+  const auto perpendicular =
+    (connector.direction == Connector::Direction::NorthEast) || (connector.direction == Connector::Direction::SouthWest)
+    ? ~rotate90cw(connector.direction) : rotate90cw(connector.direction);
+
+  if(!otherTile1->getConnector(perpendicular) || !otherTile2->getConnector(~perpendicular))
+    return std::nullopt;
+
+  const TileLocation topLeft{std::min<int16_t>(prevTile->x, nextTile.x), std::min<int16_t>(prevTile->y, nextTile.y)};
+  return Crossing{topLeft, std::move(otherTile1), std::move(otherTile2)};
+}
+
+std::vector<std::shared_ptr<Tile>> Board::findModifiedNodeTiles()
+{
+  std::vector<std::shared_ptr<Tile>> nodeTiles;
+  std::vector<std::shared_ptr<Tile>> todo;
+  std::unordered_set<const Tile*> visited;
+
+  auto add =
+    [&nodeTiles, &todo, &visited](std::shared_ptr<Tile> tile)
+    {
+      if(tile && visited.emplace(tile.get()).second)
       {
-        if(!link)
-        {
-          remove = true;
-          break;
-        }
+        if(tile->node())
+          nodeTiles.emplace_back(std::move(tile));
+        else
+          todo.emplace_back(std::move(tile));
       }
-      if(remove)
+    };
+
+  // modified locations and their neighbours, a link passing a modified location always passes a neighbour:
+  for(const auto& l : m_modifiedLocations)
+    for(int16_t dx = -1; dx <= 1; dx++)
+      for(int16_t dy = -1; dy <= 1; dy++)
+        add(getTile({static_cast<int16_t>(l.x + dx), static_cast<int16_t>(l.y + dy)}));
+
+  // follow the tracks to the nodes at the end of the links:
+  std::vector<Connector> connectors;
+  std::vector<Connector> nextConnectors;
+  while(!todo.empty())
+  {
+    const auto tile = std::move(todo.back());
+    todo.pop_back();
+
+    connectors.clear();
+    tile->getConnectors(connectors);
+    if(connectors.size() != 2) // not part of a link
+      continue;
+
+    for(const auto& tileConnector : connectors)
+    {
+      const Connector connector{tileConnector.opposite()};
+      auto nextTile = getTile(connector.location);
+      if(!nextTile)
+        continue;
+
+      if(isIntercardinal(connector.direction))
       {
-        it = m_railCrossOver.erase(it);
+        if(auto crossing = findCrossing(*nextTile, connector)) // crossing tracks share the crossover node
+        {
+          add(std::move(crossing->tile1));
+          add(std::move(crossing->tile2));
+        }
       }
-      else
+
+      if(!nextTile->node())
       {
-        it++;
+        nextConnectors.clear();
+        nextTile->getConnectors(nextConnectors);
+        if(std::find(nextConnectors.begin(), nextConnectors.end(), connector) == nextConnectors.end())
+          continue;
       }
+      add(std::move(nextTile));
     }
   }
 
-  // notify board changed:
-  for(auto& [l, tile] : m_tiles)
-    if(l == tile->location()) // check origin to notify each tile once
-      tile->boardModified();
+  return nodeTiles;
+}
 
-  m_modified = false;
+void Board::removeUnconnectedCrossOvers()
+{
+  auto it = m_railCrossOver.begin();
+  while(it != m_railCrossOver.end())
+  {
+    bool remove = false;
+    assert(it->second->node());
+    for(const auto& link : (*it->second->node()).get().links())
+    {
+      if(!link)
+      {
+        remove = true;
+        break;
+      }
+    }
+    if(remove)
+    {
+      it = m_railCrossOver.erase(it);
+    }
+    else
+    {
+      it++;
+    }
+  }
 }
 
 void Board::removeTile(const int16_t x, const int16_t y)
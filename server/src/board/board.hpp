@@ -24,13 +24,16 @@
 #define TRAINTASTIC_SERVER_BOARD_BOARD_HPP
 
 #include "../core/idobject.hpp"
+#include <optional>
 #include <unordered_map>
+#include <unordered_set>
 #include "../core/method.hpp"
 #include <traintastic/board/tilelocation.hpp>
 #include <traintastic/enum/tilerotate.hpp>
 
 class Tile;
 struct TileData;
+struct Connector;
 class HiddenCrossOverRailTile;
 
 class Board : public IdObject
@@ -41,10 +44,24 @@ class Board : public IdObject
     using TileMap = std::unordered_map<TileLocation, std::shared_ptr<Tile>, TileLocationHash>;
 
   private:
+    struct Crossing
+    {
+      TileLocation topLeft;
+      std::shared_ptr<Tile> tile1;
+      std::shared_ptr<Tile> tile2;
+    };
+
     bool m_modified = false;
+    std::unordered_set<TileLocation, TileLocationHash> m_modifiedLocations; //!< Locations changed since last modified(), empty means all.
     std::unordered_map<TileLocation, std::shared_ptr<HiddenCrossOverRailTile>, TileLocationHash> m_railCrossOver;
 
+    void setModified(const Tile& tile);
     void modified();
+    void updateLinks(const std::shared_ptr<Tile>& tile);
+    void updateLink(const std::shared_ptr<Tile>& startTile, const Connector& startConnector);
+    std::optional<Crossing> findCrossing(const Tile& nextTile, const Connector& connector);
+    std::vector<std::shared_ptr<Tile>> findModifiedNodeTiles();
+    void removeUnconnectedCrossOvers();
     void removeTile(int16_t x, int16_t y);
     void updateSize(bool allowShrink = false);
 
@@ -73,24 +73,11 @@ void BoardList::worldEvent(WorldState state, WorldEvent event)
     const auto start = std::chrono::steady_clock::now();
 #endif
 
-    // due to link tile a change on one board might require an update on another board.
-    // for now update all board if one board is changed (should be improved!)
-    bool boardModified = false;
+    // a board only updates the links near modified tiles,
+    // tiles on other boards are notified if they are connected by a link tile.
     for(auto& board : m_items)
     {
-      if(board->m_modified)
-      {
-        boardModified = true;
-        break;
-      }
-    }
-    if(boardModified)
-    {
-      for(auto& board : m_items)
-      {
-        board->m_modified = true;
-        board->modified();
-      }
+      board->modified();
     }
 
 #ifdef ENABLE_LOG_DEBUG
@@ -44,24 +44,19 @@ BoardListTableModel::BoardListTableModel(BoardList& list) :
     });
 }
 
-std::string BoardListTableModel::getText(uint32_t column, uint32_t row) const
+std::string BoardListTableModel::getItemText(uint32_t column, const Board& board) const
 {
-  if(row < rowCount())
+  switch(column)
   {
-    const Board& board = getItem(row);
+    case columnId:
+      return board.id;
 
-    switch(column)
-    {
-      case columnId:
-        return board.id;
+    case columnName:
+      return board.name;
 
-      case columnName:
-        return board.name;
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
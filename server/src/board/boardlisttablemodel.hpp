@@ -40,7 +40,7 @@ class BoardListTableModel : public ObjectListTableModel<Board>
 
     BoardListTableModel(BoardList& list);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const Board& board) const final;
 };
 
 #endif
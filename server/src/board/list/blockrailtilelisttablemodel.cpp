@@ -43,24 +43,19 @@ BlockRailTileListTableModel::BlockRailTileListTableModel(ObjectList<BlockRailTil
     });
 }
 
-std::string BlockRailTileListTableModel::getText(uint32_t column, uint32_t row) const
+std::string BlockRailTileListTableModel::getItemText(uint32_t column, const BlockRailTile& blockrailtile) const
 {
-  if(row < rowCount())
+  switch(column)
   {
-    const BlockRailTile& blockrailtile = getItem(row);
+    case columnId:
+      return blockrailtile.id;
 
-    switch(column)
-    {
-      case columnId:
-        return blockrailtile.id;
+    case columnName:
+      return blockrailtile.name;
 
-      case columnName:
-        return blockrailtile.name;
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
@@ -40,7 +40,7 @@ class BlockRailTileListTableModel : public ObjectListTableModel<BlockRailTile>
 
     BlockRailTileListTableModel(ObjectList<BlockRailTile>& list);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const BlockRailTile& blockrailtile) const final;
 };
 
 #endif
@@ -43,24 +43,19 @@ LinkRailTileListTableModel::LinkRailTileListTableModel(LinkRailTileList& list) :
     });
 }
 
-std::string LinkRailTileListTableModel::getText(uint32_t column, uint32_t row) const
+std::string LinkRailTileListTableModel::getItemText(uint32_t column, const LinkRailTile& linkrailtile) const
 {
-  if(row < rowCount())
+  switch(column)
   {
-    const LinkRailTile& linkrailtile = getItem(row);
+    case columnId:
+      return linkrailtile.id;
 
-    switch(column)
-    {
-      case columnId:
-        return linkrailtile.id;
+    case columnName:
+      return linkrailtile.name;
 
-      case columnName:
-        return linkrailtile.name;
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
@@ -40,7 +40,7 @@ class LinkRailTileListTableModel : public ObjectListTableModel<LinkRailTile>
 
     LinkRailTileListTableModel(LinkRailTileList& list);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const LinkRailTile& linkrailtile) const final;
 };
 
 #endif
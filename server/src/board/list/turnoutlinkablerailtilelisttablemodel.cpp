@@ -42,24 +42,19 @@ TurnoutLinkableRailTileListTableModel::TurnoutLinkableRailTileListTableModel(Tur
   });
 }
 
-std::string TurnoutLinkableRailTileListTableModel::getText(uint32_t column, uint32_t row) const
+std::string TurnoutLinkableRailTileListTableModel::getItemText(uint32_t column, const TurnoutLinkableRailTile& tile) const
 {
-  if(row < rowCount())
+  switch(column)
   {
-    const TurnoutLinkableRailTile& tile = getItem(row);
+    case columnId:
+      return tile.id;
 
-    switch(column)
-    {
-      case columnId:
-        return tile.id;
+    case columnName:
+      return tile.name;
 
-      case columnName:
-        return tile.name;
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
@@ -36,7 +36,7 @@ public:
 
   TurnoutLinkableRailTileListTableModel(TurnoutLinkableRailTileList& list);
 
-  std::string getText(uint32_t column, uint32_t row) const final;
+  std::string getItemText(uint32_t column, const TurnoutLinkableRailTile& tile) const final;
 
 protected:
   void propertyChanged(BaseProperty& property, uint32_t row) final;
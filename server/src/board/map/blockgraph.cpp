@@ -0,0 +1,159 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "blockgraph.hpp"
+#include <algorithm>
+#include <cassert>
+#include "blockpath.hpp"
+#include "../list/blockrailtilelist.hpp"
+#include "../tile/rail/blockrailtile.hpp"
+
+void BlockGraph::invalidate(const BlockRailTile& block)
+{
+  if(!m_valid)
+  {
+    return; // rebuilt anyway
+  }
+
+  const Index index = blockIndex(block);
+  if(index == invalidIndex) [[unlikely]]
+  {
+    m_valid = false; // not in the index yet, rebuild
+    m_outdated.clear();
+  }
+  else if(std::find(m_outdated.begin(), m_outdated.end(), index) == m_outdated.end())
+  {
+    m_outdated.emplace_back(index);
+  }
+}
+
+void BlockGraph::build(const BlockRailTileList& blocks)
+{
+  clear();
+
+  m_blocks.reserve(blocks.length.value());
+  m_blockIndex.reserve(blocks.length.value());
+  for(const auto& block : blocks)
+  {
+    m_blockIndex.emplace(block.get(), static_cast<Index>(m_blocks.size()));
+    m_blocks.emplace_back(block.get());
+  }
+
+  buildEdges();
+
+  m_valid = true;
+}
+
+void BlockGraph::update()
+{
+  assert(m_valid);
+
+  for(const Index index : m_outdated)
+  {
+    for(const auto side : {BlockSide::A, BlockSide::B})
+    {
+      auto& range = m_vertices[vertex(index, side)];
+      const Index size = range.end - range.begin;
+      const auto begin = static_cast<Index>(m_edges.size());
+      appendEdges(*m_blocks[index], side);
+      const auto count = static_cast<Index>(m_edges.size()) - begin;
+
+      if(count <= size) // fits, replace the edges in place
+      {
+        std::copy(m_edges.begin() + begin, m_edges.end(), m_edges.begin() + range.begin);
+        m_edges.resize(begin);
+        range.end = range.begin + count;
+        m_unusedEdges += size - count;
+      }
+      else // keep the appended edges
+      {
+        range = {begin, begin + count};
+        m_unusedEdges += size;
+      }
+    }
+  }
+  m_outdated.clear();
+
+  if(m_unusedEdges > m_edges.size() / 2)
+  {
+    buildEdges();
+  }
+}
+
+void BlockGraph::clear()
+{
+  m_valid = false;
+  m_blocks.clear();
+  m_blockIndex.clear();
+  m_vertices.clear();
+  m_edges.clear();
+  m_unusedEdges = 0;
+  m_outdated.clear();
+}
+
+BlockGraph::Index BlockGraph::blockIndex(const BlockRailTile& block) const
+{
+  if(auto it = m_blockIndex.find(&block); it != m_blockIndex.end())
+  {
+    return it->second;
+  }
+  return invalidIndex;
+}
+
+void BlockGraph::appendEdges(const BlockRailTile& block, BlockSide side)
+{
+  for(const auto& path : block.paths())
+  {
+    if(path->fromSide() != side)
+    {
+      continue;
+    }
+
+    const auto toBlock = path->toBlock();
+    if(!toBlock) [[unlikely]]
+    {
+      continue;
+    }
+
+    if(auto it = m_blockIndex.find(toBlock.get()); it != m_blockIndex.end()) [[likely]]
+    {
+      m_edges.emplace_back(Edge{path.get(), vertex(it->second, ~path->toSide())});
+    }
+  }
+}
+
+void BlockGraph::buildEdges()
+{
+  m_vertices.clear();
+  m_edges.clear();
+  m_unusedEdges = 0;
+
+  m_vertices.reserve(m_blocks.size() * 2);
+  for(auto* block : m_blocks)
+  {
+    for(const auto side : {BlockSide::A, BlockSide::B})
+    {
+      const auto begin = static_cast<Index>(m_edges.size());
+      appendEdges(*block, side);
+      m_vertices.emplace_back(Range{begin, static_cast<Index>(m_edges.size())});
+    }
+  }
+}
@@ -0,0 +1,148 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_BOARD_MAP_BLOCKGRAPH_HPP
+#define TRAINTASTIC_SERVER_BOARD_MAP_BLOCKGRAPH_HPP
+
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <vector>
+#include "../../enum/blockside.hpp"
+
+class BlockRailTile;
+class BlockRailTileList;
+class BlockPath;
+
+/**
+ * \brief Compact adjacency index of the block graph
+ *
+ * A vertex is a block side, the side a train leaves the block.
+ * The edges of a vertex are the block paths starting at that side, stored in one edge array.
+ * The index is built from the cached BlockRailTile::paths(), so queries never walk the board tiles.
+ *
+ * When the paths of a block change only the edges of that block are replaced by update(),
+ * adding or removing a block requires a complete rebuild.
+ */
+class BlockGraph
+{
+  public:
+    using Index = uint32_t;
+
+    static constexpr Index invalidIndex = std::numeric_limits<Index>::max();
+
+    struct Edge
+    {
+      BlockPath* path;
+      Index to; //!< vertex the train leaves the next block
+    };
+
+  private:
+    struct Range
+    {
+      Index begin;
+      Index end;
+    };
+
+    bool m_valid = false;
+    std::vector<BlockRailTile*> m_blocks;
+    std::unordered_map<const BlockRailTile*, Index> m_blockIndex;
+    std::vector<Range> m_vertices; //!< edges of vertex v are m_edges[m_vertices[v].begin] up to m_edges[m_vertices[v].end]
+    std::vector<Edge> m_edges;
+    size_t m_unusedEdges = 0; //!< edges no longer referenced after update(), compacted when more than half is unused
+    std::vector<Index> m_outdated; //!< blocks with changed paths, see invalidate(const BlockRailTile&)
+
+    void appendEdges(const BlockRailTile& block, BlockSide side);
+    void buildEdges();
+
+  public:
+    static constexpr Index vertex(Index blockIndex, BlockSide side)
+    {
+      return blockIndex * 2 + static_cast<Index>(side);
+    }
+
+    static constexpr Index vertexBlockIndex(Index v)
+    {
+      return v / 2;
+    }
+
+    static constexpr BlockSide vertexSide(Index v)
+    {
+      return static_cast<BlockSide>(v % 2);
+    }
+
+    inline bool isValid() const
+    {
+      return m_valid;
+    }
+
+    //! \return \c true if paths of blocks changed since the last build() or update().
+    inline bool isOutdated() const
+    {
+      return !m_outdated.empty();
+    }
+
+    //! Mark the index outdated, it is rebuilt by the next build() call.
+    inline void invalidate()
+    {
+      m_valid = false;
+      m_outdated.clear();
+    }
+
+    //! Mark the paths of \a block changed, its edges are replaced by the next update() call.
+    void invalidate(const BlockRailTile& block);
+
+    void build(const BlockRailTileList& blocks);
+    void update();
+    void clear();
+
+    inline size_t vertexCount() const
+    {
+      return m_vertices.size();
+    }
+
+    //! \return Upper bound of edgeIndex(), to size per edge data.
+    inline size_t edgeCount() const
+    {
+      return m_edges.size();
+    }
+
+    Index blockIndex(const BlockRailTile& block) const;
+
+    inline BlockRailTile& block(Index index) const
+    {
+      return *m_blocks[index];
+    }
+
+    inline std::span<const Edge> edges(Index v) const
+    {
+      return {m_edges.data() + m_vertices[v].begin, m_edges.data() + m_vertices[v].end};
+    }
+
+    //! \return Index of the edge, to be used for per edge data.
+    inline Index edgeIndex(const Edge& edge) const
+    {
+      return static_cast<Index>(&edge - m_edges.data());
+    }
+};
+
+#endif
@@ -20,6 +20,7 @@
  */
 
 #include "blockpath.hpp"
+#include <optional>
 #include <queue>
 #include <traintastic/enum/crossstate.hpp>
 #include "node.hpp"
@@ -35,6 +36,7 @@
 #include "../tile/rail/nxbuttonrailtile.hpp"
 #include "../../train/trainblockstatus.hpp"
 #include "../../core/eventloop.hpp"
+#include "../../hardware/output/outputscheduler.hpp"
 #include "../../core/objectproperty.tpp"
 #include "../../enum/bridgepath.hpp"
 
@@ -448,6 +450,13 @@ bool BlockPath::reserve(const std::shared_ptr<Train>& train, bool dryRun)
     return false;
   }
 
+  // all outputs of the path are scheduled as one group, signals are set after the turnouts etc. are:
+  std::optional<OutputScheduler::Group> outputs;
+  if(!dryRun)
+  {
+    outputs.emplace(nullptr);
+  }
+
   for(const auto& [turnoutWeak, position, toeSideEntry] : m_turnouts)
   {
     if(auto turnout = turnoutWeak.lock())
@@ -533,6 +542,11 @@ bool BlockPath::reserve(const std::shared_ptr<Train>& train, bool dryRun)
     }
   }
 
+  if(outputs)
+  {
+    outputs->setPriority(OutputScheduler::Priority::Low);
+  }
+
   for(const auto& signalWeak : m_signals)
   {
     if(auto signal = signalWeak.lock())
@@ -718,6 +732,20 @@ bool BlockPath::release(bool dryRun)
   return true;
 }
 
+bool BlockPath::unreserve()
+{
+  if(!release())
+  {
+    return false;
+  }
+  // a rollback must not leave a reservation of this path behind in the from block:
+  if(m_fromBlock.getReservedPath(m_fromSide).get() == this)
+  {
+    return m_fromBlock.release(m_fromSide, false);
+  }
+  return true;
+}
+
 bool BlockPath::delayedRelease(uint16_t timeoutMillis)
 {
     if(m_delayedReleaseScheduled)
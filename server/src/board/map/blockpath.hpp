@@ -118,6 +118,9 @@ class BlockPath : public Path, public std::enable_shared_from_this<BlockPath>
 
     bool reserve(const std::shared_ptr<Train>& train, bool dryRun = false);
     bool release(bool dryRun = false);
+    //! \brief Undo reserve(), used to roll back a partially reserved route.
+    //! \return \c true if neither block side is reserved for this path anymore.
+    bool unreserve();
     bool delayedRelease(uint16_t timeoutMillis);
 };
 
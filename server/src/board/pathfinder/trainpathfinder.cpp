@@ -20,17 +20,164 @@
  */
 
 #include "trainpathfinder.hpp"
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <queue>
 #include <traintastic/enum/blocktraindirection.hpp>
 #include "../map/blockpath.hpp"
+#include "../../core/eventloop.hpp"
 #include "../../core/method.tpp"
 #include "../../core/objectproperty.tpp"
+#include "../../core/objectvectorproperty.tpp"
 #include "../../board/tile/rail/blockrailtile.hpp"
+#include "../../hardware/output/outputscheduler.hpp"
+#include "../../train/train.hpp"
 #include "../../train/trainblockstatus.hpp"
+#include "../../world/getworld.hpp"
+
+namespace {
+
+using Index = BlockGraph::Index;
+using Edges = std::vector<const BlockGraph::Edge*>;
+
+struct Candidate
+{
+  Edges edges;
+  double cost = 0;
+};
+
+double blockCost(const BlockRailTile& block)
+{
+  double cost = std::max(block.length.getValue(LengthUnit::Meter), TrainPathFinder::blockLengthMin);
+  if(block.state == BlockState::Occupied || block.state == BlockState::Reserved)
+  {
+    cost += TrainPathFinder::blockOccupiedPenalty;
+  }
+  return cost;
+}
+
+double routeCost(const BlockGraph& graph, const Edges& edges)
+{
+  double cost = 0;
+  for(const auto* edge : edges)
+  {
+    cost += blockCost(graph.block(BlockGraph::vertexBlockIndex(edge->to)));
+  }
+  return cost;
+}
+
+//! Dijkstra search over the block graph, excluded edges and blocks are skipped.
+std::optional<Candidate> shortestRoute(const BlockGraph& graph, Index start, Index goal, const std::vector<bool>& excludedEdges, const std::vector<bool>& excludedBlocks)
+{
+  if(start == goal) [[unlikely]]
+  {
+    return std::nullopt;
+  }
+
+  const Index fromBlock = BlockGraph::vertexBlockIndex(start);
+  const Index toBlock = BlockGraph::vertexBlockIndex(goal);
+
+  std::vector<double> costs(graph.vertexCount(), std::numeric_limits<double>::infinity());
+  std::vector<const BlockGraph::Edge*> previousEdge(graph.vertexCount(), nullptr);
+  std::vector<Index> previousVertex(graph.vertexCount(), BlockGraph::invalidIndex);
+
+  using QueueItem = std::pair<double, Index>;
+  std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+
+  costs[start] = 0;
+  queue.emplace(0, start);
+
+  while(!queue.empty())
+  {
+    const auto [cost, v] = queue.top();
+    queue.pop();
+
+    if(cost > costs[v])
+    {
+      continue; // already visited with lower cost
+    }
+
+    if(v == goal)
+    {
+      Candidate route;
+      route.cost = cost;
+      for(Index u = goal; u != start; u = previousVertex[u])
+      {
+        route.edges.emplace_back(previousEdge[u]);
+      }
+      std::reverse(route.edges.begin(), route.edges.end());
+      return route;
+    }
+
+    for(const auto& edge : graph.edges(v))
+    {
+      if(excludedEdges[graph.edgeIndex(edge)] || edge.path->isReserved())
+      {
+        continue;
+      }
+
+      const Index blockIndex = BlockGraph::vertexBlockIndex(edge.to);
+      const auto& block = graph.block(blockIndex);
+      if(block.state == BlockState::Unknown || excludedBlocks[blockIndex])
+      {
+        continue;
+      }
+
+      if((blockIndex == toBlock || blockIndex == fromBlock) && edge.to != goal)
+      {
+        continue; // don't pass the from or to block
+      }
+
+      if(const double nextCost = cost + blockCost(block); nextCost < costs[edge.to])
+      {
+        costs[edge.to] = nextCost;
+        previousEdge[edge.to] = &edge;
+        previousVertex[edge.to] = v;
+        queue.emplace(nextCost, edge.to);
+      }
+    }
+  }
+
+  return std::nullopt;
+}
+
+std::shared_ptr<Train> getTrain(const BlockRailTile& block, BlockTrainDirection direction)
+{
+  return
+    (direction == BlockTrainDirection::TowardsB)
+      ? block.trains.back()->train.value()
+      : block.trains.front()->train.value();
+}
+
+}
 
 TrainPathFinder::TrainPathFinder(Object& parent_, std::string_view parentPropertyName)
   : PathFinder(parent_, parentPropertyName)
+  , route{*this, "route", {}, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::ScriptReadOnly}
+  , findRoute{*this, "find_route", MethodFlags::ScriptCallable,
+      [this](const std::shared_ptr<BlockRailTile>& fromBlock, BlockTrainDirection fromDirection, const std::shared_ptr<BlockRailTile>& toBlock, BlockTrainDirection toDirection)
+      {
+        if(!fromBlock || !isKnown(fromDirection) || !toBlock || !isKnown(toDirection)) [[unlikely]]
+        {
+          return false;
+        }
+
+        const auto fromSide = (fromDirection == BlockTrainDirection::TowardsA) ? BlockSide::A : BlockSide::B;
+        const auto toSide = (toDirection == BlockTrainDirection::TowardsB) ? BlockSide::A : BlockSide::B;
+
+        const auto routes = findRoutes(*fromBlock, fromSide, *toBlock, toSide, 1);
+        if(routes.empty())
+        {
+          route.clearInternal();
+          return false;
+        }
+
+        setRoute(fromBlock, routes.front());
+        return true;
+      }}
   , reserve{*this, "reserve", MethodFlags::ScriptCallable,
-      [](const std::shared_ptr<BlockRailTile>& fromBlock, BlockTrainDirection fromDirection, const std::shared_ptr<BlockRailTile>& toBlock, BlockTrainDirection toDirection)
+      [this](const std::shared_ptr<BlockRailTile>& fromBlock, BlockTrainDirection fromDirection, const std::shared_ptr<BlockRailTile>& toBlock, BlockTrainDirection toDirection)
       {
         if(!fromBlock || fromBlock->trains.empty() || !isKnown(fromDirection) || !toBlock || !isKnown(toDirection)) [[unlikely]]
         {
@@ -39,26 +186,213 @@ TrainPathFinder::TrainPathFinder(Object& parent_, std::string_view parentPropert
 
         const auto fromSide = (fromDirection == BlockTrainDirection::TowardsA) ? BlockSide::A : BlockSide::B;
         const auto toSide = (toDirection == BlockTrainDirection::TowardsB) ? BlockSide::A : BlockSide::B;
+        const auto train = getTrain(*fromBlock, fromDirection);
 
-        // FIXME: for now only support block to block (direct path only)
-
-        for(const auto& path : fromBlock->paths())
+        // try the cheapest routes first, the first one that can be reserved wins:
+        for(const auto& r : findRoutes(*fromBlock, fromSide, *toBlock, toSide, routeAlternativesMax))
         {
-          if(path->fromSide() == fromSide && path->toBlock() == toBlock && path->toSide() == toSide)
-          {
-            const auto train =
-              (fromDirection == BlockTrainDirection::TowardsB)
-                ? fromBlock->trains.back()->train.value()
-                : fromBlock->trains.front()->train.value();
+          auto reserved = std::make_shared<bool>(false);
+          OutputScheduler::Group outputs(
+            [weak=weak_from_this(), train, reserved]()
+            {
+              if(*reserved)
+              {
+                // also deferred if no output had to be set, the event is never fired during reserve():
+                EventLoop::call(
+                  [weak, train]()
+                  {
+                    if(auto self = std::static_pointer_cast<TrainPathFinder>(weak.lock()))
+                    {
+                      self->fireEvent(self->onRouteSet, train);
+                    }
+                  });
+              }
+            });
 
-            return path->reserve(train);
+          if(reserveRoute(r, train))
+          {
+            *reserved = true;
+            setRoute(fromBlock, r);
+            return true;
           }
         }
 
         return false;
       }}
+  , onRouteSet{*this, "on_route_set", EventFlags::Scriptable}
 {
+  m_interfaceItems.add(route);
+  m_interfaceItems.add(findRoute);
   m_interfaceItems.add(reserve);
+  m_interfaceItems.add(onRouteSet);
+}
+
+void TrainPathFinder::destroying()
+{
+  route.clearInternal();
+  m_blockGraph.clear();
+  PathFinder::destroying();
+}
+
+const BlockGraph& TrainPathFinder::blockGraph()
+{
+  if(!m_blockGraph.isValid())
+  {
+    m_blockGraph.build(*getWorld(*this).blockRailTiles);
+  }
+  else if(m_blockGraph.isOutdated())
+  {
+    m_blockGraph.update();
+  }
+  return m_blockGraph;
 }
 
+std::vector<TrainPathFinder::Route> TrainPathFinder::findRoutes(const BlockRailTile& fromBlock, BlockSide fromSide, const BlockRailTile& toBlock, BlockSide toSide, size_t count)
+{
+  std::vector<Route> routes;
+
+  const auto& graph = blockGraph();
+  const Index fromBlockIndex = graph.blockIndex(fromBlock);
+  const Index toBlockIndex = graph.blockIndex(toBlock);
 
+  if(count == 0 || fromBlockIndex == BlockGraph::invalidIndex || toBlockIndex == BlockGraph::invalidIndex) [[unlikely]]
+  {
+    return routes;
+  }
+
+  const Index start = BlockGraph::vertex(fromBlockIndex, fromSide);
+  const Index goal = BlockGraph::vertex(toBlockIndex, ~toSide);
+
+  std::vector<Candidate> found;
+  if(auto shortest = shortestRoute(graph, start, goal, std::vector<bool>(graph.edgeCount(), false), std::vector<bool>(graph.vertexCount() / 2, false)))
+  {
+    found.emplace_back(std::move(*shortest));
+  }
+
+  // Yen's k-shortest paths, deviate from the previous route at every block:
+  std::vector<Candidate> candidates;
+  while(!found.empty() && found.size() < count)
+  {
+    const Edges previous = found.back().edges;
+
+    for(size_t i = 0; i < previous.size(); i++)
+    {
+      const Index spur = (i == 0) ? start : previous[i - 1]->to;
+
+      std::vector<bool> excludedEdges(graph.edgeCount(), false);
+      for(const auto& r : found)
+      {
+        if(r.edges.size() > i && std::equal(previous.begin(), previous.begin() + i, r.edges.begin()))
+        {
+          excludedEdges[graph.edgeIndex(*r.edges[i])] = true;
+        }
+      }
+
+      std::vector<bool> excludedBlocks(graph.vertexCount() / 2, false);
+      if(i != 0)
+      {
+        excludedBlocks[fromBlockIndex] = true;
+        for(size_t j = 0; j + 1 < i; j++)
+        {
+          excludedBlocks[BlockGraph::vertexBlockIndex(previous[j]->to)] = true;
+        }
+      }
+
+      if(auto spurRoute = shortestRoute(graph, spur, goal, excludedEdges, excludedBlocks))
+      {
+        Candidate candidate;
+        candidate.edges.assign(previous.begin(), previous.begin() + i);
+        candidate.edges.insert(candidate.edges.end(), spurRoute->edges.begin(), spurRoute->edges.end());
+        candidate.cost = routeCost(graph, candidate.edges);
+
+        const auto sameEdges =
+          [&candidate](const Candidate& r)
+          {
+            return r.edges == candidate.edges;
+          };
+
+        if(std::none_of(found.begin(), found.end(), sameEdges) && std::none_of(candidates.begin(), candidates.end(), sameEdges))
+        {
+          candidates.emplace_back(std::move(candidate));
+        }
+      }
+    }
+
+    if(candidates.empty())
+    {
+      break;
+    }
+
+    auto it = std::min_element(candidates.begin(), candidates.end(),
+      [](const Candidate& a, const Candidate& b)
+      {
+        return a.cost < b.cost;
+      });
+    found.emplace_back(std::move(*it));
+    candidates.erase(it);
+  }
+
+  routes.reserve(found.size());
+  for(const auto& candidate : found)
+  {
+    Route& route_ = routes.emplace_back();
+    route_.cost = candidate.cost;
+    route_.paths.reserve(candidate.edges.size());
+    for(const auto* edge : candidate.edges)
+    {
+      route_.paths.emplace_back(edge->path->shared_from_this());
+    }
+  }
+
+  return routes;
+}
+
+bool TrainPathFinder::reserveRoute(const Route& route_, const std::shared_ptr<Train>& train)
+{
+  if(route_.paths.empty() || !train) [[unlikely]]
+  {
+    return false;
+  }
+
+  // dry run all paths first, to make sure it will succeed:
+  for(const auto& path : route_.paths)
+  {
+    if(!path->reserve(train, true))
+    {
+      return false;
+    }
+  }
+
+  for(auto it = route_.paths.begin(); it != route_.paths.end(); ++it)
+  {
+    if(!(*it)->reserve(train))
+    {
+      // paths can depend on each other (e.g. a shared crossing), release what is already reserved:
+      while(it != route_.paths.begin())
+      {
+        --it;
+        [[maybe_unused]] const bool unreserved = (*it)->unreserve();
+        assert(unreserved);
+      }
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void TrainPathFinder::setRoute(const std::shared_ptr<BlockRailTile>& fromBlock, const Route& value)
+{
+  std::vector<std::shared_ptr<BlockRailTile>> blocks;
+  if(!value.paths.empty())
+  {
+    assert(&value.paths.front()->fromBlock() == fromBlock.get());
+    blocks.reserve(value.paths.size() + 1);
+    blocks.emplace_back(fromBlock);
+    for(const auto& path : value.paths)
+    {
+      blocks.emplace_back(path->toBlock());
+    }
+  }
+  route.setValuesInternal(std::move(blocks));
+}
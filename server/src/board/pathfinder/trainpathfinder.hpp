@@ -23,9 +23,16 @@
 #define TRAINTASTIC_SERVER_BOARD_PATHFINDER_TRAINPATHFINDER_HPP
 
 #include "pathfinder.hpp"
+#include <vector>
+#include "../../core/event.hpp"
 #include "../../core/method.hpp"
+#include "../../core/objectvectorproperty.hpp"
+#include "../map/blockgraph.hpp"
+#include "../../enum/blockside.hpp"
 
 class BlockRailTile;
+class BlockPath;
+class Train;
 enum class BlockTrainDirection : uint8_t;
 
 class TrainPathFinder : public PathFinder
@@ -33,9 +40,51 @@ class TrainPathFinder : public PathFinder
   CLASS_ID("path_finder.train")
 
 public:
+  //! A route is a chain of block paths, each path starts in the block the previous path ends.
+  struct Route
+  {
+    std::vector<std::shared_ptr<BlockPath>> paths;
+    double cost = 0;
+  };
+
+  static constexpr size_t routeAlternativesMax = 4; //!< Number of routes tried by reserve before giving up.
+  static constexpr double blockLengthMin = 1; //!< Cost of a block without a length [m].
+  static constexpr double blockOccupiedPenalty = 1000; //!< Extra cost of passing an occupied or reserved block [m].
+
+  static bool reserveRoute(const Route& route, const std::shared_ptr<Train>& train);
+
+private:
+  BlockGraph m_blockGraph;
+
+  void setRoute(const std::shared_ptr<BlockRailTile>& fromBlock, const Route& value);
+
+protected:
+  void destroying() override;
+
+public:
+  ObjectVectorProperty<BlockRailTile> route;
+  Method<bool(const std::shared_ptr<BlockRailTile>&, BlockTrainDirection, const std::shared_ptr<BlockRailTile>&, BlockTrainDirection)> findRoute;
   Method<bool(const std::shared_ptr<BlockRailTile>&, BlockTrainDirection, const std::shared_ptr<BlockRailTile>&, BlockTrainDirection)> reserve;
+  Event<const std::shared_ptr<Train>&> onRouteSet; //!< Fired when all outputs of a route reserved by reserve are set, always after reserve returned.
 
   TrainPathFinder(Object& parent_, std::string_view parentPropertyName);
+
+  //! \return Block graph index, rebuilt or updated if outdated.
+  const BlockGraph& blockGraph();
+
+  //! Must be called when blocks are added/removed.
+  inline void blockGraphChanged()
+  {
+    m_blockGraph.invalidate();
+  }
+
+  //! Must be called when the paths of \a block change.
+  inline void blockGraphChanged(const BlockRailTile& block)
+  {
+    m_blockGraph.invalidate(block);
+  }
+
+  std::vector<Route> findRoutes(const BlockRailTile& fromBlock, BlockSide fromSide, const BlockRailTile& toBlock, BlockSide toSide, size_t count);
 };
 
 #endif
\ No newline at end of file
@@ -40,6 +40,7 @@
 #include "../../list/blockrailtilelist.hpp"
 #include "../../list/blockrailtilelisttablemodel.hpp"
 #include "../../map/blockpath.hpp"
+#include "../../pathfinder/trainpathfinder.hpp"
 
 constexpr uint8_t toMask(BlockSide side)
 {
@@ -590,6 +591,10 @@ void BlockRailTile::addToWorld()
   RailTile::addToWorld();
 
   m_world.blockRailTiles->addObject(shared_ptr<BlockRailTile>());
+  if(m_world.trainPathFinder)
+  {
+    m_world.trainPathFinder->blockGraphChanged();
+  }
 }
 
 void BlockRailTile::loaded()
@@ -612,6 +617,10 @@ void BlockRailTile::destroying()
     zones->back()->blocks->remove(self);
   }
   m_world.blockRailTiles->removeObject(self);
+  if(m_world.trainPathFinder)
+  {
+    m_world.trainPathFinder->blockGraphChanged();
+  }
   RailTile::destroying();
 }
 
@@ -669,6 +678,7 @@ void BlockRailTile::updatePaths()
 {
   auto current = std::move(m_paths);
   m_paths.clear(); // make sure it is empty, it problably is after the move
+  const size_t currentCount = current.size();
   auto found = BlockPath::find(*this);
 
   while(!current.empty()) // handle existing paths
@@ -696,11 +706,18 @@ void BlockRailTile::updatePaths()
     }
   }
 
+  const bool changed = !found.empty() || m_paths.size() != currentCount;
+
   for(auto& path : found) // new paths
   {
     path->toBlock()->m_pathsIn.emplace_back(path);
     m_paths.emplace_back(std::move(path));
   }
+
+  if(changed && m_world.trainPathFinder)
+  {
+    m_world.trainPathFinder->blockGraphChanged(*this);
+  }
 }
 
 void BlockRailTile::updateHeightWidthMax()
@@ -22,9 +22,14 @@
 
 #include "baseproperty.hpp"
 #include "object.hpp"
+#include "../world/statejournal.hpp"
 
 void BaseProperty::changed()
 {
   if(!m_object.dying())
+  {
+    if(isStateStoreable())
+      StateJournal::record(*this);
     m_object.propertyChanged(*this);
+  }
 }
@@ -37,6 +37,7 @@ class AbstractValuesAttribute;
 class InterfaceItem
 {
   friend struct Attributes;
+  friend class InterfaceItems;
 
   public:
     using Attributes = std::unordered_map<AttributeName, std::unique_ptr<AbstractAttribute>>;
@@ -44,6 +45,7 @@ class InterfaceItem
   protected:
     Object& m_object;
     std::string_view m_name;
+    uint16_t m_index = 0;
     Attributes m_attributes;
 
     template<typename T>
@@ -132,6 +134,12 @@ class InterfaceItem
       return m_name;
     }
 
+    //! \brief Position in the object's interface items, used to address the item on the wire.
+    uint16_t index() const
+    {
+      return m_index;
+    }
+
     const Attributes& attributes() const
     {
       return m_attributes;
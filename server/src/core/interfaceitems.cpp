@@ -23,6 +23,14 @@
 #include "interfaceitems.hpp"
 #include "interfaceitem.hpp"
 #include <algorithm>
+#include <bit>
+#include <cassert>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
 
 #ifndef NDEBUG
 #include "abstractproperty.hpp"
@@ -37,10 +45,125 @@ static void check(const InterfaceItem& item)
 }
 #endif
 
-InterfaceItem* InterfaceItems::find(std::string_view name) const
+//! \brief Perfect hash table: item name to item index, shared between objects.
+class InterfaceItems::Index
 {
-  auto it = m_items.find(name);
-  return (it != m_items.end()) ? &it->second : nullptr;
+  private:
+    static constexpr uint32_t empty = ~uint32_t{0};
+
+    std::vector<std::string> m_names; //!< copies, the items of the object that created it may be gone
+    std::vector<uint32_t> m_table;
+    uint64_t m_seed = 0;
+    unsigned int m_shift = 64;
+
+    static uint64_t hash(std::string_view name, uint64_t seed)
+    {
+      return (static_cast<uint64_t>(std::hash<std::string_view>()(name)) ^ seed) * 0x9E3779B97F4A7C15ULL;
+    }
+
+    bool tryBuild(size_t tableSize, uint64_t seed)
+    {
+      m_table.assign(tableSize, empty);
+      m_seed = seed;
+      m_shift = 64 - static_cast<unsigned int>(std::countr_zero(tableSize));
+      for(uint32_t i = 0; i < m_names.size(); i++)
+      {
+        uint32_t& entry = m_table[slot(m_names[i])];
+        if(entry != empty)
+        {
+          if(m_names[entry] == m_names[i])
+          {
+            continue; // duplicate name, first one wins
+          }
+          return false;
+        }
+        entry = i;
+      }
+      return true;
+    }
+
+    size_t slot(std::string_view name) const
+    {
+      return (m_shift < 64) ? static_cast<size_t>(hash(name, m_seed) >> m_shift) : 0;
+    }
+
+  public:
+    Index(const std::vector<InterfaceItem*>& items)
+    {
+      m_names.reserve(items.size());
+      for(const auto* item : items)
+      {
+        m_names.emplace_back(item->name());
+      }
+
+      // find a seed without collisions, grow the table if that takes too long:
+      for(size_t tableSize = std::bit_ceil(std::max<size_t>(2 * m_names.size(), 1));; tableSize *= 2)
+      {
+        for(uint64_t seed = 0; seed < 64; seed++)
+        {
+          if(tryBuild(tableSize, seed * 0xC2B2AE3D27D4EB4FULL))
+          {
+            return;
+          }
+        }
+      }
+    }
+
+    bool matches(const std::vector<InterfaceItem*>& items) const
+    {
+      return
+        items.size() == m_names.size() &&
+        std::equal(items.begin(), items.end(), m_names.begin(),
+          [](const InterfaceItem* item, const std::string& name)
+          {
+            return item->name() == name;
+          });
+    }
+
+    uint32_t find(std::string_view name) const
+    {
+      const uint32_t index = m_table[slot(name)];
+      return (index != empty && m_names[index] == name) ? index : empty;
+    }
+
+    static const Index& get(const std::type_info& type, const std::vector<InterfaceItem*>& items)
+    {
+      static std::mutex mutex;
+      static std::unordered_map<std::type_index, std::vector<std::unique_ptr<Index>>> indices;
+
+      std::lock_guard<std::mutex> lock(mutex);
+      auto& variants = indices[type]; // usually one, more if items differ between objects of a class
+      for(const auto& index : variants)
+      {
+        if(index->matches(items))
+        {
+          return *index;
+        }
+      }
+      return *variants.emplace_back(std::make_unique<Index>(items));
+    }
+
+    static constexpr uint32_t notFound = empty;
+};
+
+std::pair<std::string_view, InterfaceItem&> InterfaceItems::const_iterator::operator*() const
+{
+  return {(*m_it)->name(), **m_it};
+}
+
+InterfaceItem* InterfaceItems::find(const std::type_info& type, std::string_view name) const
+{
+  const uint32_t n = index(type).find(name);
+  return (n != Index::notFound) ? m_items[n] : nullptr;
+}
+
+const InterfaceItems::Index& InterfaceItems::index(const std::type_info& type) const
+{
+  if(!m_index)
+  {
+    m_index = &Index::get(type, m_items);
+  }
+  return *m_index;
 }
 
 void InterfaceItems::add(InterfaceItem& item)
@@ -48,8 +171,10 @@ void InterfaceItems::add(InterfaceItem& item)
 #ifndef NDEBUG
   check(item);
 #endif
-  m_items.emplace(item.name(), item);
-  m_itemOrder.push_back(item.name());
+  assert(m_items.size() <= std::numeric_limits<uint16_t>::max());
+  item.m_index = static_cast<uint16_t>(m_items.size());
+  m_items.emplace_back(&item);
+  m_index = nullptr;
 }
 
 void InterfaceItems::insertBefore(InterfaceItem& item, const InterfaceItem& before)
@@ -57,6 +182,9 @@ void InterfaceItems::insertBefore(InterfaceItem& item, const InterfaceItem& befo
 #ifndef NDEBUG
   check(item);
 #endif
-  m_items.emplace(item.name(), item);
-  m_itemOrder.insert(std::find(m_itemOrder.begin(), m_itemOrder.end(), before.name()), item.name());
+  assert(m_items.size() <= std::numeric_limits<uint16_t>::max());
+  auto it = m_items.insert(std::find(m_items.begin(), m_items.end(), &before), &item);
+  for(; it != m_items.end(); ++it)
+    (*it)->m_index = static_cast<uint16_t>(it - m_items.begin());
+  m_index = nullptr;
 }
@@ -23,32 +23,68 @@
 #ifndef TRAINTASTIC_SERVER_CORE_INTERFACEITEMS_HPP
 #define TRAINTASTIC_SERVER_CORE_INTERFACEITEMS_HPP
 
-#include <unordered_map>
-#include <list>
+#include <vector>
 #include <string_view>
+#include <typeinfo>
+#include <utility>
 
 class InterfaceItem;
 
+/**
+ * \brief Interface items of an object, in order of addition.
+ *
+ * An instance only stores pointers to its items, name lookup uses a perfect hash table that
+ * is shared by all objects of the same class with the same item names. The table is built
+ * on first lookup and bound to the instance, so objects that are never looked up by name
+ * (e.g. most tiles) don't pay for it.
+ */
 class InterfaceItems
 {
+  public:
+    class Index;
+
+    class const_iterator
+    {
+      private:
+        std::vector<InterfaceItem*>::const_iterator m_it;
+
+      public:
+        const_iterator(std::vector<InterfaceItem*>::const_iterator it)
+          : m_it{it}
+        {
+        }
+
+        std::pair<std::string_view, InterfaceItem&> operator*() const;
+        const_iterator& operator++() { ++m_it; return *this; }
+        bool operator==(const const_iterator& other) const { return m_it == other.m_it; }
+        bool operator!=(const const_iterator& other) const { return m_it != other.m_it; }
+    };
+
   protected:
-    std::unordered_map<std::string_view, InterfaceItem&> m_items;
-    std::list<std::string_view> m_itemOrder;
+    std::vector<InterfaceItem*> m_items;
+    mutable const Index* m_index = nullptr;
 
   public:
-    using const_iterator = std::unordered_map<std::string_view, InterfaceItem&>::const_iterator;
-
     inline const_iterator begin() const { return m_items.cbegin(); }
     inline const_iterator end() const { return m_items.cend(); }
+    inline size_t size() const { return m_items.size(); }
 
-    const std::list<std::string_view>& names() const { return m_itemOrder; }
+    //! \brief Get item by its \ref InterfaceItem::index() "index", \c nullptr if out of range.
+    inline InterfaceItem* get(size_t index) const { return index < m_items.size() ? m_items[index] : nullptr; }
 
-    InterfaceItem* find(std::string_view name) const;
+    //! \param[in] type Type of the object owning the items, objects of the same type share the lookup table.
+    InterfaceItem* find(const std::type_info& type, std::string_view name) const;
+
+    /**
+     * \brief Get the shared lookup table.
+     *
+     * Objects with the same type and item names share the table, so its address can be used
+     * to cache per class data that depends on the item order.
+     */
+    const Index& index(const std::type_info& type) const;
 
     void add(InterfaceItem& item);
     void insertBefore(InterfaceItem& item, const InterfaceItem& before);
-
-    inline InterfaceItem& operator[](std::string_view name) const { return m_items.at(name); }
 };
 
 #endif
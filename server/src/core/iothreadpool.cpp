@@ -0,0 +1,88 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "iothreadpool.hpp"
+#include <string>
+#if __has_include(<pthread.h>)
+  #include <pthread.h>
+#endif
+#ifdef WIN32
+  #include <windows.h>
+#endif
+#include "../utils/setthreadname.hpp"
+
+static void setThreadAffinity(std::thread& thread, unsigned int cpu)
+{
+#if defined(__linux__)
+  cpu_set_t cpuSet;
+  CPU_ZERO(&cpuSet);
+  CPU_SET(cpu, &cpuSet);
+  pthread_setaffinity_np(thread.native_handle(), sizeof(cpuSet), &cpuSet);
+#elif defined(WIN32)
+  SetThreadAffinityMask(thread.native_handle(), static_cast<DWORD_PTR>(1) << cpu);
+#else
+  (void)thread;
+  (void)cpu;
+#endif
+}
+
+void IOThreadPool::start(unsigned int threadCount, bool cpuPinning)
+{
+  assert(!s_ioContext);
+  assert(threadCount > 0);
+
+  s_ioContext = std::make_unique<boost::asio::io_context>(static_cast<int>(threadCount));
+  s_keepAlive = std::make_unique<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>>(s_ioContext->get_executor());
+
+  const unsigned int cpuCount = std::max(std::thread::hardware_concurrency(), 1U);
+  s_threads.reserve(threadCount);
+  for(unsigned int i = 0; i < threadCount; i++)
+  {
+    auto& thread = s_threads.emplace_back(
+      [i]()
+      {
+        setThreadName(std::string("io-pool-").append(std::to_string(i)).c_str());
+        s_ioContext->run();
+      });
+
+    if(cpuPinning)
+    {
+      setThreadAffinity(thread, i % cpuCount);
+    }
+  }
+}
+
+void IOThreadPool::stop()
+{
+  if(!s_ioContext)
+  {
+    return;
+  }
+
+  s_keepAlive.reset();
+  for(auto& thread : s_threads)
+  {
+    thread.join();
+  }
+  s_threads.clear();
+  s_ioContext.reset();
+}
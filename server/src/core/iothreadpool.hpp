@@ -0,0 +1,77 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef TRAINTASTIC_SERVER_CORE_IOTHREADPOOL_HPP
+#define TRAINTASTIC_SERVER_CORE_IOTHREADPOOL_HPP
+
+#include <cassert>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <boost/asio/executor_work_guard.hpp>
+#include <boost/asio/io_context.hpp>
+
+/**
+ * \brief Shared IO thread pool for hardware kernels
+ *
+ * When started, kernels run as a strand on the pool instead of in a thread of their own,
+ * see KernelBase. It must be started before and stopped after all kernels exist.
+ */
+class IOThreadPool
+{
+  private:
+    IOThreadPool() = default;
+    ~IOThreadPool() = default;
+
+    IOThreadPool(const IOThreadPool&) = delete;
+    IOThreadPool& operator =(const IOThreadPool&) = delete;
+
+    inline static std::unique_ptr<boost::asio::io_context> s_ioContext;
+    inline static std::unique_ptr<boost::asio::executor_work_guard<boost::asio::io_context::executor_type>> s_keepAlive;
+    inline static std::vector<std::thread> s_threads;
+
+  public:
+    static bool isRunning()
+    {
+      return s_ioContext != nullptr;
+    }
+
+    static boost::asio::io_context& ioContext()
+    {
+      assert(s_ioContext);
+      return *s_ioContext;
+    }
+
+    static size_t threadCount()
+    {
+      return s_threads.size();
+    }
+
+    /**
+     * \param[in] threadCount Number of threads, must be at least one.
+     * \param[in] cpuPinning Pin thread N to CPU N, best effort, not supported on all platforms.
+     */
+    static void start(unsigned int threadCount, bool cpuPinning);
+    static void stop();
+};
+
+#endif
@@ -50,12 +50,12 @@ void Object::destroy()
 
 const InterfaceItem* Object::getItem(std::string_view name) const
 {
-  return m_interfaceItems.find(name);
+  return m_interfaceItems.find(typeid(*this), name);
 }
 
 InterfaceItem* Object::getItem(std::string_view name)
 {
-  return m_interfaceItems.find(name);
+  return m_interfaceItems.find(typeid(*this), name);
 }
 
 const AbstractMethod* Object::getMethod(std::string_view name) const
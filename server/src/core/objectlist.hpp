@@ -70,6 +70,8 @@ class ObjectList : public AbstractObjectList
     {
       m_propertyChanged.clear();
       m_items.clear();
+      for(auto& model : m_models)
+        model->rebuild();
       m_items.reserve(items.size());
       for(auto& item : items)
         if(std::shared_ptr<T> t = std::dynamic_pointer_cast<T>(item))
@@ -92,7 +94,7 @@ class ObjectList : public AbstractObjectList
           if(m_items[row] == obj)
           {
             for(auto& model : m_models)
-              model->propertyChanged(property, row);
+              model->itemPropertyChanged(property, row);
             break;
           }
       }
@@ -100,17 +102,14 @@ class ObjectList : public AbstractObjectList
 
     void rowCountChanged()
     {
-      const auto size = m_items.size();
-      length.setValueInternal(static_cast<uint32_t>(size));
-      for(auto& model : m_models)
-        model->setRowCount(static_cast<uint32_t>(size));
+      length.setValueInternal(static_cast<uint32_t>(m_items.size()));
     }
 
     void rowsChanged(uint32_t first, uint32_t last)
     {
       for(auto& model : m_models)
       {
-        model->rowsChanged(first, last);
+        model->itemsMoved(first, last);
       }
     }
 
@@ -152,6 +151,8 @@ class ObjectList : public AbstractObjectList
       m_items.emplace_back(std::move(object));
       objectAdded(m_items.back());
       rowCountChanged();
+      for(auto& model : m_models)
+        model->itemAdded();
     }
 
     void removeObject(const std::shared_ptr<T>& object)
@@ -165,10 +166,10 @@ class ObjectList : public AbstractObjectList
         m_items.erase(it);
         objectRemoved(object);
         rowCountChanged();
-        
+
         for(auto& model : m_models)
         {
-          model->rowRemovedHack(row);
+          model->itemRemoved(row);
         }
       }
     }
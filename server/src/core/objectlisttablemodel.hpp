@@ -24,8 +24,19 @@
 #define TRAINTASTIC_SERVER_CORE_OBJECTLISTTABLEMODEL_HPP
 
 #include "tablemodel.hpp"
+#include <algorithm>
+#include <optional>
 #include "objectlist.hpp"
+#include "../utils/fromchars.hpp"
+#include "../utils/tolower.hpp"
 
+/**
+ * \brief Table model of an object list
+ *
+ * The model can present a view of the list: sorted by a column, filtered by a predicate
+ * and/or a text search. The view is maintained incrementally as items are added, removed
+ * or changed, so clients only receive the rows of their region in view order.
+ */
 template<typename T>
 class ObjectListTableModel : public TableModel
 {
@@ -33,11 +44,239 @@ class ObjectListTableModel : public TableModel
 
   private:
     std::shared_ptr<ObjectList<T>> m_list;
+    std::function<bool(const T&)> m_filter;
+    std::string m_search; //!< lower case
+    uint32_t m_sortColumn = invalidColumn;
+    bool m_sortDescending = false;
+    std::vector<uint32_t> m_rows; //!< list index of each row, only used if there is a view
+    std::vector<std::string> m_sortKeys; //!< sort key of each list item, only used if sorted
 
-  protected:
-    static constexpr uint32_t invalidColumn = std::numeric_limits<uint32_t>::max();
+    //! \brief Compare numbers by value, so 9 is before 10.
+    static int compare(std::string_view a, std::string_view b)
+    {
+      int64_t na;
+      int64_t nb;
+      if(auto ra = fromChars(a, na); ra.ec == std::errc() && ra.ptr == a.data() + a.size())
+        if(auto rb = fromChars(b, nb); rb.ec == std::errc() && rb.ptr == b.data() + b.size())
+          return (na < nb) ? -1 : (na > nb ? 1 : 0);
+      return a.compare(b);
+    }
+
+    bool hasView() const
+    {
+      return m_filter || !m_search.empty() || m_sortColumn != invalidColumn;
+    }
+
+    uint32_t listSize() const
+    {
+      return static_cast<uint32_t>(m_list->m_items.size());
+    }
+
+    std::string sortKey(uint32_t index) const
+    {
+      return toLower(getItemText(m_sortColumn, *m_list->m_items[index]));
+    }
+
+    //! \brief Cell text as searched, lower case and without translatable \c $name:key$ texts.
+    //! \note Translations are only known by the client, so translated texts can't be searched.
+    static std::string searchText(std::string text)
+    {
+      std::string::size_type start = 0;
+      while((start = text.find('$', start)) != std::string::npos)
+      {
+        const auto end = text.find('$', start + 1);
+        if(end == std::string::npos)
+          break;
+        const std::string_view key{text.data() + start + 1, end - start - 1};
+        if(key.find(':') != std::string_view::npos && key.find(' ') == std::string_view::npos)
+          text.erase(start, end - start + 1);
+        else
+          start++;
+      }
+      return toLower(text);
+    }
+
+    bool isVisible(uint32_t index) const
+    {
+      const T& item = *m_list->m_items[index];
+      if(m_filter && !m_filter(item))
+        return false;
+      if(m_search.empty())
+        return true;
+      for(uint32_t column = 0; column < columnCount(); column++)
+        if(searchText(getItemText(column, item)).find(m_search) != std::string::npos)
+          return true;
+      return false;
+    }
+
+    //! \brief Row order, by sort key if sorted, else (and for equal keys) by list order.
+    bool less(uint32_t a, uint32_t b) const
+    {
+      if(!m_sortKeys.empty())
+        if(const int r = compare(m_sortKeys[a], m_sortKeys[b]); r != 0)
+          return m_sortDescending ? (r > 0) : (r < 0);
+      return a < b;
+    }
+
+    //! \brief Row of a list item, must be called before its sort key changes.
+    std::vector<uint32_t>::iterator findRow(uint32_t index)
+    {
+      auto it = std::lower_bound(m_rows.begin(), m_rows.end(), index,
+        [this](uint32_t a, uint32_t b)
+        {
+          return less(a, b);
+        });
+      return (it != m_rows.end() && *it == index) ? it : m_rows.end();
+    }
+
+    uint32_t insertRow(uint32_t index)
+    {
+      auto it = std::upper_bound(m_rows.begin(), m_rows.end(), index,
+        [this](uint32_t a, uint32_t b)
+        {
+          return less(a, b);
+        });
+      return static_cast<uint32_t>(std::distance(m_rows.begin(), m_rows.insert(it, index)));
+    }
+
+    void rebuild()
+    {
+      m_rows.clear();
+      m_sortKeys.clear();
+
+      if(hasView())
+      {
+        const uint32_t size = listSize();
+        if(m_sortColumn != invalidColumn)
+        {
+          m_sortKeys.reserve(size);
+          for(uint32_t index = 0; index < size; index++)
+            m_sortKeys.emplace_back(sortKey(index));
+        }
+        m_rows.reserve(size);
+        for(uint32_t index = 0; index < size; index++)
+          if(isVisible(index))
+            m_rows.emplace_back(index);
+        std::sort(m_rows.begin(), m_rows.end(),
+          [this](uint32_t a, uint32_t b)
+          {
+            return less(a, b);
+          });
+        setRowCount(static_cast<uint32_t>(m_rows.size()));
+      }
+      else
+        setRowCount(listSize());
+
+      if(rowCount() != 0)
+        rowsChanged(0, rowCount() - 1);
+    }
+
+    void itemAdded()
+    {
+      if(!hasView())
+      {
+        setRowCount(listSize());
+        return;
+      }
+
+      const uint32_t index = listSize() - 1;
+      if(m_sortColumn != invalidColumn)
+        m_sortKeys.emplace_back(sortKey(index));
+      if(isVisible(index))
+      {
+        const uint32_t row = insertRow(index);
+        setRowCount(static_cast<uint32_t>(m_rows.size()));
+        rowsChanged(row, rowCount() - 1);
+      }
+    }
+
+    void itemRemoved(uint32_t index)
+    {
+      if(!hasView())
+      {
+        setRowCount(listSize());
+        rowRemovedHack(index);
+        return;
+      }
 
-    const T& getItem(uint32_t row) const { return *m_list->m_items[row]; }
+      std::optional<uint32_t> row;
+      if(auto it = findRow(index); it != m_rows.end())
+      {
+        row = static_cast<uint32_t>(std::distance(m_rows.begin(), it));
+        m_rows.erase(it);
+      }
+
+      if(!m_sortKeys.empty())
+        m_sortKeys.erase(m_sortKeys.begin() + index);
+      for(auto& r : m_rows)
+        if(r > index)
+          r--;
+
+      setRowCount(static_cast<uint32_t>(m_rows.size()));
+      if(row)
+        rowRemovedHack(*row);
+    }
+
+    void itemsMoved(uint32_t first, uint32_t last)
+    {
+      if(hasView())
+        rebuild();
+      else
+        rowsChanged(first, last);
+    }
+
+    void itemPropertyChanged(BaseProperty& property, uint32_t index)
+    {
+      if(!hasView())
+        propertyChanged(property, index);
+      else if(const auto row = updateRow(index))
+        propertyChanged(property, *row);
+    }
+
+    //! \brief Update the row of an item after it has changed.
+    //! \return Row of the item if it didn't move, else \c std::nullopt and the changed rows are already reported.
+    std::optional<uint32_t> updateRow(uint32_t index)
+    {
+      auto it = findRow(index);
+      if(!m_sortKeys.empty())
+        m_sortKeys[index] = sortKey(index);
+
+      const bool visible = isVisible(index);
+      if(it != m_rows.end())
+      {
+        const auto row = static_cast<uint32_t>(std::distance(m_rows.begin(), it));
+        if(visible &&
+            (row == 0 || less(m_rows[row - 1], index)) &&
+            (row + 1 == m_rows.size() || less(index, m_rows[row + 1])))
+        {
+          return row; // still in place
+        }
+
+        m_rows.erase(it);
+        if(visible)
+        {
+          const uint32_t newRow = insertRow(index);
+          rowsChanged(std::min(row, newRow), std::max(row, newRow));
+        }
+        else
+        {
+          setRowCount(static_cast<uint32_t>(m_rows.size()));
+          rowRemovedHack(row);
+        }
+      }
+      else if(visible)
+      {
+        const uint32_t row = insertRow(index);
+        setRowCount(static_cast<uint32_t>(m_rows.size()));
+        rowsChanged(row, rowCount() - 1);
+      }
+      return std::nullopt;
+    }
+
+  protected:
+    const T& getItem(uint32_t row) const { return *m_list->m_items[hasView() ? m_rows[row] : row]; }
+    virtual std::string getItemText(uint32_t column, const T& item) const = 0;
+    virtual Value getItemValue(uint32_t column, const T& item) const { return getItemText(column, item); }
     virtual void propertyChanged(BaseProperty& property, uint32_t row) = 0;
 
   public:
@@ -55,6 +294,62 @@ class ObjectListTableModel : public TableModel
       assert(it != m_list->m_models.end());
       m_list->m_models.erase(it);
     }
+
+    std::string getText(uint32_t column, uint32_t row) const final
+    {
+      if(row < rowCount())
+        return getItemText(column, getItem(row));
+      return {};
+    }
+
+    Value getValue(uint32_t column, uint32_t row) const final
+    {
+      if(row < rowCount())
+        return getItemValue(column, getItem(row));
+      return std::string{};
+    }
+
+    bool isViewSupported() const final
+    {
+      return true;
+    }
+
+    void setSort(uint32_t column, bool descending) final
+    {
+      m_sortColumn = (column < columnCount()) ? column : invalidColumn;
+      m_sortDescending = descending;
+      rebuild();
+    }
+
+    void setSearch(std::string_view text) final
+    {
+      m_search = toLower(text);
+      rebuild();
+    }
+
+    void setView(uint32_t sortColumn, bool sortDescending, std::string_view search) final
+    {
+      m_sortColumn = (sortColumn < columnCount()) ? sortColumn : invalidColumn;
+      m_sortDescending = sortDescending;
+      m_search = toLower(search);
+      rebuild();
+    }
+
+    void setFilter(std::function<bool(const T&)> filter)
+    {
+      m_filter = std::move(filter);
+      rebuild();
+    }
+
+    //! \brief Item changed, by something else than one of its properties.
+    void itemChanged(uint32_t index, uint32_t column)
+    {
+      if(!hasView())
+        changed(index, column);
+      else if(const auto row = updateRow(index))
+        changed(*row, column);
+    }
+
 };
 
 #endif
@@ -100,6 +100,15 @@ class ObjectVectorProperty : public AbstractObjectVectorProperty
     ObjectPtr getObject(size_t index) const final;
     void setObject(size_t index, const ObjectPtr& value) final;
 
+    void setValuesInternal(std::vector<std::shared_ptr<T>> values)
+    {
+      if(m_values != values)
+      {
+        m_values = std::move(values);
+        changed();
+      }
+    }
+
     void appendInternal(std::shared_ptr<T> value)
     {
       m_values.emplace_back(std::move(value));
@@ -59,7 +59,7 @@ void TableModel::setRegion(const Region& value)
 void TableModel::rowsChanged(uint32_t first, uint32_t last)
 {
   Region update = m_region;
-  if(update.rowMin <= last || update.rowMax >= first)
+  if(updateRegion && update.rowMin <= last && update.rowMax >= first)
   {
     update.rowMin = std::max(update.rowMin, first);
     update.rowMax = std::min(update.rowMax, last);
@@ -71,7 +71,7 @@ void TableModel::rowRemovedHack(uint32_t row)
 {
   //Hack, tell clients to refresh from row onwards
   Region update = m_region;
-  if(update.rowMin <= row && update.rowMax >= row)
+  if(updateRegion && update.rowMin <= row && update.rowMax >= row)
   {
     update.rowMin = row;
     update.rowMax = std::min(update.rowMax, m_rowCount > 0 ? m_rowCount - 1 : 0);
@@ -25,11 +25,18 @@
 
 #include "object.hpp"
 #include <functional>
+#include <limits>
+#include <variant>
 #include "tablemodelptr.hpp"
 
 class TableModel : public Object
 {
   public:
+    static constexpr uint32_t invalidColumn = std::numeric_limits<uint32_t>::max();
+
+    //! \brief Typed cell value, see getValue().
+    using Value = std::variant<bool, int64_t, double, std::string>;
+
     struct Region
     {
       uint32_t columnMin;
@@ -108,9 +115,26 @@ class TableModel : public Object
     uint32_t rowCount() const { return m_rowCount; }
 
     virtual std::string getText(uint32_t column, uint32_t row) const = 0;
+    //! \brief Cell value as sent to clients, the text of the cell unless the model has a better typed value.
+    virtual Value getValue(uint32_t column, uint32_t row) const { return getText(column, row); }
 
+    const Region& region() const { return m_region; }
     void setRegion(const Region& value);
 
+    //! \brief If the model supports a server side view, see setSort() and setSearch().
+    virtual bool isViewSupported() const { return false; }
+    //! \brief Sort rows by the text of a column, \ref invalidColumn restores the original order.
+    virtual void setSort(uint32_t /*column*/, bool /*descending*/) {}
+    //! \brief Only show rows with a column containing text (case insensitive), empty shows all rows.
+    //! \note Translated texts, e.g. enum values, aren't searched.
+    virtual void setSearch(std::string_view /*text*/) {}
+    //! \brief Set sort and search at once, see setSort() and setSearch().
+    virtual void setView(uint32_t sortColumn, bool sortDescending, std::string_view search)
+    {
+      setSort(sortColumn, sortDescending);
+      setSearch(search);
+    }
+
     void rowsChanged(uint32_t first, uint32_t last);
     void rowRemovedHack(uint32_t row);
 };
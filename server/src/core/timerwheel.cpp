@@ -0,0 +1,135 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "timerwheel.hpp"
+#include "eventloop.hpp"
+
+TimerWheel::TimerWheel()
+  : m_timer{EventLoop::ioContext()}
+  , m_start{std::chrono::steady_clock::now()}
+{
+}
+
+TimerWheel::~TimerWheel()
+{
+  m_timer.cancel();
+}
+
+TimerWheel::Id TimerWheel::add(std::chrono::milliseconds delay, Callback callback)
+{
+  // round up, a timer never expires early:
+  const auto expiry = (std::chrono::steady_clock::now() - m_start) + std::max(delay, std::chrono::milliseconds::zero());
+  const auto expiryTick = std::max(static_cast<uint64_t>((expiry + tickDuration - std::chrono::nanoseconds(1)) / tickDuration), m_tick + 1);
+
+  const Id id = ++m_lastId;
+  m_timers.emplace(id, Timer{expiryTick, std::move(callback)});
+  m_slots[expiryTick & (slotCount - 1)].emplace_back(id);
+
+  if(!m_timerActive)
+  {
+    startTimer();
+  }
+  return id;
+}
+
+void TimerWheel::cancel(Id id)
+{
+  m_timers.erase(id); // id is removed from its slot when the slot is processed
+
+  if(m_timers.empty() && m_timerActive)
+  {
+    m_timer.cancel();
+    m_timerActive = false;
+  }
+}
+
+uint64_t TimerWheel::currentTick() const
+{
+  return static_cast<uint64_t>((std::chrono::steady_clock::now() - m_start) / tickDuration);
+}
+
+void TimerWheel::startTimer()
+{
+  m_timerActive = true;
+  m_timer.expires_at(m_start + (m_tick + 1) * tickDuration);
+  m_timer.async_wait(
+    [this](const boost::system::error_code& ec)
+    {
+      if(!ec)
+      {
+        tick();
+      }
+    });
+}
+
+void TimerWheel::tick()
+{
+  const uint64_t now = currentTick();
+
+  // catch up on missed ticks, after a full turn all slots are processed:
+  const uint64_t first = std::max(m_tick + 1, now >= slotCount ? now - slotCount + 1 : 0);
+  for(uint64_t t = first; t <= now; t++)
+  {
+    m_tick = t;
+    processSlot(t);
+  }
+  m_tick = now;
+
+  if(!m_timers.empty())
+  {
+    startTimer();
+  }
+  else
+  {
+    m_timerActive = false;
+  }
+}
+
+void TimerWheel::processSlot(uint64_t tick)
+{
+  auto& slot = m_slots[tick & (slotCount - 1)];
+  if(slot.empty())
+  {
+    return;
+  }
+
+  // callbacks may add timers to this slot, so process a copy:
+  std::vector<Id> ids;
+  ids.swap(slot);
+
+  for(size_t i = 0; i < ids.size(); i++)
+  {
+    auto it = m_timers.find(ids[i]);
+    if(it == m_timers.end())
+    {
+      continue; // cancelled
+    }
+    if(it->second.expiryTick > m_tick)
+    {
+      slot.emplace_back(ids[i]); // expires in a later turn of the wheel
+      continue;
+    }
+    Callback callback = std::move(it->second.callback);
+    m_timers.erase(it);
+    callback();
+  }
+}
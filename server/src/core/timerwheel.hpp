@@ -0,0 +1,91 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef TRAINTASTIC_SERVER_CORE_TIMERWHEEL_HPP
+#define TRAINTASTIC_SERVER_CORE_TIMERWHEEL_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+#include <boost/asio/steady_timer.hpp>
+
+/**
+ * \brief Hashed timer wheel running on the event loop
+ *
+ * Timers are hashed by expiry tick into a fixed number of slots, each tick only the timers
+ * of one slot are checked. Adding and cancelling a timer is O(1), so many pending timers
+ * cost almost nothing. The resolution is one tick, timers never expire early.
+ */
+class TimerWheel
+{
+  public:
+    using Id = uint64_t;
+    using Callback = std::function<void()>;
+
+    static constexpr Id invalidId = 0;
+    static constexpr auto tickDuration = std::chrono::milliseconds(10);
+    static constexpr size_t slotCount = 512; //!< must be a power of two
+
+  private:
+    static_assert((slotCount & (slotCount - 1)) == 0);
+
+    struct Timer
+    {
+      uint64_t expiryTick;
+      Callback callback;
+    };
+
+    boost::asio::steady_timer m_timer;
+    const std::chrono::steady_clock::time_point m_start;
+    uint64_t m_tick = 0; //!< last processed tick
+    bool m_timerActive = false;
+    Id m_lastId = invalidId;
+    std::unordered_map<Id, Timer> m_timers;
+    std::array<std::vector<Id>, slotCount> m_slots; //!< may contain ids of cancelled timers, they are removed when the slot is processed
+
+    uint64_t currentTick() const;
+    void startTimer();
+    void tick();
+    void processSlot(uint64_t tick);
+
+  public:
+    TimerWheel();
+    ~TimerWheel();
+
+    //! \brief Number of pending timers
+    size_t size() const
+    {
+      return m_timers.size();
+    }
+
+    //! \brief Call callback once after (at least) the delay
+    //! \return Timer id, to be used with cancel()
+    Id add(std::chrono::milliseconds delay, Callback callback);
+
+    //! \brief Cancel a pending timer, does nothing if the timer already expired or was cancelled
+    void cancel(Id id);
+};
+
+#endif
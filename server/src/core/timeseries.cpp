@@ -0,0 +1,115 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "timeseries.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+void TimeSeries::add(int64_t time, float value)
+{
+  if(std::isnan(value))
+  {
+    return;
+  }
+
+  for(size_t i = 0; i < m_rings.size(); i++)
+  {
+    auto& ring = m_rings[i];
+    const int64_t capacity = static_cast<int64_t>(capacities[i]);
+    const int64_t number = periodNumber(time, periods[i]);
+
+    if(ring.buckets.empty())
+    {
+      ring.buckets.resize(capacities[i]);
+      ring.last = number;
+    }
+    else if(number > ring.last)
+    {
+      // clear the buckets skipped and the bucket that is reused:
+      if(number - ring.last >= capacity)
+      {
+        std::fill(ring.buckets.begin(), ring.buckets.end(), Bucket{});
+      }
+      else
+      {
+        for(int64_t n = ring.last + 1; n <= number; n++)
+        {
+          ring.buckets[slot(n, capacity)] = Bucket{};
+        }
+      }
+      ring.last = number;
+    }
+    else if(number <= ring.last - capacity) // too old
+    {
+      continue;
+    }
+
+    auto& bucket = ring.buckets[slot(number, capacity)];
+    if(bucket.count == 0)
+    {
+      bucket.min = value;
+      bucket.max = value;
+    }
+    else
+    {
+      bucket.min = std::min(bucket.min, value);
+      bucket.max = std::max(bucket.max, value);
+    }
+    bucket.sum += value;
+    bucket.count++;
+  }
+}
+
+TimeSeries::Window TimeSeries::window(TimeSeriesResolution resolution, int64_t from, int64_t to) const
+{
+  const size_t index = static_cast<size_t>(resolution);
+  assert(index < m_rings.size());
+  const auto& ring = m_rings[index];
+  const int64_t period = periods[index];
+  const int64_t capacity = static_cast<int64_t>(capacities[index]);
+
+  int64_t first = periodNumber(from, period);
+  int64_t last = periodNumber(to, period);
+
+  if(!ring.buckets.empty())
+  {
+    first = std::max(first, ring.last - capacity + 1);
+  }
+  last = std::min(last, first + capacity - 1);
+
+  Window result{first * period, period, {}};
+  if(last < first)
+  {
+    return result;
+  }
+
+  result.buckets.resize(static_cast<size_t>(last - first + 1));
+  if(!ring.buckets.empty())
+  {
+    for(int64_t n = first; n <= std::min(last, ring.last); n++)
+    {
+      result.buckets[static_cast<size_t>(n - first)] = ring.buckets[slot(n, capacity)];
+    }
+  }
+  return result;
+}
@@ -0,0 +1,117 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+
+#ifndef TRAINTASTIC_SERVER_CORE_TIMESERIES_HPP
+#define TRAINTASTIC_SERVER_CORE_TIMESERIES_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <traintastic/enum/timeseriesresolution.hpp>
+
+/**
+ * \brief Fixed memory time series
+ *
+ * Every value is aggregated (minimum, maximum and average) into a ring buffer per resolution:
+ * one second buckets for the last hour, one minute buckets for the last day and one hour buckets
+ * for the last 30 days. The ring buffers are allocated on the first value.
+ */
+class TimeSeries
+{
+  public:
+    static constexpr std::array<int64_t, 3> periods{{1, 60, 3'600}}; //!< Bucket length per resolution [s]
+    static constexpr std::array<size_t, 3> capacities{{3'600, 1'440, 720}}; //!< Number of buckets per resolution
+
+    struct Bucket
+    {
+      float min = std::numeric_limits<float>::quiet_NaN();
+      float max = std::numeric_limits<float>::quiet_NaN();
+      float sum = 0;
+      uint32_t count = 0;
+
+      //! \return Average value, NaN if the bucket is empty.
+      float average() const
+      {
+        return count != 0 ? sum / static_cast<float>(count) : std::numeric_limits<float>::quiet_NaN();
+      }
+    };
+
+    struct Window
+    {
+      int64_t start; //!< Start of the first bucket, seconds since epoch
+      int64_t period; //!< Bucket length [s]
+      std::vector<Bucket> buckets;
+    };
+
+  private:
+    struct Ring
+    {
+      std::vector<Bucket> buckets;
+      int64_t last; //!< Period number of the newest bucket
+    };
+
+    std::array<Ring, 3> m_rings;
+
+    static int64_t periodNumber(int64_t time, int64_t period)
+    {
+      return (time >= 0 ? time : time - period + 1) / period; // round down
+    }
+
+    static size_t slot(int64_t number, int64_t capacity)
+    {
+      return static_cast<size_t>(((number % capacity) + capacity) % capacity);
+    }
+
+  public:
+    //! \return \c true if no value is added yet.
+    bool empty() const
+    {
+      return m_rings[0].buckets.empty();
+    }
+
+    /**
+     * \brief Add a value
+     *
+     * Values older than the oldest bucket of a resolution are ignored for that resolution.
+     *
+     * \param[in] time Seconds since epoch.
+     * \param[in] value Value, NaN is ignored.
+     */
+    void add(int64_t time, float value);
+
+    /**
+     * \brief Get buckets covering a time range
+     *
+     * The range is limited to the buckets kept for the resolution, empty buckets have a zero count.
+     *
+     * \param[in] resolution Bucket length.
+     * \param[in] from Seconds since epoch, inclusive.
+     * \param[in] to Seconds since epoch, inclusive.
+     * \return Buckets from \p from to \p to.
+     */
+    Window window(TimeSeriesResolution resolution, int64_t from, int64_t to) const;
+};
+
+#endif
@@ -30,6 +30,7 @@
 #include "../../utils/contains.hpp"
 #include "../../utils/displayname.hpp"
 #include "../../utils/unit.hpp"
+#include "../../world/telemetry.hpp"
 #include "../../world/world.hpp"
 
 CREATE_IMPL(Booster)
@@ -106,6 +107,13 @@ void Booster::addToWorld()
 {
   IdObject::addToWorld();
   m_world.boosters->addObject(shared_ptr<Booster>());
+
+  auto& telemetry = m_world.telemetry();
+  telemetry.add(load_);
+  telemetry.add(temperature);
+  telemetry.add(current);
+  telemetry.add(voltage);
+  telemetry.add(inputVoltage);
 }
 
 void Booster::destroying()
@@ -113,6 +121,7 @@ void Booster::destroying()
   driver->destroy();
   driver.setValueInternal(nullptr);
   m_world.boosters->removeObject(shared_ptr<Booster>());
+  m_world.telemetry().remove(*this);
   IdObject::destroying();
 }
 
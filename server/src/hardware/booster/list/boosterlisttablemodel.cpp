@@ -43,24 +43,19 @@ BoosterListTableModel::BoosterListTableModel(BoosterList& list) :
   });
 }
 
-std::string BoosterListTableModel::getText(uint32_t column, uint32_t row) const
+std::string BoosterListTableModel::getItemText(uint32_t column, const Booster& booster) const
 {
-  if(row < rowCount())
+  switch(column)
   {
-    const Booster& booster = getItem(row);
+    case columnId:
+      return booster.id;
 
-    switch(column)
-    {
-      case columnId:
-        return booster.id;
+    case columnName:
+      return booster.name;
 
-      case columnName:
-        return booster.name;
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
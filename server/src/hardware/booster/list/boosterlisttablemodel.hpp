@@ -41,7 +41,7 @@ class BoosterListTableModel : public ObjectListTableModel<Booster>
 
     BoosterListTableModel(BoosterList& boosterList);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const Booster& booster) const final;
 };
 
 #endif
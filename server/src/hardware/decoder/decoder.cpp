@@ -278,6 +278,18 @@ void Decoder::setFunctionValue(uint32_t number, bool value)
     f->value.setValueInternal(value);
 }
 
+bool Decoder::setThrottleDeferred(float value)
+{
+  value = std::clamp(value, throttleMin, throttleMax);
+  if(value == throttle.value())
+    return false;
+
+  throttle.setValueInternal(value);
+  decoderChanged(*this, DecoderChangeFlags::Throttle, 0);
+  updateEditable();
+  return true;
+}
+
 bool Decoder::acquire(Throttle& driver, bool steal)
 {
   if(m_driver)
@@ -129,6 +129,11 @@ class Decoder : public IdObject
     bool getFunctionValue(const std::shared_ptr<const DecoderFunction>& function) const;
     void setFunctionValue(uint32_t number, bool value);
 
+    //! \brief Set throttle without notifying the interface
+    //! Used by the TrainMotionScheduler, it notifies the interfaces for multiple decoders at once.
+    //! \return \c true if the throttle is changed
+    bool setThrottleDeferred(float value);
+
     bool acquire(Throttle& driver, bool steal = false);
     void release(Throttle& driver);
 
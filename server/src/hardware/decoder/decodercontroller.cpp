@@ -193,3 +193,11 @@ IdObject& DecoderController::interface()
   assert(object);
   return *object;
 }
+
+void DecoderController::decoderThrottlesChanged(std::span<const std::shared_ptr<Decoder>> changedDecoders)
+{
+  for(const auto& decoder : changedDecoders)
+  {
+    decoderChanged(*decoder, DecoderChangeFlags::Throttle, 0);
+  }
+}
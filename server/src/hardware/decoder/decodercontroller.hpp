@@ -88,6 +88,11 @@ class DecoderController
     const std::shared_ptr<Decoder>& getDecoder(DecoderProtocol protocol, uint16_t address);
 
     virtual void decoderChanged(const Decoder& decoder, DecoderChangeFlags changes, uint32_t functionNumber) = 0;
+
+    //! \brief Throttle of multiple decoders changed
+    //! Called by the TrainMotionScheduler once per update with all changed decoders of this controller.
+    //! The default implementation calls decoderChanged() for each decoder, override to combine the commands.
+    virtual void decoderThrottlesChanged(std::span<const std::shared_ptr<Decoder>> changedDecoders);
 };
 
 #endif
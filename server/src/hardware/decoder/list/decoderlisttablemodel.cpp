@@ -76,55 +76,60 @@ DecoderListTableModel::DecoderListTableModel(DecoderList& list) :
   setColumnHeaders(std::move(labels));
 }
 
-std::string DecoderListTableModel::getText(uint32_t column, uint32_t row) const
+std::string DecoderListTableModel::getItemText(uint32_t column, const Decoder& decoder) const
 {
-  if(row < rowCount())
+  assert(column < m_columns.size());
+  switch(m_columns[column])
   {
-    const Decoder& decoder = getItem(row);
+    case DecoderListColumn::Id:
+      return decoder.id;
 
-    assert(column < m_columns.size());
-    switch(m_columns[column])
-    {
-      case DecoderListColumn::Id:
-        return decoder.id;
-
-      case DecoderListColumn::Name:
-        if(decoder.vehicle) [[likely]]
-        {
-          return decoder.vehicle->name;
-        }
+    case DecoderListColumn::Name:
+      if(decoder.vehicle) [[likely]]
+      {
+        return decoder.vehicle->name;
+      }
+      return {};
+
+    case DecoderListColumn::Interface:
+      if(const auto& interface = std::dynamic_pointer_cast<Object>(decoder.interface.value()))
+      {
+        if(auto* property = interface->getProperty("name"); property && !property->toString().empty())
+          return property->toString();
+
+        return interface->getObjectId();
+      }
+      return "";
+
+    case DecoderListColumn::Protocol:
+      if(const auto* it = EnumValues<DecoderProtocol>::value.find(decoder.protocol); it != EnumValues<DecoderProtocol>::value.end())
+        return std::string("$").append(EnumName<DecoderProtocol>::value).append(":").append(it->second).append("$");
+      break;
+
+    case DecoderListColumn::Address:
+      if(hasAddress(decoder.protocol.value()))
+        return decoder.address.toString();
+      else
         return {};
 
-      case DecoderListColumn::Interface:
-        if(const auto& interface = std::dynamic_pointer_cast<Object>(decoder.interface.value()))
-        {
-          if(auto* property = interface->getProperty("name"); property && !property->toString().empty())
-            return property->toString();
-
-          return interface->getObjectId();
-        }
-        return "";
-
-      case DecoderListColumn::Protocol:
-        if(const auto* it = EnumValues<DecoderProtocol>::value.find(decoder.protocol); it != EnumValues<DecoderProtocol>::value.end())
-          return std::string("$").append(EnumName<DecoderProtocol>::value).append(":").append(it->second).append("$");
-        break;
-
-      case DecoderListColumn::Address:
-        if(hasAddress(decoder.protocol.value()))
-          return decoder.address.toString();
-        else
-          return {};
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
 }
 
+TableModel::Value DecoderListTableModel::getItemValue(uint32_t column, const Decoder& decoder) const
+{
+  assert(column < m_columns.size());
+  if(m_columns[column] == DecoderListColumn::Address && hasAddress(decoder.protocol.value()))
+  {
+    return static_cast<int64_t>(decoder.address.value());
+  }
+  return getItemText(column, decoder);
+}
+
 void DecoderListTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   std::string_view name = property.name();
@@ -48,7 +48,8 @@ class DecoderListTableModel : public ObjectListTableModel<Decoder>
 
     DecoderListTableModel(DecoderList& commandStationList);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const Decoder& decoder) const final;
+    Value getItemValue(uint32_t column, const Decoder& decoder) const final;
 };
 
 #endif
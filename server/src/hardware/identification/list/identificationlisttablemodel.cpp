@@ -75,55 +75,50 @@ IdentificationListTableModel::IdentificationListTableModel(IdentificationList& l
   setColumnHeaders(std::move(labels));
 }
 
-std::string IdentificationListTableModel::getText(uint32_t column, uint32_t row) const
+std::string IdentificationListTableModel::getItemText(uint32_t column, const Identification& identification) const
 {
-  if(row < rowCount())
+  assert(column < m_columns.size());
+  switch(m_columns[column])
   {
-    const Identification& identification = getItem(row);
+    case IdentificationListColumn::Id:
+      return identification.id;
 
-    assert(column < m_columns.size());
-    switch(m_columns[column])
-    {
-      case IdentificationListColumn::Id:
-        return identification.id;
+    case IdentificationListColumn::Name:
+      return identification.name;
 
-      case IdentificationListColumn::Name:
-        return identification.name;
+    case IdentificationListColumn::Interface:
+      if(const auto& interface = std::dynamic_pointer_cast<Object>(identification.interface.value()))
+      {
+        if(auto* property = interface->getProperty("name"); property && !property->toString().empty())
+          return property->toString();
 
-      case IdentificationListColumn::Interface:
-        if(const auto& interface = std::dynamic_pointer_cast<Object>(identification.interface.value()))
-        {
-          if(auto* property = interface->getProperty("name"); property && !property->toString().empty())
-            return property->toString();
+        return interface->getObjectId();
+      }
+      return "";
 
-          return interface->getObjectId();
-        }
+    case IdentificationListColumn::Channel:
+    {
+      const uint32_t channel = identification.channel.value();
+      if(channel == IdentificationController::defaultIdentificationChannel)
         return "";
 
-      case IdentificationListColumn::Channel:
+      if(const auto* aliasKeys = identification.channel.tryGetValuesAttribute(AttributeName::AliasKeys))
       {
-        const uint32_t channel = identification.channel.value();
-        if(channel == IdentificationController::defaultIdentificationChannel)
-          return "";
-
-        if(const auto* aliasKeys = identification.channel.tryGetValuesAttribute(AttributeName::AliasKeys))
+        if(const auto* aliasValues = identification.channel.tryGetValuesAttribute(AttributeName::AliasValues))
         {
-          if(const auto* aliasValues = identification.channel.tryGetValuesAttribute(AttributeName::AliasValues))
-          {
-            assert(aliasKeys->length() == aliasValues->length());
-            for(uint32_t i = 0; i < aliasKeys->length(); i++)
-              if(aliasKeys->getInt64(i) == channel)
-                return aliasValues->getString(i);
-          }
+          assert(aliasKeys->length() == aliasValues->length());
+          for(uint32_t i = 0; i < aliasKeys->length(); i++)
+            if(aliasKeys->getInt64(i) == channel)
+              return aliasValues->getString(i);
         }
-
-        return std::to_string(channel);
       }
-      case IdentificationListColumn::Address:
-        return std::to_string(identification.address.value());
+
+      return std::to_string(channel);
     }
-    assert(false);
+    case IdentificationListColumn::Address:
+      return std::to_string(identification.address.value());
   }
+  assert(false);
 
   return "";
 }
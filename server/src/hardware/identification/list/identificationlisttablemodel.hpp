@@ -48,7 +48,7 @@ class IdentificationListTableModel : public ObjectListTableModel<Identification>
 
     IdentificationListTableModel(IdentificationList& list);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const Identification& identification) const final;
 };
 
 #endif
@@ -70,51 +70,67 @@ InputListTableModel::InputListTableModel(InputList& list)
   setColumnHeaders(std::move(labels));
 }
 
-std::string InputListTableModel::getText(uint32_t column, uint32_t row) const
+std::string InputListTableModel::getItemText(uint32_t column, const Input& input) const
 {
-  if(row < rowCount())
+  assert(column < m_columns.size());
+  switch(m_columns[column])
   {
-    const Input& input = getItem(row);
-
-    assert(column < m_columns.size());
-    switch(m_columns[column])
-    {
-      case InputListColumn::Interface:
-        if(const auto& interface = std::dynamic_pointer_cast<Object>(input.interface.value()))
-        {
-          if(auto* property = interface->getProperty("name"); property && !property->toString().empty())
-            return property->toString();
+    case InputListColumn::Interface:
+      if(const auto& interface = std::dynamic_pointer_cast<Object>(input.interface.value()))
+      {
+        if(auto* property = interface->getProperty("name"); property && !property->toString().empty())
+          return property->toString();
 
-          return interface->getObjectId();
-        }
-        return "";
+        return interface->getObjectId();
+      }
+      return "";
 
-      case InputListColumn::Channel:
-        if(input.interface->inputChannels().size() > 1)
+    case InputListColumn::Channel:
+      if(input.interface->inputChannels().size() > 1)
+      {
+        if(const auto* it = EnumValues<InputChannel>::value.find(input.channel); it != EnumValues<InputChannel>::value.end()) /*[[likely]]*/
         {
-          if(const auto* it = EnumValues<InputChannel>::value.find(input.channel); it != EnumValues<InputChannel>::value.end()) /*[[likely]]*/
-          {
-            return std::string("$").append(EnumName<InputChannel>::value).append(":").append(it->second).append("$");
-          }
+          return std::string("$").append(EnumName<InputChannel>::value).append(":").append(it->second).append("$");
         }
-        break;
+      }
+      break;
 
-      case InputListColumn::Node:
-        if(hasNodeAddressLocation(input.channel))
-        {
-          return std::to_string(input.node.value());
-        }
-        return {};
+    case InputListColumn::Node:
+      if(hasNodeAddressLocation(input.channel))
+      {
+        return std::to_string(input.node.value());
+      }
+      return {};
 
-      case InputListColumn::Address:
-        return std::to_string(input.address.value());
-    }
-    assert(false);
+    case InputListColumn::Address:
+      return std::to_string(input.address.value());
   }
+  assert(false);
 
   return "";
 }
 
+TableModel::Value InputListTableModel::getItemValue(uint32_t column, const Input& input) const
+{
+  assert(column < m_columns.size());
+  switch(m_columns[column])
+  {
+    case InputListColumn::Node:
+      if(hasNodeAddressLocation(input.channel))
+      {
+        return static_cast<int64_t>(input.node.value());
+      }
+      break;
+
+    case InputListColumn::Address:
+      return static_cast<int64_t>(input.address.value());
+
+    default:
+      break;
+  }
+  return getItemText(column, input);
+}
+
 void InputListTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   std::string_view name = property.name();
@@ -48,7 +48,8 @@ class InputListTableModel : public ObjectListTableModel<Input>
 
     InputListTableModel(InputList& list);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const Input& input) const final;
+    Value getItemValue(uint32_t column, const Input& input) const final;
 };
 
 #endif
@@ -130,6 +130,7 @@ CBUSInterface::CBUSInterface(World& world, std::string_view _id)
   m_interfaceItems.insertBefore(inputs, notes);
 
   m_interfaceItems.insertBefore(outputs, notes);
+  m_interfaceItems.insertBefore(outputScheduler, notes);
 
   m_cbusPropertyChanged = cbus->propertyChanged.connect(
     [this](BaseProperty& /*property*/)
@@ -242,7 +243,7 @@ void CBUSInterface::inputSimulateChange(InputChannel channel, const InputLocatio
 {
   if(m_simulator)
   {
-    boost::asio::post(m_kernel->ioContext(),
+    boost::asio::post(m_kernel->executor(),
       [this, channel, location, action]
       {
         switch(channel)
@@ -416,6 +417,11 @@ void CBUSInterface::worldEvent(WorldState state, WorldEvent event)
   }
 }
 
+KernelBase* CBUSInterface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool CBUSInterface::setOnline(bool& value, bool simulation)
 {
   if(!m_kernel && value)
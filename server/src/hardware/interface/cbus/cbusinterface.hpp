@@ -103,6 +103,7 @@ protected:
   void worldEvent(WorldState state, WorldEvent event) final;
 
   bool setOnline(bool& value, bool simulation) final;
+  KernelBase* kernel() final;
 
 private:
   std::unique_ptr<CBUS::Kernel> m_kernel;
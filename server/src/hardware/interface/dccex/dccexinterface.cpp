@@ -102,6 +102,7 @@ DCCEXInterface::DCCEXInterface(World& world, std::string_view _id)
   m_interfaceItems.insertBefore(inputs, notes);
 
   m_interfaceItems.insertBefore(outputs, notes);
+  m_interfaceItems.insertBefore(outputScheduler, notes);
 
   m_dccexPropertyChanged = dccex->propertyChanged.connect(
     [this](BaseProperty& property)
@@ -211,6 +212,11 @@ bool DCCEXInterface::setOutputValue(OutputChannel channel, const OutputLocation&
     m_kernel->setOutput(channel, static_cast<uint16_t>(address), value);
 }
 
+KernelBase* DCCEXInterface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool DCCEXInterface::setOnline(bool& value, bool simulation)
 {
   if(!m_kernel && value)
@@ -68,6 +68,7 @@ class DCCEXInterface final
 
   protected:
     bool setOnline(bool& value, bool simulation) final;
+    KernelBase* kernel() final;
 
   public:
     Property<DCCEXInterfaceType> type;
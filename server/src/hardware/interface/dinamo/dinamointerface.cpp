@@ -122,6 +122,7 @@ DinamoInterface::DinamoInterface(World& world, std::string_view _id)
   m_interfaceItems.insertBefore(inputs, notes);
 
   m_interfaceItems.insertBefore(outputs, notes);
+  m_interfaceItems.insertBefore(outputScheduler, notes);
 
   m_dinamoPropertyChanged = dinamo->propertyChanged.connect(
     [this](BaseProperty& /*property*/)
@@ -595,6 +596,11 @@ void DinamoInterface::worldEvent(WorldState state, WorldEvent event)
   }
 }
 
+KernelBase* DinamoInterface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool DinamoInterface::setOnline(bool& value, bool simulation)
 {
   if(!m_kernel && value)
@@ -88,6 +88,7 @@ protected:
   void worldEvent(WorldState state, WorldEvent event) final;
 
   bool setOnline(bool& value, bool simulation) final;
+  KernelBase* kernel() final;
   void onlineChanged(bool value) final;
 
 private:
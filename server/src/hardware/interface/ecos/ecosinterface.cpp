@@ -75,6 +75,7 @@ ECoSInterface::ECoSInterface(World& world, std::string_view _id)
   m_interfaceItems.insertBefore(inputs, notes);
 
   m_interfaceItems.insertBefore(outputs, notes);
+  m_interfaceItems.insertBefore(outputScheduler, notes);
 
   m_interfaceItems.insertBefore(identifications, notes);
 }
@@ -162,6 +163,11 @@ std::pair<uint32_t, uint32_t> ECoSInterface::identificationAddressMinMax(uint32_
   return {ECoS::Kernel::ecosDetectorAddressMin, ECoS::Kernel::ecosDetectorAddressMax};
 }
 
+KernelBase* ECoSInterface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool ECoSInterface::setOnline(bool& value, bool simulation)
 {
   if(!m_kernel && value)
@@ -70,6 +70,7 @@ class ECoSInterface final
 
   protected:
     bool setOnline(bool& value, bool simulation) final;
+    KernelBase* kernel() final;
 
   public:
     Property<std::string> hostname;
@@ -21,9 +21,12 @@
 
 #include "interface.hpp"
 #include "interfacelisttablemodel.hpp"
+#include <limits>
 #include "../../core/attributes.hpp"
 #include "../../core/objectproperty.tpp"
 #include "../../utils/displayname.hpp"
+#include "../protocol/kernelbase.hpp"
+#include "../../world/telemetry.hpp"
 #include "../../world/world.hpp"
 
 Interface::Interface(World& world, std::string_view _id)
@@ -67,6 +70,26 @@ void Interface::addToWorld()
   IdObject::addToWorld();
   m_world.interfaces->addObject(shared_ptr<Interface>());
   m_world.statuses.appendInternal(status.value());
+
+  auto& telemetry = m_world.telemetry();
+  telemetry.add(*this, telemetryMessagesReceived,
+    [this]()
+    {
+      auto* k = kernel();
+      return k ? static_cast<float>(k->takeMessagesReceived()) / Telemetry::sampleInterval.count() : std::numeric_limits<float>::quiet_NaN();
+    });
+  telemetry.add(*this, telemetryMessagesSent,
+    [this]()
+    {
+      auto* k = kernel();
+      return k ? static_cast<float>(k->takeMessagesSent()) / Telemetry::sampleInterval.count() : std::numeric_limits<float>::quiet_NaN();
+    });
+  telemetry.add(*this, telemetryUpdateQueueDepth,
+    [this]()
+    {
+      auto* k = kernel();
+      return k ? static_cast<float>(k->takeUpdatesPeak()) : std::numeric_limits<float>::quiet_NaN();
+    });
 }
 
 void Interface::destroying()
@@ -74,6 +97,7 @@ void Interface::destroying()
   online = false; // make sure interface is offline before destroying it
   m_world.statuses.removeInternal(status.value());
   m_world.interfaces->removeObject(shared_ptr<Interface>());
+  m_world.telemetry().remove(*this);
   IdObject::destroying();
 }
 
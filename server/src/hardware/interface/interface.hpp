@@ -26,6 +26,8 @@
 #include "../../core/objectproperty.hpp"
 #include "../../status/interfacestatus.hpp"
 
+class KernelBase;
+
 /**
  * @brief Base class for a hardware interface
  */
@@ -40,9 +42,16 @@ class Interface : public IdObject
 
     virtual bool setOnline(bool& value, bool simulation) = 0;
     virtual void onlineChanged(bool /*value*/) {}
+    //! \return Kernel of the interface when online, \c nullptr if none.
+    virtual KernelBase* kernel() { return nullptr; }
     void setState(InterfaceState value);
 
   public:
+    // telemetry series names:
+    static constexpr std::string_view telemetryMessagesReceived = "messages_received"; //!< [1/s]
+    static constexpr std::string_view telemetryMessagesSent = "messages_sent"; //!< [1/s]
+    static constexpr std::string_view telemetryUpdateQueueDepth = "update_queue_depth"; //!< Peak number of updates waiting for the event loop
+
     Property<std::string> name;
     Property<bool> online;
     ObjectProperty<InterfaceStatus> status;
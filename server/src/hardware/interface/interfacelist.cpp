@@ -95,7 +95,7 @@ void InterfaceList::statusPropertyChanged(BaseProperty& property)
       if(m_items[row] == obj)
       {
         for(auto& model : m_models)
-          static_cast<InterfaceListTableModel*>(model)->changed(row, InterfaceListTableModel::columnStatus);
+          model->itemChanged(row, InterfaceListTableModel::columnStatus);
         break;
       }
   }
@@ -48,34 +48,29 @@ InterfaceListTableModel::InterfaceListTableModel(InterfaceList& list) :
     });
 }
 
-std::string InterfaceListTableModel::getText(uint32_t column, uint32_t row) const
+std::string InterfaceListTableModel::getItemText(uint32_t column, const Interface& interface) const
 {
-  if(row < rowCount())
+  switch(column)
   {
-    const Interface& interface = getItem(row);
+    case columnId:
+      return interface.id;
 
-    switch(column)
-    {
-      case columnId:
-        return interface.id;
+    case columnName:
+      return interface.name;
 
-      case columnName:
-        return interface.name;
+    case columnStatus:
+      if(const auto* it = EnumValues<InterfaceState>::value.find(interface.status->state); it != EnumValues<InterfaceState>::value.end()) [[likely]]
+      {
+        return it->second;
+      }
+      break;
 
-      case columnStatus:
-        if(const auto* it = EnumValues<InterfaceState>::value.find(interface.status->state); it != EnumValues<InterfaceState>::value.end()) [[likely]]
-        {
-          return it->second;
-        }
-        break;
+    case columnClassId:
+      return std::string{interface.getClassId()};
 
-      case columnClassId:
-        return std::string{interface.getClassId()};
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
@@ -44,7 +44,7 @@ class InterfaceListTableModel : public ObjectListTableModel<Interface>
 
     InterfaceListTableModel(InterfaceList& interfaceList);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const Interface& interface) const final;
 };
 
 #endif
@@ -114,6 +114,7 @@ LocoNetInterface::LocoNetInterface(World& world, std::string_view _id)
   m_interfaceItems.insertBefore(inputs, notes);
 
   m_interfaceItems.insertBefore(outputs, notes);
+  m_interfaceItems.insertBefore(outputScheduler, notes);
 
   m_interfaceItems.insertBefore(identifications, notes);
 
@@ -292,6 +293,11 @@ bool LocoNetInterface::stopLNCVProgramming()
   return true;
 }
 
+KernelBase* LocoNetInterface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool LocoNetInterface::setOnline(bool& value, bool simulation)
 {
   if(!m_kernel && value)
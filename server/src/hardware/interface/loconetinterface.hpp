@@ -67,6 +67,7 @@ class LocoNetInterface final
 
   protected:
     bool setOnline(bool& value, bool simulation) final;
+    KernelBase* kernel() final;
 
   public:
     Property<LocoNetInterfaceType> type;
@@ -112,6 +112,7 @@ MarklinCANInterface::MarklinCANInterface(World& world, std::string_view _id)
   m_interfaceItems.insertBefore(inputs, notes);
 
   m_interfaceItems.insertBefore(outputs, notes);
+  m_interfaceItems.insertBefore(outputScheduler, notes);
 
   typeChanged();
 }
@@ -168,6 +169,11 @@ bool MarklinCANInterface::setOutputValue(OutputChannel channel, const OutputLoca
     m_kernel->setOutput(channel, static_cast<uint16_t>(address), std::get<OutputPairValue>(value));
 }
 
+KernelBase* MarklinCANInterface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool MarklinCANInterface::setOnline(bool& value, bool simulation)
 {
   if(!m_kernel && value)
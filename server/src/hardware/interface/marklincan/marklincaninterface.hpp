@@ -62,6 +62,7 @@ class MarklinCANInterface final
 
   protected:
     bool setOnline(bool& value, bool simulation) final;
+    KernelBase* kernel() final;
 
   public:
     Property<MarklinCANInterfaceType> type;
@@ -97,6 +97,7 @@ TraintasticDIYInterface::TraintasticDIYInterface(World& world, std::string_view
   m_interfaceItems.insertBefore(inputs, notes);
 
   m_interfaceItems.insertBefore(outputs, notes);
+  m_interfaceItems.insertBefore(outputScheduler, notes);
 
   updateVisible();
 }
@@ -144,6 +145,11 @@ bool TraintasticDIYInterface::setOutputValue(OutputChannel channel, const Output
       m_kernel->setOutput(static_cast<uint16_t>(address), std::get<TriState>(value) == TriState::True);
 }
 
+KernelBase* TraintasticDIYInterface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool TraintasticDIYInterface::setOnline(bool& value, bool simulation)
 {
   if(!m_kernel && value)
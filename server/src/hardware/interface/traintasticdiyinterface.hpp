@@ -59,6 +59,7 @@ class TraintasticDIYInterface final
 
   protected:
     bool setOnline(bool& value, bool simulation) final;
+    KernelBase* kernel() final;
 
   public:
     Property<TraintasticDIYInterfaceType> type;
@@ -76,6 +76,11 @@ void WiThrottleInterface::worldEvent(WorldState state, WorldEvent event)
   }
 }
 
+KernelBase* WiThrottleInterface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool WiThrottleInterface::setOnline(bool& value, bool simulation)
 {
   if(!m_kernel && value)
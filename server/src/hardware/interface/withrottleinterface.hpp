@@ -50,6 +50,7 @@ class WiThrottleInterface
     void worldEvent(WorldState state, WorldEvent event) final;
 
     bool setOnline(bool& value, bool simulation) final;
+    KernelBase* kernel() final;
 
   public:
     Property<uint16_t> port;
@@ -67,6 +67,11 @@ void WlanMausInterface::worldEvent(WorldState state, WorldEvent event)
   }
 }
 
+KernelBase* WlanMausInterface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool WlanMausInterface::setOnline(bool& value, bool simulation)
 {
   if(simulation)
@@ -47,6 +47,7 @@ class WlanMausInterface : public Interface
   protected:
     void worldEvent(WorldState state, WorldEvent event) final;
     bool setOnline(bool& value, bool simulation) final;
+    KernelBase* kernel() final;
 
   public:
     ObjectProperty<Z21::ServerSettings> z21;
@@ -153,6 +153,7 @@ XpressNetInterface::XpressNetInterface(World& world, std::string_view _id)
   m_interfaceItems.insertBefore(inputs, notes);
 
   m_interfaceItems.insertBefore(outputs, notes);
+  m_interfaceItems.insertBefore(outputScheduler, notes);
 
   updateVisible();
 }
@@ -241,6 +242,11 @@ bool XpressNetInterface::setOutputValue(OutputChannel channel, const OutputLocat
       m_kernel->setOutput(static_cast<uint16_t>(address), std::get<OutputPairValue>(value));
 }
 
+KernelBase* XpressNetInterface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool XpressNetInterface::setOnline(bool& value, bool simulation)
 {
   if(!m_kernel && value)
@@ -63,6 +63,7 @@ class XpressNetInterface final
 
   protected:
     bool setOnline(bool& value, bool simulation) final;
+    KernelBase* kernel() final;
 
   public:
     Property<XpressNetInterfaceType> type;
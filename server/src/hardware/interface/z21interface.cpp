@@ -78,6 +78,7 @@ Z21Interface::Z21Interface(World& world, std::string_view _id)
   m_interfaceItems.insertBefore(inputs, notes);
 
   m_interfaceItems.insertBefore(outputs, notes);
+  m_interfaceItems.insertBefore(outputScheduler, notes);
 
   Attributes::addCategory(hardwareType, Category::info);
   m_interfaceItems.insertBefore(hardwareType, notes);
@@ -168,6 +169,11 @@ bool Z21Interface::setOutputValue(OutputChannel channel, const OutputLocation& l
       m_kernel->setOutput(channel, static_cast<uint16_t>(address), value);
 }
 
+KernelBase* Z21Interface::kernel()
+{
+  return m_kernel.get();
+}
+
 bool Z21Interface::setOnline(bool& value, bool simulation)
 {
   if(!m_kernel && value)
@@ -58,6 +58,7 @@ class Z21Interface final
 
   protected:
     bool setOnline(bool& value, bool simulation) final;
+    KernelBase* kernel() final;
 
   public:
     Property<std::string> hostname;
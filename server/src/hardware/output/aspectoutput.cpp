@@ -36,9 +36,9 @@ AspectOutput::AspectOutput(std::shared_ptr<OutputController> outputController, O
         {
           if(hasNode)
           {
-            return interface->setOutputValue(channel, OutputNodeAddress(node, address), newValue);
+            return interface->scheduleOutputValue(channel, OutputNodeAddress(node, address), newValue);
           }
-          return interface->setOutputValue(channel, OutputAddress(address), newValue);
+          return interface->scheduleOutputValue(channel, OutputAddress(address), newValue);
         }
         return false;
       }}
@@ -34,7 +34,7 @@ ECoSStateOutput::ECoSStateOutput(std::shared_ptr<OutputController> outputControl
       [this](uint8_t newValue)
       {
         assert(interface);
-        return interface->setOutputValue(channel, OutputECoSObject(ecosObjectId), newValue);
+        return interface->scheduleOutputValue(channel, OutputECoSObject(ecosObjectId), newValue);
       }}
   , onValueChanged{*this, "on_value_changed", EventFlags::Scriptable}
 {
@@ -72,52 +72,72 @@ OutputListTableModel::OutputListTableModel(OutputList& list) :
   setColumnHeaders(std::move(labels));
 }
 
-std::string OutputListTableModel::getText(uint32_t column, uint32_t row) const
+std::string OutputListTableModel::getItemText(uint32_t column, const Output& output) const
 {
-  if(row < rowCount())
+  assert(column < m_columns.size());
+  switch(m_columns[column])
   {
-    const Output& output = getItem(row);
+    case OutputListColumn::Interface:
+      if(const auto& interface = std::dynamic_pointer_cast<Object>(output.interface.value()))
+      {
+        if(auto* property = interface->getProperty("name"); property && !property->toString().empty())
+          return property->toString();
 
-    assert(column < m_columns.size());
-    switch(m_columns[column])
-    {
-      case OutputListColumn::Interface:
-        if(const auto& interface = std::dynamic_pointer_cast<Object>(output.interface.value()))
-        {
-          if(auto* property = interface->getProperty("name"); property && !property->toString().empty())
-            return property->toString();
-
-          return interface->getObjectId();
-        }
-        return "";
-
-      case OutputListColumn::Channel:
-        if(const auto* it = EnumValues<OutputChannel>::value.find(output.channel); it != EnumValues<OutputChannel>::value.end()) /*[[likely]]*/
-        {
-          return std::string("$").append(EnumName<OutputChannel>::value).append(":").append(it->second).append("$");
-        }
-        break;
-
-      case OutputListColumn::Node:
-        if(const auto* addressOutput = dynamic_cast<const AddressOutput*>(&output); addressOutput && hasNode(addressOutput->channel))
-        {
-          return std::to_string(addressOutput->node.value());
-        }
-        return {};
-
-      case OutputListColumn::Address:
-        if(const auto* addressOutput = dynamic_cast<const AddressOutput*>(&output))
-        {
-          return std::to_string(addressOutput->address.value());
-        }
-        return {};
-    }
-    assert(false);
+        return interface->getObjectId();
+      }
+      return "";
+
+    case OutputListColumn::Channel:
+      if(const auto* it = EnumValues<OutputChannel>::value.find(output.channel); it != EnumValues<OutputChannel>::value.end()) /*[[likely]]*/
+      {
+        return std::string("$").append(EnumName<OutputChannel>::value).append(":").append(it->second).append("$");
+      }
+      break;
+
+    case OutputListColumn::Node:
+      if(const auto* addressOutput = dynamic_cast<const AddressOutput*>(&output); addressOutput && hasNode(addressOutput->channel))
+      {
+        return std::to_string(addressOutput->node.value());
+      }
+      return {};
+
+    case OutputListColumn::Address:
+      if(const auto* addressOutput = dynamic_cast<const AddressOutput*>(&output))
+      {
+        return std::to_string(addressOutput->address.value());
+      }
+      return {};
   }
+  assert(false);
 
   return "";
 }
 
+TableModel::Value OutputListTableModel::getItemValue(uint32_t column, const Output& output) const
+{
+  assert(column < m_columns.size());
+  switch(m_columns[column])
+  {
+    case OutputListColumn::Node:
+      if(const auto* addressOutput = dynamic_cast<const AddressOutput*>(&output); addressOutput && hasNode(addressOutput->channel))
+      {
+        return static_cast<int64_t>(addressOutput->node.value());
+      }
+      break;
+
+    case OutputListColumn::Address:
+      if(const auto* addressOutput = dynamic_cast<const AddressOutput*>(&output))
+      {
+        return static_cast<int64_t>(addressOutput->address.value());
+      }
+      break;
+
+    default:
+      break;
+  }
+  return getItemText(column, output);
+}
+
 void OutputListTableModel::propertyChanged(BaseProperty& property, uint32_t row)
 {
   std::string_view name = property.name();
@@ -48,7 +48,8 @@ class OutputListTableModel : public ObjectListTableModel<Output>
 
     OutputListTableModel(OutputList& list);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const Output& output) const final;
+    Value getItemValue(uint32_t column, const Output& output) const final;
 };
 
 #endif
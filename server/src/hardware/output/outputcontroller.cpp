@@ -67,8 +67,12 @@ std::shared_ptr<Output> createOutput(const std::shared_ptr<OutputController>& co
 
 OutputController::OutputController(IdObject& interface)
   : outputs{&interface, "outputs", nullptr, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::SubObject}
+  , outputScheduler{&interface, "output_scheduler", nullptr, PropertyFlags::ReadOnly | PropertyFlags::Store | PropertyFlags::SubObject}
 {
   Attributes::addDisplayName(outputs, DisplayName::Hardware::outputs);
+
+  outputScheduler.setValueInternal(std::make_shared<OutputScheduler>(interface, outputScheduler.name(), *this));
+  Attributes::addDisplayName(outputScheduler, DisplayName::Hardware::outputScheduler);
 }
 
 OutputType OutputController::outputType(OutputChannel channel) const
@@ -347,6 +351,7 @@ void OutputController::destroying()
     outputs->removeObject(output);
   }
   object.world().outputControllers->remove(std::dynamic_pointer_cast<OutputController>(object.shared_from_this()));
+  outputScheduler->destroy();
 }
 
 IdObject& OutputController::interface()
@@ -31,6 +31,7 @@
 #include <traintastic/enum/outputchannel.hpp>
 #include <traintastic/enum/outputtype.hpp>
 #include "outputtypes.hpp"
+#include "outputscheduler.hpp"
 #include "../../core/objectproperty.hpp"
 
 #ifdef interface
@@ -93,6 +94,7 @@ class OutputController
     boost::signals2::signal<void()> outputECoSObjectsChanged;
 
     ObjectProperty<OutputList> outputs;
+    ObjectProperty<OutputScheduler> outputScheduler;
 
     /**
      *
@@ -174,6 +176,16 @@ class OutputController
      */
     [[nodiscard]] virtual bool setOutputValue(OutputChannel /*channel*/, const OutputLocation& /*location*/, OutputValue /*value*/) = 0;
 
+    /**
+     * \brief Set an output value through the output scheduler
+     *
+     * \see OutputScheduler::schedule
+     */
+    bool scheduleOutputValue(OutputChannel channel, const OutputLocation& location, OutputValue value)
+    {
+      return outputScheduler->schedule(channel, location, value);
+    }
+
     /**
      * @brief Update the output value
      *
@@ -0,0 +1,296 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "outputscheduler.hpp"
+#include <algorithm>
+#include <optional>
+#include "outputcontroller.hpp"
+#include "../../core/attributes.hpp"
+#include "../../core/eventloop.hpp"
+
+struct OutputScheduler::GroupState
+{
+  size_t pending = 0; //!< commands not yet completed, including deferred commands
+  size_t pendingNormal = 0; //!< normal priority commands not yet completed
+  bool closed = false; //!< group scope has ended, no commands will be added anymore
+  std::vector<std::pair<std::weak_ptr<Object>, Command>> deferred; //!< low priority commands waiting for the normal priority commands
+  std::function<void()> onCompleted;
+
+  void checkCompleted()
+  {
+    if(closed && pending == 0 && onCompleted)
+    {
+      auto handler = std::move(onCompleted);
+      onCompleted = nullptr;
+      handler();
+    }
+  }
+};
+
+OutputScheduler::Group::Group(std::function<void()> onCompleted)
+  : m_state{std::make_shared<GroupState>()}
+  , m_parent{s_current}
+{
+  assert(isEventLoopThread());
+  m_state->onCompleted = std::move(onCompleted);
+  s_current = this;
+}
+
+OutputScheduler::Group::~Group()
+{
+  assert(s_current == this);
+  s_current = m_parent;
+  m_state->closed = true;
+  m_state->checkCompleted();
+}
+
+OutputScheduler::OutputScheduler(Object& _parent, std::string_view parentPropertyName, OutputController& controller)
+  : SubObject(_parent, parentPropertyName)
+  , m_controller{controller}
+  , m_timer{EventLoop::ioContext()}
+  , commandInterval{this, "command_interval", 0, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , maxActiveCommands{this, "max_active_commands", 0, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , activationTime{this, "activation_time", 0, PropertyFlags::ReadWrite | PropertyFlags::Store}
+{
+  Attributes::addMinMax(commandInterval, uint16_t{0}, commandIntervalMax);
+  Attributes::addUnit(commandInterval, "ms");
+  m_interfaceItems.add(commandInterval);
+
+  Attributes::addMinMax(maxActiveCommands, uint8_t{0}, maxActiveCommandsMax);
+  m_interfaceItems.add(maxActiveCommands);
+
+  Attributes::addMinMax(activationTime, uint16_t{0}, activationTimeMax);
+  Attributes::addUnit(activationTime, "ms");
+  m_interfaceItems.add(activationTime);
+}
+
+bool OutputScheduler::schedule(OutputChannel channel, const OutputLocation& location, OutputValue value)
+{
+  assert(isEventLoopThread());
+
+  Command command{channel, location, value, Priority::Normal, {}};
+
+  if(auto* group = Group::s_current)
+  {
+    command.priority = group->m_priority;
+    for(auto* it = group; it; it = it->m_parent)
+    {
+      it->m_state->pending++;
+      if(command.priority == Priority::Normal)
+      {
+        it->m_state->pendingNormal++;
+      }
+      command.groups.emplace_back(it->m_state);
+    }
+
+    if(command.priority == Priority::Low && group->m_state->pendingNormal != 0)
+    {
+      group->m_state->deferred.emplace_back(weak_from_this(), std::move(command));
+      return true;
+    }
+  }
+
+  return submit(std::move(command));
+}
+
+bool OutputScheduler::isPassThrough() const
+{
+  return commandInterval == 0 && maxActiveCommands == 0 && activationTime == 0;
+}
+
+bool OutputScheduler::submit(Command command)
+{
+  if(dying()) // deferred command of a group
+  {
+    completed(command.groups, command.priority);
+    return false;
+  }
+
+  if(isPassThrough() && queueSize() == 0 && m_active.empty())
+  {
+    const bool success = m_controller.setOutputValue(command.channel, command.location, command.value);
+    completed(command.groups, command.priority);
+    return success;
+  }
+
+  // a newer command for a queued output replaces its value:
+  auto& queue = m_queues[static_cast<size_t>(command.priority)];
+  auto it = std::find_if(queue.begin(), queue.end(),
+    [&command](const Command& queued)
+    {
+      return queued.channel == command.channel && queued.location == command.location;
+    });
+  if(it != queue.end())
+  {
+    it->value = command.value;
+    it->groups.insert(it->groups.end(), command.groups.begin(), command.groups.end());
+  }
+  else
+  {
+    queue.emplace_back(std::move(command));
+  }
+
+  process();
+  return true;
+}
+
+void OutputScheduler::process()
+{
+  if(m_processing) // completing a group can schedule its deferred commands
+  {
+    return;
+  }
+  m_processing = true;
+
+  std::optional<Clock::time_point> wakeUp;
+  for(;;)
+  {
+    const auto now = Clock::now();
+
+    if(!m_active.empty() && m_active.front().until <= now)
+    {
+      auto active = std::move(m_active.front());
+      m_active.pop_front();
+      completed(active.groups, active.priority);
+      continue;
+    }
+
+    auto queue = std::find_if(m_queues.begin(), m_queues.end(), [](const auto& q) { return !q.empty(); });
+    if(queue == m_queues.end())
+    {
+      break;
+    }
+
+    if(maxActiveCommands != 0 && m_active.size() >= static_cast<size_t>(maxActiveCommands.value()))
+    {
+      wakeUp = m_active.front().until;
+      break;
+    }
+
+    if(now < m_nextSend)
+    {
+      wakeUp = m_nextSend;
+      break;
+    }
+
+    auto command = std::move(queue->front());
+    queue->pop_front();
+
+    // a command rejected by the interface, e.g. when it is offline, is completed as well:
+    [[maybe_unused]] const bool success = m_controller.setOutputValue(command.channel, command.location, command.value);
+
+    m_nextSend = now + std::chrono::milliseconds(commandInterval.value());
+
+    if(activationTime != 0)
+    {
+      const auto until = now + std::chrono::milliseconds(activationTime.value());
+      m_active.insert(
+        std::upper_bound(m_active.begin(), m_active.end(), until,
+          [](const auto& value, const ActiveCommand& active)
+          {
+            return value < active.until;
+          }),
+        ActiveCommand{until, command.priority, std::move(command.groups)});
+    }
+    else
+    {
+      completed(command.groups, command.priority);
+    }
+  }
+
+  if(!m_active.empty() && (!wakeUp || m_active.front().until < *wakeUp))
+  {
+    wakeUp = m_active.front().until;
+  }
+
+  m_processing = false;
+
+  if(wakeUp)
+  {
+    m_timer.expires_at(*wakeUp);
+    m_timer.async_wait(
+      [this, weak=weak_from_this()](const boost::system::error_code& ec)
+      {
+        if(!ec && !weak.expired())
+        {
+          process();
+        }
+      });
+  }
+}
+
+void OutputScheduler::completed(std::vector<std::shared_ptr<GroupState>>& groups, Priority priority)
+{
+  for(auto& group : groups)
+  {
+    group->pending--;
+    if(priority == Priority::Normal)
+    {
+      group->pendingNormal--;
+    }
+  }
+
+  for(auto& group : groups)
+  {
+    if(group->pendingNormal == 0 && !group->deferred.empty())
+    {
+      auto deferred = std::move(group->deferred);
+      group->deferred.clear();
+      for(auto& [weak, command] : deferred)
+      {
+        if(auto scheduler = weak.lock())
+        {
+          static_cast<OutputScheduler&>(*scheduler).submit(std::move(command));
+        }
+        else
+        {
+          completed(command.groups, command.priority);
+        }
+      }
+    }
+    group->checkCompleted();
+  }
+}
+
+void OutputScheduler::destroying()
+{
+  m_timer.cancel();
+
+  // complete everything, so groups waiting for this interface don't wait forever:
+  auto queues = std::move(m_queues);
+  auto active = std::move(m_active);
+  m_queues = {};
+  m_active.clear();
+  for(auto& queue : queues)
+  {
+    for(auto& command : queue)
+    {
+      completed(command.groups, command.priority);
+    }
+  }
+  for(auto& command : active)
+  {
+    completed(command.groups, command.priority);
+  }
+
+  SubObject::destroying();
+}
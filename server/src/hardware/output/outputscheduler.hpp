@@ -0,0 +1,160 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef TRAINTASTIC_SERVER_HARDWARE_OUTPUT_OUTPUTSCHEDULER_HPP
+#define TRAINTASTIC_SERVER_HARDWARE_OUTPUT_OUTPUTSCHEDULER_HPP
+
+#include "../../core/subobject.hpp"
+#include <array>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <boost/asio/steady_timer.hpp>
+#include <traintastic/enum/outputchannel.hpp>
+#include "../../core/property.hpp"
+#include "outputtypes.hpp"
+
+class OutputController;
+
+/**
+ * \brief Paces output commands of an interface
+ *
+ * Setting a route fans out into many accessory commands, sending them back to back can overrun
+ * the bus and the current budget of the accessory decoders. Commands are queued and sent with a
+ * minimum interval, with a limited number of commands active at the same time.
+ * With all settings zero commands are passed directly to the interface.
+ *
+ * \note The scheduler must only be used in the event loop thread.
+ */
+class OutputScheduler final : public SubObject
+{
+  CLASS_ID("output_scheduler")
+
+  public:
+    enum class Priority : uint8_t
+    {
+      Normal = 0, //!< e.g. turnouts
+      Low = 1, //!< e.g. signals, sent after the normal priority commands of the group are completed
+    };
+
+  private:
+    struct GroupState;
+
+  public:
+    /**
+     * \brief Group of output commands, e.g. all outputs of a route
+     *
+     * All commands scheduled while the group exists are added to it, groups can be nested.
+     * The completion handler is called when all commands of the group are sent and their
+     * activation time has elapsed, i.e. the outputs are physically set.
+     */
+    class Group
+    {
+      friend class OutputScheduler;
+
+      private:
+        inline static Group* s_current = nullptr;
+
+        std::shared_ptr<GroupState> m_state;
+        Group* m_parent;
+        Priority m_priority = Priority::Normal;
+
+      public:
+        explicit Group(std::function<void()> onCompleted);
+        Group(const Group&) = delete;
+        Group& operator =(const Group&) = delete;
+        ~Group();
+
+        void setPriority(Priority value)
+        {
+          m_priority = value;
+        }
+    };
+
+    static constexpr uint16_t commandIntervalMax = 1'000; // ms
+    static constexpr uint8_t maxActiveCommandsMax = 32;
+    static constexpr uint16_t activationTimeMax = 5'000; // ms
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Command
+    {
+      OutputChannel channel;
+      OutputLocation location;
+      OutputValue value;
+      Priority priority;
+      std::vector<std::shared_ptr<GroupState>> groups;
+    };
+
+    struct ActiveCommand
+    {
+      Clock::time_point until;
+      Priority priority;
+      std::vector<std::shared_ptr<GroupState>> groups;
+    };
+
+    OutputController& m_controller;
+    std::array<std::deque<Command>, 2> m_queues; //!< queue per priority
+    std::deque<ActiveCommand> m_active; //!< sorted by activation end
+    Clock::time_point m_nextSend;
+    boost::asio::steady_timer m_timer;
+    bool m_processing = false;
+
+    bool isPassThrough() const;
+    bool submit(Command command);
+    void process();
+    static void completed(std::vector<std::shared_ptr<GroupState>>& groups, Priority priority);
+
+  protected:
+    void destroying() final;
+
+  public:
+    Property<uint16_t> commandInterval; //!< Minimum time between two commands in milliseconds, zero is no pacing.
+    Property<uint8_t> maxActiveCommands; //!< Maximum number of commands within their activation time, zero is unlimited.
+    Property<uint16_t> activationTime; //!< Time a command keeps the decoder busy in milliseconds.
+
+    OutputScheduler(Object& _parent, std::string_view parentPropertyName, OutputController& controller);
+
+    /**
+     * \brief Schedule an output command
+     *
+     * \return \c true if the command is sent or queued, \c false if the interface rejected it.
+     */
+    bool schedule(OutputChannel channel, const OutputLocation& location, OutputValue value);
+
+    //! \return Number of commands waiting to be sent.
+    size_t queueSize() const
+    {
+      return m_queues[0].size() + m_queues[1].size();
+    }
+
+    //! \return Number of commands sent which activation time hasn't elapsed yet.
+    size_t activeCount() const
+    {
+      return m_active.size();
+    }
+};
+
+#endif
@@ -35,9 +35,9 @@ PairOutput::PairOutput(std::shared_ptr<OutputController> outputController, Outpu
         {
           if(hasNode)
           {
-            return interface->setOutputValue(channel, OutputNodeAddress(node, address), newValue);
+            return interface->scheduleOutputValue(channel, OutputNodeAddress(node, address), newValue);
           }
-          return interface->setOutputValue(channel, OutputAddress(address), newValue);
+          return interface->scheduleOutputValue(channel, OutputAddress(address), newValue);
         }
         return false;
       }}
@@ -35,9 +35,9 @@ SingleOutput::SingleOutput(std::shared_ptr<OutputController> outputController, O
         {
           if(hasNode)
           {
-            return interface->setOutputValue(channel, OutputNodeAddress(node, address), toTriState(newValue));
+            return interface->scheduleOutputValue(channel, OutputNodeAddress(node, address), toTriState(newValue));
           }
-          return interface->setOutputValue(channel, OutputAddress(address), toTriState(newValue));
+          return interface->scheduleOutputValue(channel, OutputAddress(address), toTriState(newValue));
         }
         return false;
       }}
@@ -32,8 +32,8 @@
 
 namespace CAN {
 
-SocketCANIOHandler::SocketCANIOHandler(boost::asio::io_context& ioContext, const std::string& interface, std::string logId, OnReceive onReceive, OnError onError, std::span<Filter> filter)
-  : m_stream{ioContext}
+SocketCANIOHandler::SocketCANIOHandler(const boost::asio::any_io_executor& executor, const std::string& interface, std::string logId, OnReceive onReceive, OnError onError, std::span<Filter> filter)
+  : m_stream{executor}
   , m_logId{std::move(logId)}
   , m_onReceive{std::move(onReceive)}
   , m_onError{std::move(onError)}
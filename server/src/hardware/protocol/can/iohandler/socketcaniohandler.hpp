@@ -26,7 +26,7 @@
 #include <functional>
 #include <span>
 #include <linux/can.h>
-#include <boost/asio/io_context.hpp>
+#include <boost/asio/any_io_executor.hpp>
 #include <boost/asio/posix/stream_descriptor.hpp>
 
 namespace CAN {
@@ -39,7 +39,7 @@ public:
   using OnReceive = std::function<void(const Frame& frame)>;
   using OnError = std::function<void()>;
 
-  SocketCANIOHandler(boost::asio::io_context& ioContext, const std::string& interface, std::string logId, OnReceive onReceive, OnError onError, std::span<Filter> filter = {});
+  SocketCANIOHandler(const boost::asio::any_io_executor& executor, const std::string& interface, std::string logId, OnReceive onReceive, OnError onError, std::span<Filter> filter = {});
 
   void start();
   void stop();
@@ -27,8 +27,8 @@
 
 namespace CAN {
 
-IOHub::IOHub(boost::asio::io_context& ioContext, std::string logId, bool localhostOnly, uint16_t port)
-  : m_acceptor{ioContext}
+IOHub::IOHub(const boost::asio::any_io_executor& executor, std::string logId, bool localhostOnly, uint16_t port)
+  : m_acceptor{executor}
   , m_logId{logId}
   , m_localhostOnly{localhostOnly}
   , m_port{port}
@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <list>
+#include <boost/asio/any_io_executor.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
 namespace CAN {
@@ -46,7 +47,7 @@ public:
   void send(const Message& message);
 
 protected:
-  IOHub(boost::asio::io_context& ioContext, std::string logId, bool localhostOnly, uint16_t port);
+  IOHub(const boost::asio::any_io_executor& executor, std::string logId, bool localhostOnly, uint16_t port);
 
   virtual std::shared_ptr<IOHubConnection> newConnection(boost::asio::ip::tcp::socket socket) = 0;
 
@@ -71,10 +71,10 @@ namespace CBUS {
 Kernel::Kernel(std::string logId_, const Config& config, bool simulation)
   : KernelBase(std::move(logId_))
   , m_simulation{simulation}
-  , m_initializationTimer{ioContext()}
+  , m_initializationTimer{executor()}
   , m_config{config}
-  , m_engineKeepAliveTimer{ioContext()}
-  , m_dccAccessoryTimer{ioContext()}
+  , m_engineKeepAliveTimer{executor()}
+  , m_dccAccessoryTimer{executor()}
 {
   assert(isEventLoopThread());
 }
@@ -83,7 +83,7 @@ void Kernel::setConfig(const Config& config)
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, newConfig=config]()
     {
       m_config = newConfig;
@@ -106,15 +106,9 @@ void Kernel::start()
   assert(isEventLoopThread());
   assert(m_ioHandler);
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("cbus");
-      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
-      m_ioContext.run();
-    });
+  startExecutor("cbus");
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       try
@@ -133,7 +127,7 @@ void Kernel::start()
 
         if(m_config.hubEnabled)
         {
-          m_hub = std::make_shared<IOHub>(m_ioContext, logId, m_config.hubLocalhostOnly, m_config.hubPort);
+          m_hub = std::make_shared<IOHub>(m_executor, logId, m_config.hubLocalhostOnly, m_config.hubPort);
           m_hub->start(
             [this](const CAN::Message& message)
             {
@@ -159,7 +153,7 @@ void Kernel::stop()
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  stopExecutor(
     [this]()
     {
       if(m_hub)
@@ -167,11 +161,7 @@ void Kernel::stop()
         m_hub->stop();
       }
       m_ioHandler->stop();
-
-      m_ioContext.stop();
     });
-
-  m_thread.join();
 }
 
 void Kernel::started()
@@ -185,6 +175,8 @@ void Kernel::receive(const CAN::Message& canMessage)
 {
   assert(isKernelThread());
 
+  messageReceived();
+
   const auto canId = getCanId(canMessage);
   const auto& message = asMessage(canMessage);
 
@@ -547,7 +539,7 @@ size_t Kernel::registerOnReceive(OpCode opCode, std::function<void(uint8_t, cons
 
   m_onReceiveCallbacks.emplace(m_onReceiveHandle, std::move(callback));
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, handle=m_onReceiveHandle, opCode]()
     {
       m_onReceiveFilters.emplace(handle, opCode);
@@ -562,7 +554,7 @@ void Kernel::unregisterOnReceive(size_t handle)
 
   m_onReceiveCallbacks.erase(handle);
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, handle]()
     {
       m_onReceiveFilters.erase(handle);
@@ -573,7 +565,7 @@ void Kernel::trackOff()
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       if(m_trackOn)
@@ -587,7 +579,7 @@ void Kernel::trackOn()
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       if(!m_trackOn)
@@ -601,7 +593,7 @@ void Kernel::requestEmergencyStop()
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       send(RequestEmergencyStop());
@@ -612,7 +604,7 @@ void Kernel::queryEngine(uint8_t session)
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, session]()
     {
       send(QueryEngine(session));
@@ -625,7 +617,7 @@ void Kernel::setEngineSpeedDirection(uint16_t address, bool longAddress, uint8_t
 
   const uint8_t speed = eStop ? 1 : (speedStep > 0 ? speedStep + 1 : 0);
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, address, longAddress, speed, speedSteps, directionForward]()
     {
       auto& engine = m_engines[makeAddressKey(address, longAddress)];
@@ -660,7 +652,7 @@ void Kernel::setEngineFunction(uint16_t address, bool longAddress, uint8_t numbe
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, address, longAddress, number, value]()
     {
       auto& engine = m_engines[makeAddressKey(address, longAddress)];
@@ -687,7 +679,7 @@ void Kernel::setAccessoryShort(uint16_t deviceNumber, bool on)
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, deviceNumber, on]()
     {
       if(on)
@@ -705,7 +697,7 @@ void Kernel::setAccessory(uint16_t nodeNumber, uint16_t eventNumber, bool on)
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, nodeNumber, eventNumber, on]()
     {
       if(on)
@@ -723,7 +715,7 @@ void Kernel::setDccAccessory(uint16_t address, bool secondOutput)
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, address, secondOutput]()
     {
       send(RequestDCCPacket<sizeof(DCC::SetSimpleAccessory) + 1>(DCC::SetSimpleAccessory(address, secondOutput, true), Config::dccAccessoryRepeat));
@@ -743,7 +735,7 @@ void Kernel::setDccAdvancedAccessoryValue(uint16_t address, uint8_t aspect)
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, address, aspect]()
     {
       send(RequestDCCPacket<sizeof(DCC::SetAdvancedAccessoryValue) + 1>(DCC::SetAdvancedAccessoryValue(address, aspect), Config::dccExtRepeat));
@@ -759,7 +751,7 @@ bool Kernel::send(std::vector<uint8_t> message)
     return false;
   }
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, msg=std::move(message)]()
     {
       send(*reinterpret_cast<const Message*>(msg.data()));
@@ -779,7 +771,7 @@ bool Kernel::sendDCC(std::vector<uint8_t> dccPacket, uint8_t repeat)
 
   dccPacket.emplace_back(DCC::calcChecksum(dccPacket));
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, packet=std::move(dccPacket), repeat]()
     {
       switch(packet.size())
@@ -836,6 +828,10 @@ void Kernel::send(const Message& message)
   {
     (void)ec; // FIXME: handle error
   }
+  else
+  {
+    messageSent();
+  }
 
   if(m_hub)
   {
@@ -907,7 +903,7 @@ void Kernel::receiveGLOC(uint16_t address, bool longAddress, GetEngineSession::M
 void Kernel::receiveDFNOx(const SetEngineFunction& message)
 {
   assert(isKernelThread());
-  EventLoop::call(
+  postUpdate(
     [this, message]()
     {
       if(onEngineFunctionChanged) [[likely]]
@@ -920,7 +916,7 @@ void Kernel::receiveDFNOx(const SetEngineFunction& message)
 void Kernel::receiveDFUN(const CBUS::SetEngineFunctions& message)
 {
   assert(isKernelThread());
-  EventLoop::call(
+  postUpdate(
     [this, message]()
     {
       if(onEngineFunctionChanged) [[likely]]
@@ -971,7 +967,7 @@ void Kernel::receiveDFUN(const CBUS::SetEngineFunctions& message)
 void Kernel::receiveDSPD(const SetEngineSpeedDirection& message)
 {
   assert(isKernelThread());
-  EventLoop::call(
+  postUpdate(
     [this, message]()
     {
       if(onEngineSpeedDirectionChanged) [[likely]]
@@ -984,7 +980,7 @@ void Kernel::receiveDSPD(const SetEngineSpeedDirection& message)
 void Kernel::receiveKLOC(const ReleaseEngine& message)
 {
   assert(isKernelThread());
-  EventLoop::call(
+  postUpdate(
     [this, session=message.session]()
     {
       if(onEngineSessionReleased) [[likely]]
@@ -997,7 +993,7 @@ void Kernel::receiveKLOC(const ReleaseEngine& message)
 void Kernel::receiveShortEvent(uint16_t eventNumber, bool on)
 {
   assert(isKernelThread());
-  EventLoop::call(
+  postUpdate(
     [this, eventNumber, on]()
     {
       if(onShortEvent) [[likely]]
@@ -1010,7 +1006,7 @@ void Kernel::receiveShortEvent(uint16_t eventNumber, bool on)
 void Kernel::receiveLongEvent(uint16_t nodeNumber, uint16_t eventNumber, bool on)
 {
   assert(isKernelThread());
-  EventLoop::call(
+  postUpdate(
     [this, nodeNumber, eventNumber, on]()
     {
       if(onLongEvent) [[likely]]
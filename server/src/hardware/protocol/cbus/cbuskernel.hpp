@@ -72,13 +72,6 @@ public:
     return kernel;
   }
 
-#ifndef NDEBUG
-  bool isKernelThread() const
-  {
-    return std::this_thread::get_id() == m_thread.get_id();
-  }
-#endif
-
   /**
    * @brief Set CBUS configuration
    *
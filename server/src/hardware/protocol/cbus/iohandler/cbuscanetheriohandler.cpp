@@ -32,7 +32,7 @@ CANEtherIOHandler::CANEtherIOHandler(Kernel& kernel, std::string hostname, uint1
   : ASCIIIOHandler(kernel)
   , m_hostname{std::move(hostname)}
   , m_port{port}
-  , m_socket{m_kernel.ioContext()}
+  , m_socket{m_kernel.executor()}
 {
 }
 
@@ -30,7 +30,7 @@ namespace CBUS {
 
 CANUSBIOHandler::CANUSBIOHandler(Kernel& kernel, const std::string& device)
   : ASCIIIOHandler(kernel)
-  , m_serialPort{m_kernel.ioContext()}
+  , m_serialPort{m_kernel.executor()}
 {
   // FIXME: check serial settings, just a guess, if more settings are needed add them to the interface
   SerialPort::open(m_serialPort, device, 115'200, 8, SerialParity::None, SerialStopBits::One, SerialFlowControl::None);
@@ -35,7 +35,7 @@ SimulationIOHandler::SimulationIOHandler(Kernel& kernel, Simulator& simulator)
     [this](const CAN::Message& canMessage)
     {
       // post the message, so it has some delay
-      boost::asio::post(m_kernel.ioContext(),
+      boost::asio::post(m_kernel.executor(),
         [this, canMessage]()
         {
           assert(onReceive);
@@ -40,7 +40,7 @@ namespace CBUS {
 
 SocketCANIOHandler::SocketCANIOHandler(Kernel& kernel, const std::string& interface)
   : IOHandler(kernel)
-  , m_socketCAN{kernel.ioContext(), interface, m_kernel.logId,
+  , m_socketCAN{kernel.executor(), interface, m_kernel.logId,
       [this](const CAN::SocketCANIOHandler::Frame& frame)
       {
         if(frame.can_dlc >= 1) // only with minimal 1 data byte
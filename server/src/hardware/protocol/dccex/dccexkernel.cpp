@@ -41,7 +41,7 @@ namespace DCCEX {
 Kernel::Kernel(std::string logId_, const Config& config, bool simulation)
   : KernelBase(std::move(logId_))
   , m_simulation{simulation}
-  , m_startupDelayTimer{m_ioContext}
+  , m_startupDelayTimer{m_executor}
   , m_decoderController{nullptr}
   , m_inputController{nullptr}
   , m_outputController{nullptr}
@@ -51,7 +51,7 @@ Kernel::Kernel(std::string logId_, const Config& config, bool simulation)
 
 void Kernel::setConfig(const Config& config)
 {
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, newConfig=config]()
     {
       if(newConfig.speedSteps != m_config.speedSteps)
@@ -71,15 +71,9 @@ void Kernel::start()
   m_emergencyStop = TriState::Undefined;
   m_inputValues.clear();
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("dcc-ex");
-      boost::asio::executor_work_guard<decltype(m_ioContext.get_executor())> work{m_ioContext.get_executor()};
-      m_ioContext.run();
-    });
+  startExecutor("dcc-ex");
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       try
@@ -105,7 +99,7 @@ void Kernel::start()
 
 void Kernel::stop()
 {
-  boost::asio::post(m_ioContext,
+  stopExecutor(
     [this]()
     {
       m_startupDelayTimer.cancel();
@@ -113,10 +107,6 @@ void Kernel::stop()
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
-
 #ifndef NDEBUG
   m_started = false;
 #endif
@@ -132,6 +122,8 @@ void Kernel::started()
 
 void Kernel::receive(std::string_view message)
 {
+  messageReceived();
+
   if(m_config.debugLogRXTX)
     EventLoop::call(
       [this, msg=std::string(rtrim(message, '\n'))]()
@@ -158,11 +150,7 @@ void Kernel::receive(std::string_view message)
 
           if(value != TriState::Undefined)
           {
-            EventLoop::call(
-              [this, id, value]()
-              {
-                m_outputController->updateOutputValue(OutputChannel::Turnout, OutputAddress(id), value);
-              });
+            postOutputValue(*m_outputController, OutputChannel::Turnout, OutputAddress(id), value);
           }
         }
         break;
@@ -211,11 +199,7 @@ void Kernel::receive(std::string_view message)
             {
               m_inputValues[id] = value;
 
-              EventLoop::call(
-                [this, id, value]()
-                {
-                  m_inputController->updateInputValue(InputChannel::Input, InputAddress(id), toTriState(value));
-                });
+              postInputValue(*m_inputController, InputChannel::Input, InputAddress(id), toTriState(value));
             }
           }
         }
@@ -236,11 +220,7 @@ void Kernel::receive(std::string_view message)
 
           if(value != TriState::Undefined)
           {
-            EventLoop::call(
-              [this, id, value]()
-              {
-                m_outputController->updateOutputValue(OutputChannel::Output, OutputAddress(id), value);
-              });
+            postOutputValue(*m_outputController, OutputChannel::Output, OutputAddress(id), value);
           }
         }
         break;
@@ -251,7 +231,7 @@ void Kernel::receive(std::string_view message)
 
 void Kernel::powerOn()
 {
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       if(m_powerOn != TriState::True)
@@ -263,7 +243,7 @@ void Kernel::powerOn()
 
 void Kernel::powerOff()
 {
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       if(m_powerOn != TriState::False)
@@ -275,7 +255,7 @@ void Kernel::powerOff()
 
 void Kernel::emergencyStop()
 {
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       if(m_emergencyStop != TriState::True)
@@ -288,7 +268,7 @@ void Kernel::emergencyStop()
 
 void Kernel::clearEmergencyStop()
 {
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       m_emergencyStop = TriState::False;
@@ -300,7 +280,7 @@ void Kernel::decoderChanged(const Decoder& decoder, DecoderChangeFlags changes,
   if(has(changes, DecoderChangeFlags::EmergencyStop | DecoderChangeFlags::Throttle | DecoderChangeFlags::Direction))
   {
     const uint8_t speed = Decoder::throttleToSpeedStep<uint8_t>(decoder.throttle, 126);
-    boost::asio::post(m_ioContext,
+    boost::asio::post(m_executor,
       [this, address=decoder.address.value(), emergencyStop=decoder.emergencyStop.value(), speed, direction=decoder.direction.value()]()
       {
         send(Messages::setLocoSpeedAndDirection(address, speed, emergencyStop | (m_emergencyStop != TriState::False), direction));
@@ -319,17 +299,13 @@ bool Kernel::setOutput(OutputChannel channel, uint16_t address, OutputValue valu
     case OutputChannel::Accessory:
       assert(inRange<uint32_t>(address, DCC::Accessory::addressMin, DCC::Accessory::addressMax));
       assert(std::get<OutputPairValue>(value) != OutputPairValue::Undefined);
-      boost::asio::post(m_ioContext,
+      boost::asio::post(m_executor,
         [this, address, value]()
         {
           send(Messages::setAccessory(address, std::get<OutputPairValue>(value) == OutputPairValue::Second));
 
           // no response for accessory command, assume it succeeds:
-          EventLoop::call(
-            [this, address, value]()
-            {
-              m_outputController->updateOutputValue(OutputChannel::Accessory, OutputAddress(address), value);
-            });
+          postOutputValue(*m_outputController, OutputChannel::Accessory, OutputAddress(address), value);
         });
       return true;
 
@@ -337,7 +313,7 @@ bool Kernel::setOutput(OutputChannel channel, uint16_t address, OutputValue valu
       assert(inRange(address, DCC::Accessory::addressMin, DCC::Accessory::addressMax));
       if(inRange<int16_t>(std::get<int16_t>(value), std::numeric_limits<uint8_t>::min(), std::numeric_limits<uint8_t>::max())) /*[[likely]]*/
       {
-        boost::asio::post(m_ioContext,
+        boost::asio::post(m_executor,
           [this, address, data=static_cast<uint8_t>(std::get<int16_t>(value))]()
           {
             send(Messages::dccPacket(DCC::SetAdvancedAccessoryValue(address, data)));
@@ -349,7 +325,7 @@ bool Kernel::setOutput(OutputChannel channel, uint16_t address, OutputValue valu
     case OutputChannel::Turnout:
       assert(inRange<uint32_t>(address, idMin, idMax));
       assert(std::get<TriState>(value) != TriState::Undefined);
-      boost::asio::post(m_ioContext,
+      boost::asio::post(m_executor,
         [this, address, value]()
         {
           send(Messages::setTurnout(address, std::get<TriState>(value) == TriState::True));
@@ -359,7 +335,7 @@ bool Kernel::setOutput(OutputChannel channel, uint16_t address, OutputValue valu
     case OutputChannel::Output:
       assert(inRange<uint32_t>(address, idMin, idMax));
       assert(std::get<TriState>(value) != TriState::Undefined);
-      boost::asio::post(m_ioContext,
+      boost::asio::post(m_executor,
         [this, address, value]()
         {
           send(Messages::setOutput(address, std::get<TriState>(value) == TriState::True));
@@ -377,7 +353,7 @@ bool Kernel::setOutput(OutputChannel channel, uint16_t address, OutputValue valu
 void Kernel::simulateInputChange(uint16_t address, SimulateInputAction action)
 {
   if(m_simulation)
-    boost::asio::post(m_ioContext,
+    boost::asio::post(m_executor,
       [this, address, action]()
       {
         bool value;
@@ -419,6 +395,8 @@ void Kernel::send(std::string_view message)
 {
   if(m_ioHandler->send(message))
   {
+    messageSent();
+
     if(m_config.debugLogRXTX)
       EventLoop::call(
         [this, msg=std::string(rtrim(message, '\n'))]()
@@ -73,7 +73,7 @@ class Kernel : public ::KernelBase
 
     void postSend(const std::string& message)
     {
-      boost::asio::post(m_ioContext,
+      boost::asio::post(m_executor,
         [this, message]()
         {
           send(message);
@@ -88,13 +88,6 @@ class Kernel : public ::KernelBase
     Kernel(const Kernel&) = delete;
     Kernel& operator =(const Kernel&) = delete;
 
-#ifndef NDEBUG
-    bool isKernelThread() const
-    {
-      return std::this_thread::get_id() == m_thread.get_id();
-    }
-#endif
-
     /**
      * @brief Create kernel and IO handler
      *
@@ -31,7 +31,7 @@ namespace DCCEX {
 
 SerialIOHandler::SerialIOHandler(Kernel& kernel, const std::string& device, uint32_t baudrate, SerialFlowControl flowControl)
   : HardwareIOHandler(kernel)
-  , m_serialPort{m_kernel.ioContext()}
+  , m_serialPort{m_kernel.executor()}
 {
   SerialPort::open(m_serialPort, device, baudrate, 8, SerialParity::None, SerialStopBits::One, flowControl);
 }
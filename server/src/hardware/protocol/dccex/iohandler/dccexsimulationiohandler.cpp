@@ -102,7 +102,7 @@ void SimulationIOHandler::reply(std::string_view message)
 {
   // post the reply, so it has some delay
   //! \todo better delay simulation? at least DCC-EX message transfer time?
-  boost::asio::post(m_kernel.ioContext(),
+  boost::asio::post(m_kernel.executor(),
     [this, data=std::string(message)]()
     {
       m_kernel.receive(data);
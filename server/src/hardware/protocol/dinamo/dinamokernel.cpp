@@ -58,7 +58,7 @@ void Kernel::setConfig(const Config& config)
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, newConfig=config]()
     {
       if((!m_config.setHFILevel && newConfig.setHFILevel) ||
@@ -76,15 +76,9 @@ void Kernel::start()
   assert(isEventLoopThread());
   assert(m_ioHandler);
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("dinamo");
-      auto work = std::make_shared<boost::asio::io_context::work>(m_ioContext);
-      m_ioContext.run();
-    });
+  startExecutor("dinamo");
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this]()
     {
       try
@@ -108,15 +102,11 @@ void Kernel::stop()
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  stopExecutor(
     [this]()
     {
       m_ioHandler->stop();
     });
-
-  m_ioContext.stop();
-
-  m_thread.join();
 }
 
 void Kernel::started()
@@ -139,6 +129,8 @@ void Kernel::receive(std::span<const uint8_t> message, bool hold, bool fault)
 {
   assert(isKernelThread());
 
+  messageReceived();
+
   if(m_config.debugLogRXTX)
   {
     EventLoop::call(
@@ -153,7 +145,7 @@ void Kernel::receive(std::span<const uint8_t> message, bool hold, bool fault)
     m_rxFault = fault;
     if(m_rxFault && !m_txFault && onFault)
     {
-      EventLoop::call(onFault);
+      postUpdate(onFault);
     }
   }
 
@@ -175,7 +167,7 @@ void Kernel::setFault()
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this]()
     {
       if(!m_txFault)
@@ -190,7 +182,7 @@ void Kernel::resetFault()
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this]()
     {
       if(m_txFault)
@@ -205,7 +197,7 @@ void Kernel::requestBlockAlarmState(std::vector<uint8_t> blockAddresses)
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, addresses=std::move(blockAddresses)]()
     {
       for(auto address : addresses)
@@ -219,7 +211,7 @@ void Kernel::requestInputState(std::vector<uint16_t> inputAddresses)
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, addresses=std::move(inputAddresses)]()
     {
       for(auto address : addresses)
@@ -235,7 +227,7 @@ void Kernel::setOC32Aspect(uint16_t address, uint8_t aspect)
 
   if(aspect <= 0x7F) [[likely]]
   {
-    m_ioContext.post(
+    boost::asio::post(m_executor,
       [this, address, aspect]()
       {
         send(Ox32((address >> 5) & 0x1F, address & 0x1F, Ox32::Command::SetAspect, aspect));
@@ -247,7 +239,7 @@ void Kernel::setBlockAnalog(uint8_t block, bool light, std::optional<Polarity> p
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block, light, polarity]()
     {
       using enum BlockControl::Action;
@@ -257,7 +249,7 @@ void Kernel::setBlockAnalog(uint8_t block, bool light, std::optional<Polarity> p
 
 void Kernel::setBlockAnalogSpeed(uint8_t block, uint8_t speed, std::optional<Dinamo::Polarity> polarity)
 {
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block, speed, polarity]()
     {
       if(polarity)
@@ -275,7 +267,7 @@ void Kernel::setBlockAnalogLight(uint8_t block, bool on)
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block, on]()
     {
       send(BlockAnalogSetLight(block, on));
@@ -286,7 +278,7 @@ void Kernel::setBlockDCC(uint8_t block, std::optional<Polarity> polarity)
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block, polarity]()
     {
       using enum BlockControl::Action;
@@ -298,7 +290,7 @@ void Kernel::setBlockDCCSpeedAndDirection(uint8_t block, uint16_t address, bool
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block, address, longAddress, emergencyStop, speedStep, direction]()
     {
       if(longAddress)
@@ -316,7 +308,7 @@ void Kernel::setBlockDCCFunctionF0F4(uint8_t block, uint16_t address, bool longA
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block, address, longAddress, f0, f1, f2, f3, f4]()
     {
       if(longAddress)
@@ -334,7 +326,7 @@ void Kernel::setBlockDCCFunctionF5F8(uint8_t block, uint16_t address, bool longA
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block, address, longAddress, f5, f6, f7, f8]()
     {
       if(longAddress)
@@ -352,7 +344,7 @@ void Kernel::setBlockDCCFunctionF9F12(uint8_t block, uint16_t address, bool long
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block, address, longAddress, f9, f10, f11, f12]()
     {
       if(longAddress)
@@ -370,7 +362,7 @@ void Kernel::setBlockDCCFunctions(uint8_t block, uint16_t address, bool longAddr
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block, address, longAddress, functions]()
     {
       if((functions & 0x1F) != 0)
@@ -427,7 +419,7 @@ void Kernel::linkBlock(uint8_t destinationBlock, uint8_t sourceBlock, bool inver
   assert(isEventLoopThread());
   assert(destinationBlock != sourceBlock);
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, destinationBlock, sourceBlock, invertPolarity]()
     {
       using enum BlockControl::Action;
@@ -439,7 +431,7 @@ void Kernel::unlinkBlockUp(uint8_t block)
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block]()
     {
       send(BlockUnlink(block, true));
@@ -450,7 +442,7 @@ void Kernel::unlinkBlockDown(uint8_t block)
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block]()
     {
       send(BlockUnlink(block, false));
@@ -461,7 +453,7 @@ void Kernel::resetBlock(uint8_t block)
 {
   assert(isEventLoopThread());
 
-  m_ioContext.post(
+  boost::asio::post(m_executor,
     [this, block]()
     {
       using enum BlockControl::Action;
@@ -505,6 +497,10 @@ void Kernel::send(std::span<const uint8_t> message)
   {
     (void)ec; // FIXME: handle error
   }
+  else
+  {
+    messageSent();
+  }
 }
 
 void Kernel::handleSystemCommand(std::span<const uint8_t> message)
@@ -573,7 +569,7 @@ void Kernel::handleBlockAlarm(std::span<const uint8_t> message)
   assert(isKernelThread());
 
   const auto& blockAlarm = *reinterpret_cast<const BlockAlarm*>(message.data());
-  EventLoop::call(
+  postUpdate(
     [this, block=blockAlarm.block(), shortCircuit=blockAlarm.shortCircuit()]()
     {
       if(onBlockAlarm) [[likely]]
@@ -588,7 +584,7 @@ void Kernel::handleInput(std::span<const uint8_t> message)
   assert(isKernelThread());
 
   const auto& input = *reinterpret_cast<const InputMessage*>(message.data());
-  EventLoop::call(
+  postUpdate(
     [this, address=input.address(), value=input.value()]()
     {
       if(onInputChanged) [[likely]]
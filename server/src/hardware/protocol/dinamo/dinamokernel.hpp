@@ -23,6 +23,7 @@
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_DINAMO_DINAMOKERNEL_HPP
 
 #include "../kernelbase.hpp"
+#include <optional>
 #include <span>
 #include <traintastic/enum/direction.hpp>
 #include "dinamoconfig.hpp"
@@ -62,13 +63,6 @@ public:
     return kernel;
   }
 
-#ifndef NDEBUG
-  bool isKernelThread() const
-  {
-    return std::this_thread::get_id() == m_thread.get_id();
-  }
-#endif
-
   /**
    * @brief Set DINAMO configuration
    *
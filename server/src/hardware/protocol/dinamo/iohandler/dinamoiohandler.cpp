@@ -36,7 +36,7 @@ namespace Dinamo {
 
 IOHandler::IOHandler(Kernel& kernel)
   : m_kernel{kernel}
-  , m_timer{m_kernel.ioContext()}
+  , m_timer{m_kernel.executor()}
 {
 }
 
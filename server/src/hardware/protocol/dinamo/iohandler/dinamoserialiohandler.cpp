@@ -92,7 +92,7 @@ namespace Dinamo {
 
 SerialIOHandler::SerialIOHandler(Kernel& kernel, const std::string& device)
   : IOHandler(kernel)
-  , m_serialPort{m_kernel.ioContext()}
+  , m_serialPort{m_kernel.executor()}
 {
   SerialPort::open(m_serialPort, device, 19'200, 8, SerialParity::Odd, SerialStopBits::One, SerialFlowControl::None);
 }
@@ -71,7 +71,7 @@ void SimulationIOHandler::reply(std::span<const uint8_t> message, bool hold, boo
 {
   // post the reply, so it has some delay
   //! \todo better delay simulation? at least DINAMO message transfer time?
-  m_kernel.ioContext().post(
+  boost::asio::post(m_kernel.executor(),
     [this, data=std::vector<uint8_t>(message.begin(), message.end()), hold, fault]()
     {
       startIdleTimeoutTimer();
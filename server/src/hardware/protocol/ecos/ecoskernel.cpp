@@ -85,7 +85,7 @@ Kernel::Kernel(std::string logId_, const Config& config, bool simulation)
 
 void Kernel::setConfig(const Config& config)
 {
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, newConfig=config]()
     {
       m_config = newConfig;
@@ -139,15 +139,9 @@ void Kernel::start()
   assert(!m_started);
   assert(m_objects.empty());
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("ecos");
-      boost::asio::executor_work_guard<decltype(m_ioContext.get_executor())> work{m_ioContext.get_executor()};
-      m_ioContext.run();
-    });
+  startExecutor("ecos");
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       try
@@ -173,16 +167,12 @@ void Kernel::start()
 
 void Kernel::stop(Simulation* simulation)
 {
-  boost::asio::post(m_ioContext,
+  stopExecutor(
     [this]()
     {
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
-
   if(simulation && !m_objects.empty()) // get simulation data
   {
     simulation->clear();
@@ -279,6 +269,8 @@ void Kernel::started()
 
 void Kernel::receive(std::string_view message)
 {
+  messageReceived();
+
   if(m_config.debugLogRXTX)
   {
     std::string msg{rtrim(message, {'\r', '\n'})};
@@ -304,7 +296,7 @@ void Kernel::receive(std::string_view message)
 
 ECoS& Kernel::ecos()
 {
-  assert(isKernelThread() || m_ioContext.stopped());
+  assert(isKernelThread() || !isExecutorActive());
 
   return static_cast<ECoS&>(*m_objects[ObjectId::ecos]);
 }
@@ -351,19 +343,19 @@ SwitchManager& Kernel::switchManager()
 
 void Kernel::emergencyStop()
 {
-  boost::asio::post(m_ioContext, [this]() { ecos().stop(); });
+  boost::asio::post(m_executor, [this]() { ecos().stop(); });
 }
 
 void Kernel::go()
 {
-  boost::asio::post(m_ioContext, [this]() { ecos().go(); });
+  boost::asio::post(m_executor, [this]() { ecos().go(); });
 }
 
 void Kernel::decoderChanged(const Decoder& decoder, DecoderChangeFlags changes, uint32_t functionNumber)
 {
   if(has(changes, DecoderChangeFlags::Direction))
   {
-    boost::asio::post(m_ioContext,
+    boost::asio::post(m_executor,
       [this,
         protocol=decoder.protocol.value(),
         address=decoder.address.value(),
@@ -376,7 +368,7 @@ void Kernel::decoderChanged(const Decoder& decoder, DecoderChangeFlags changes,
   }
   else if(has(changes, DecoderChangeFlags::EmergencyStop | DecoderChangeFlags::Throttle))
   {
-    boost::asio::post(m_ioContext,
+    boost::asio::post(m_executor,
       [this,
         protocol=decoder.protocol.value(),
         address=decoder.address.value(),
@@ -395,7 +387,7 @@ void Kernel::decoderChanged(const Decoder& decoder, DecoderChangeFlags changes,
   }
   else if(has(changes, DecoderChangeFlags::FunctionValue) && functionNumber <= std::numeric_limits<uint8_t>::max())
   {
-    boost::asio::post(m_ioContext,
+    boost::asio::post(m_executor,
       [this,
         protocol=decoder.protocol.value(),
         address=decoder.address.value(),
@@ -419,7 +411,7 @@ bool Kernel::setOutput(OutputChannel channel, const OutputLocation& location, Ou
     case OutputChannel::AccessoryMotorola:
     {
       const auto switchProtocol = (channel == OutputChannel::AccessoryDCC) ? SwitchProtocol::DCC : SwitchProtocol::Motorola;
-      boost::asio::post(m_ioContext,
+      boost::asio::post(m_executor,
         [this, switchProtocol, address=std::get<OutputAddress>(location).address, port=(std::get<OutputPairValue>(value) == OutputPairValue::Second)]()
         {
           switchManager().setSwitch(switchProtocol, address, port);
@@ -428,7 +420,7 @@ bool Kernel::setOutput(OutputChannel channel, const OutputLocation& location, Ou
     }
     case OutputChannel::ECoSObject:
     {
-      boost::asio::post(m_ioContext,
+      boost::asio::post(m_executor,
         [this, object=std::get<OutputECoSObject>(location).object, state=std::get<uint8_t>(value)]()
         {
           if(auto it = m_objects.find(object); it != m_objects.end())
@@ -454,7 +446,7 @@ void Kernel::simulateInputChange(InputChannel channel, uint32_t address, Simulat
   if(!m_simulation)
     return;
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, channel, address, action]()
     {
       switch(channel)
@@ -534,19 +526,11 @@ void Kernel::switchManagerSwitched(SwitchProtocol protocol, uint16_t address, Ou
   switch(protocol)
   {
     case SwitchProtocol::DCC:
-      EventLoop::call(
-        [this, address, value]()
-        {
-          m_outputController->updateOutputValue(OutputChannel::AccessoryDCC, OutputAddress(address), value);
-        });
+      postOutputValue(*m_outputController, OutputChannel::AccessoryDCC, OutputAddress(address), value);
       break;
 
     case SwitchProtocol::Motorola:
-      EventLoop::call(
-        [this, address, value]()
-        {
-          m_outputController->updateOutputValue(OutputChannel::AccessoryMotorola, OutputAddress(address), value);
-        });
+      postOutputValue(*m_outputController, OutputChannel::AccessoryMotorola, OutputAddress(address), value);
       break;
 
     case SwitchProtocol::Unknown:
@@ -562,11 +546,7 @@ void Kernel::switchStateChanged(uint16_t objectId, uint8_t state)
   if(!m_outputController)
     return;
 
-  EventLoop::call(
-    [this, objectId, state]()
-    {
-      m_outputController->updateOutputValue(OutputChannel::ECoSObject, OutputECoSObject(objectId), state);
-    });
+  postOutputValue(*m_outputController, OutputChannel::ECoSObject, OutputECoSObject(objectId), state);
 }
 
 void Kernel::feedbackStateChanged(Feedback& object, uint8_t port, TriState value)
@@ -596,22 +576,14 @@ void Kernel::feedbackStateChanged(Feedback& object, uint8_t port, TriState value
       offset += feedback->ports();
     }
 
-    EventLoop::call(
-      [this, address=offset + port, value]()
-      {
-        m_inputController->updateInputValue(InputChannel::S88, InputAddress(address), value);
-      });
+    postInputValue(*m_inputController, InputChannel::S88, InputAddress(offset + port), value);
   }
   else // ECoS Detector
   {
     const uint16_t portsPerObject = 16;
     const uint16_t address = 1 + port + portsPerObject * (object.id() - ObjectId::ecosDetectorMin);
 
-    EventLoop::call(
-      [this, address, value]()
-      {
-        m_inputController->updateInputValue(InputChannel::ECoSDetector, InputAddress(address), value);
-      });
+    postInputValue(*m_inputController, InputChannel::ECoSDetector, InputAddress(address), value);
   }
 }
 
@@ -681,6 +653,8 @@ void Kernel::send(std::string_view message)
 {
   if(m_ioHandler->send(message))
   {
+    messageSent();
+
     if(m_config.debugLogRXTX)
       EventLoop::call(
         [this, msg=std::string(rtrim(message, '\n'))]()
@@ -113,7 +113,7 @@ class Kernel : public ::KernelBase
   public:// REMOVE!! just for testing
     void postSend(const std::string& message)
     {
-      boost::asio::post(m_ioContext,
+      boost::asio::post(m_executor,
         [this, message]()
         {
           send(message);
@@ -130,13 +130,6 @@ class Kernel : public ::KernelBase
     Kernel(const Kernel&) = delete;
     Kernel& operator =(const Kernel&) = delete;
 
-#ifndef NDEBUG
-    bool isKernelThread() const
-    {
-      return std::this_thread::get_id() == m_thread.get_id();
-    }
-#endif
-
     /**
      * @brief Create kernel and IO handler
      * @param[in] config LocoNet configuration
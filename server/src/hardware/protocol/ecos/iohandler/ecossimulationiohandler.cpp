@@ -318,7 +318,7 @@ bool SimulationIOHandler::send(std::string_view message)
 bool SimulationIOHandler::reply(std::string_view message)
 {
   // post the reply, so it has some delay
-  boost::asio::post(m_kernel.ioContext(),
+  boost::asio::post(m_kernel.executor(),
     [this, data=std::string(message)]()
     {
       m_kernel.receive(data);
@@ -21,14 +21,65 @@
  */
 
 #include "kernelbase.hpp"
+#include <algorithm>
+#include <future>
+#include <utility>
+#include <boost/asio/executor_work_guard.hpp>
 #include "../../core/eventloop.hpp"
+#include "../../core/iothreadpool.hpp"
+#include "../input/inputcontroller.hpp"
+#include "../output/outputcontroller.hpp"
+#include "../../utils/setthreadname.hpp"
 
 KernelBase::KernelBase(std::string logId_)
-  : m_ioContext{1}
+  : m_ioContext{IOThreadPool::isRunning() ? nullptr : std::make_unique<boost::asio::io_context>(1)}
+  , m_active{std::make_shared<std::atomic_bool>(true)}
+  , m_strand{boost::asio::make_strand(m_ioContext ? *m_ioContext : IOThreadPool::ioContext())}
+  , m_executor{m_strand, m_active}
   , logId{logId_}
 {
 }
 
+void KernelBase::startExecutor(const char* threadName)
+{
+  assert(isEventLoopThread());
+
+  if(!m_ioContext) // running in the IO thread pool
+  {
+    return;
+  }
+
+  m_thread = std::thread(
+    [this, threadName]()
+    {
+      setThreadName(threadName);
+      auto work = boost::asio::make_work_guard(*m_ioContext);
+      m_ioContext->run();
+    });
+}
+
+void KernelBase::stopExecutor(std::function<void()> lastHandler)
+{
+  assert(isEventLoopThread());
+
+  // Handlers posted to m_executor after this one are discarded, the IO thread pool keeps running.
+  std::promise<void> stopped;
+  boost::asio::post(m_strand,
+    [this, &lastHandler, &stopped]()
+    {
+      lastHandler();
+      *m_active = false;
+      stopped.set_value();
+    });
+  stopped.get_future().wait();
+
+  if(m_ioContext)
+  {
+    m_ioContext->stop();
+    m_thread.join();
+  }
+}
+
 void KernelBase::setOnStarted(std::function<void()> callback)
 {
   assert(isEventLoopThread());
@@ -80,3 +131,73 @@ void KernelBase::started()
       });
   }
 }
+
+void KernelBase::postInputValue(InputController& controller, InputChannel channel, InputLocation location, TriState value)
+{
+  queueUpdate(InputUpdate{&controller, channel, location, value});
+}
+
+void KernelBase::postOutputValue(OutputController& controller, OutputChannel channel, OutputLocation location, OutputValue value)
+{
+  queueUpdate(OutputUpdate{&controller, channel, location, value});
+}
+
+void KernelBase::postUpdate(std::function<void()> update)
+{
+  queueUpdate(std::move(update));
+}
+
+void KernelBase::queueUpdate(Update&& update)
+{
+  bool post;
+  {
+    std::lock_guard<std::mutex> lock(m_updatesMutex);
+    m_updates.emplace_back(std::move(update));
+    m_updatesPeak = std::max(m_updatesPeak, m_updates.size());
+    post = !m_updatesPosted;
+    m_updatesPosted = true;
+  }
+
+  if(post)
+  {
+    EventLoop::call(
+      [this]()
+      {
+        processUpdates();
+      });
+  }
+}
+
+size_t KernelBase::takeUpdatesPeak()
+{
+  std::lock_guard<std::mutex> lock(m_updatesMutex);
+  return std::exchange(m_updatesPeak, m_updates.size());
+}
+
+void KernelBase::processUpdates()
+{
+  assert(isEventLoopThread());
+
+  {
+    std::lock_guard<std::mutex> lock(m_updatesMutex);
+    std::swap(m_updates, m_updatesProcessing);
+    m_updatesPosted = false;
+  }
+
+  for(auto& update : m_updatesProcessing)
+  {
+    if(auto* input = std::get_if<InputUpdate>(&update))
+    {
+      input->controller->updateInputValue(input->channel, input->location, input->value);
+    }
+    else if(auto* output = std::get_if<OutputUpdate>(&update))
+    {
+      output->controller->updateOutputValue(output->channel, output->location, output->value);
+    }
+    else
+    {
+      std::get<std::function<void()>>(update)();
+    }
+  }
+  m_updatesProcessing.clear(); // keeps capacity, buffers are swapped
+}
@@ -23,20 +23,71 @@
 #ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_KERNELBASE_HPP
 #define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_KERNELBASE_HPP
 
+#include <atomic>
 #include <string>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <variant>
+#include <vector>
 #include <boost/asio/io_context.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/strand.hpp>
+#include <traintastic/enum/outputchannel.hpp>
+#include "../input/inputlocation.hpp"
+#include "../output/outputtypes.hpp"
+#include "kernelexecutor.hpp"
+
+class InputController;
+class OutputController;
 
 class KernelBase
 {
+  public:
+    using Executor = KernelExecutor<boost::asio::strand<boost::asio::io_context::executor_type>>;
+
   private:
+    struct InputUpdate
+    {
+      InputController* controller;
+      InputChannel channel;
+      InputLocation location;
+      TriState value;
+    };
+
+    struct OutputUpdate
+    {
+      OutputController* controller;
+      OutputChannel channel;
+      OutputLocation location;
+      OutputValue value;
+    };
+
+    using Update = std::variant<InputUpdate, OutputUpdate, std::function<void()>>;
+
     std::function<void()> m_onStarted;
     std::function<void()> m_onError;
 
+    std::mutex m_updatesMutex;
+    std::vector<Update> m_updates; //!< filled by the kernel thread, guarded by m_updatesMutex
+    std::vector<Update> m_updatesProcessing; //!< event loop only
+    bool m_updatesPosted = false; //!< guarded by m_updatesMutex
+    size_t m_updatesPeak = 0; //!< largest number of queued updates since takeUpdatesPeak(), guarded by m_updatesMutex
+
+    std::atomic<uint32_t> m_messagesReceived = 0;
+    std::atomic<uint32_t> m_messagesSent = 0;
+
+    void queueUpdate(Update&& update);
+    void processUpdates();
+
+    std::unique_ptr<boost::asio::io_context> m_ioContext; //!< only if the IO thread pool isn't running
+    std::thread m_thread; //!< only if the IO thread pool isn't running
+    std::shared_ptr<std::atomic_bool> m_active;
+    boost::asio::strand<boost::asio::io_context::executor_type> m_strand;
+
   protected:
-    boost::asio::io_context m_ioContext;
-    std::thread m_thread;
+    const Executor m_executor;
 
 #ifndef NDEBUG
     bool m_started = false;
@@ -46,19 +97,108 @@ class KernelBase
 
     virtual void started();
 
+    /**
+     * \brief Start running handlers posted to the kernel executor
+     *
+     * Without the IO thread pool a dedicated thread is started for the kernel.
+     *
+     * \param[in] threadName Name of the dedicated thread.
+     * \note This function must run in the event loop thread.
+     */
+    void startExecutor(const char* threadName);
+
+    /**
+     * \brief Stop the kernel executor
+     *
+     * Blocks until \p lastHandler has run in the kernel strand, all handlers queued after it
+     * are discarded. The kernel can't be started again after it is stopped.
+     *
+     * \param[in] lastHandler Last handler to run in the kernel strand, e.g. to stop the IO handler.
+     * \note This function must run in the event loop thread.
+     */
+    void stopExecutor(std::function<void()> lastHandler);
+
+    /**
+     * \brief Queue an input value update for the event loop
+     *
+     * Updates are collected in a batch, only one handler is posted to the event loop
+     * until it has processed the batch. Updates are applied in the order they are posted.
+     *
+     * \note This function must run in the kernel thread.
+     */
+    void postInputValue(InputController& controller, InputChannel channel, InputLocation location, TriState value);
+
+    /**
+     * \brief Queue an output value update for the event loop
+     * \see postInputValue
+     */
+    void postOutputValue(OutputController& controller, OutputChannel channel, OutputLocation location, OutputValue value);
+
+    /**
+     * \brief Queue a decoder or other state update for the event loop
+     * \see postInputValue
+     */
+    void postUpdate(std::function<void()> update);
+
+    //! \brief Count a message received from the hardware, must be called by the kernel thread.
+    void messageReceived()
+    {
+      m_messagesReceived.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    //! \brief Count a message sent to the hardware, must be called by the kernel thread.
+    void messageSent()
+    {
+      m_messagesSent.fetch_add(1, std::memory_order_relaxed);
+    }
+
   public:
     virtual ~KernelBase() = default;
 
     const std::string logId; //!< Object id for log messages.
 
     /**
-     * \brief IO context for LocoNet kernel and IO handler
+     * \brief Executor for the kernel and IO handler
+     *
+     * All handlers run serialized in the kernel strand, either in a dedicated kernel thread
+     * or in the shared IO thread pool.
      *
-     * \return The IO context
+     * \return The executor
+     */
+    const Executor& executor() const
+    {
+      return m_executor;
+    }
+
+    //! \return Number of messages received since the last call.
+    uint32_t takeMessagesReceived()
+    {
+      return m_messagesReceived.exchange(0, std::memory_order_relaxed);
+    }
+
+    //! \return Number of messages sent since the last call.
+    uint32_t takeMessagesSent()
+    {
+      return m_messagesSent.exchange(0, std::memory_order_relaxed);
+    }
+
+    //! \return Largest number of updates waiting for the event loop since the last call.
+    size_t takeUpdatesPeak();
+
+    /**
+     * \brief Check if the current thread is running a kernel handler
+     */
+    bool isKernelThread() const
+    {
+      return m_strand.running_in_this_thread();
+    }
+
+    /**
+     * \brief Check if the kernel executor still runs handlers
      */
-    boost::asio::io_context& ioContext()
+    bool isExecutorActive() const
     {
-      return m_ioContext;
+      return *m_active;
     }
 
     /**
@@ -0,0 +1,102 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_KERNELEXECUTOR_HPP
+#define TRAINTASTIC_SERVER_HARDWARE_PROTOCOL_KERNELEXECUTOR_HPP
+
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <boost/asio/execution.hpp>
+
+/**
+ * \brief Executor adapter that discards handlers once the kernel is stopped
+ *
+ * Wraps the kernel strand, all I/O objects of a kernel and its I/O handler use it, so their
+ * completion handlers run in the strand too. When a kernel runs on the shared IO thread pool
+ * the io_context can't be stopped per kernel, instead handlers are dropped after the kernel
+ * has stopped, like the handlers left in a stopped io_context.
+ */
+template<typename Executor>
+class KernelExecutor
+{
+  template<typename>
+  friend class KernelExecutor;
+
+  private:
+    Executor m_executor;
+    std::shared_ptr<const std::atomic_bool> m_active;
+
+  public:
+    KernelExecutor(Executor executor, std::shared_ptr<const std::atomic_bool> active)
+      : m_executor{std::move(executor)}
+      , m_active{std::move(active)}
+    {
+    }
+
+    template<typename Property>
+    auto query(const Property& property) const
+      -> decltype(boost::asio::query(std::declval<const Executor&>(), property))
+    {
+      return boost::asio::query(m_executor, property);
+    }
+
+    template<typename Property>
+    auto require(const Property& property) const
+      -> KernelExecutor<std::decay_t<decltype(boost::asio::require(std::declval<const Executor&>(), property))>>
+    {
+      return {boost::asio::require(m_executor, property), m_active};
+    }
+
+    template<typename Property>
+    auto prefer(const Property& property) const
+      -> KernelExecutor<std::decay_t<decltype(boost::asio::prefer(std::declval<const Executor&>(), property))>>
+    {
+      return {boost::asio::prefer(m_executor, property), m_active};
+    }
+
+    template<typename Function>
+    void execute(Function&& f) const
+    {
+      boost::asio::execution::execute(m_executor,
+        [active=m_active, f=std::forward<Function>(f)]() mutable
+        {
+          if(*active)
+          {
+            std::move(f)();
+          }
+        });
+    }
+
+    friend bool operator ==(const KernelExecutor& a, const KernelExecutor& b) noexcept
+    {
+      return a.m_executor == b.m_executor && a.m_active == b.m_active;
+    }
+
+    friend bool operator !=(const KernelExecutor& a, const KernelExecutor& b) noexcept
+    {
+      return !(a == b);
+    }
+};
+
+#endif
@@ -34,6 +34,10 @@ struct Config
   static constexpr uint16_t timeoutMin = 100; //!< Minimum timeout in milliseconds
   static constexpr uint16_t timeoutMax = 10000; //!< Maximum timeout in milliseconds
   static constexpr uint16_t lncvReadResponseTimeout = 100;
+  static constexpr uint16_t pcapRotateSizeMin = 0; //!< MiB, zero is disabled
+  static constexpr uint16_t pcapRotateSizeMax = 10'000; //!< MiB
+  static constexpr uint16_t pcapRotateIntervalMin = 0; //!< minutes, zero is disabled
+  static constexpr uint16_t pcapRotateIntervalMax = 24 * 60; //!< minutes
 
   uint16_t echoTimeout; //!< Wait for echo timeout in milliseconds
   uint16_t responseTimeout; //!< Wait for response timeout in milliseconds
@@ -50,6 +54,8 @@ struct Config
 
   bool pcap;
   PCAPOutput pcapOutput;
+  uint16_t pcapRotateSize; //!< PCAP file rotate size in MiB, zero is disabled
+  uint16_t pcapRotateInterval; //!< PCAP file rotate interval in minutes, zero is disabled
   bool listenOnly; //!< If enabled Traintastic will not send any message to the LocoNet, just for using Traintastic as LocoNet monitor.
 };
 
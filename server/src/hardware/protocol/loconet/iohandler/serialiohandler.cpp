@@ -31,7 +31,7 @@ namespace LocoNet {
 
 SerialIOHandler::SerialIOHandler(Kernel& kernel, const std::string& device, uint32_t baudrate, SerialFlowControl flowControl)
   : IOHandler(kernel)
-  , m_serialPort{m_kernel.ioContext()}
+  , m_serialPort{m_kernel.executor()}
   , m_readBufferOffset{0}
   , m_writeBufferOffset{0}
 {
@@ -33,7 +33,7 @@ namespace LocoNet {
 
 Z21IOHandler::Z21IOHandler(Kernel& kernel, const std::string& hostname, uint16_t port)
   : IOHandler(kernel)
-  , m_socket{m_kernel.ioContext()}
+  , m_socket{m_kernel.executor()}
   , m_sendBufferOffset{0}
 {
   boost::system::error_code ec;
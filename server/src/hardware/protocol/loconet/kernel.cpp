@@ -72,10 +72,10 @@ Kernel::Kernel(std::string logId_, const Config& config, bool simulation)
   : KernelBase(std::move(logId_))
   , m_simulation{simulation}
   , m_waitingForEcho{false}
-  , m_waitingForEchoTimer{m_ioContext}
+  , m_waitingForEchoTimer{m_executor}
   , m_waitingForResponse{false}
-  , m_waitingForResponseTimer{m_ioContext}
-  , m_fastClockSyncTimer(m_ioContext)
+  , m_waitingForResponseTimer{m_executor}
+  , m_fastClockSyncTimer(m_executor)
   , m_decoderController{nullptr}
   , m_inputController{nullptr}
   , m_outputController{nullptr}
@@ -103,20 +103,23 @@ void Kernel::setConfig(const Config& config)
       break;
   }
 
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, newConfig=config]()
     {
       if(newConfig.pcap != m_config.pcap)
       {
         if(newConfig.pcap)
-          startPCAP(newConfig.pcapOutput);
+          startPCAP(newConfig);
         else
           m_pcap.reset();
       }
-      else if(newConfig.pcap && newConfig.pcapOutput != m_config.pcapOutput)
+      else if(newConfig.pcap &&
+          (newConfig.pcapOutput != m_config.pcapOutput ||
+            newConfig.pcapRotateSize != m_config.pcapRotateSize ||
+            newConfig.pcapRotateInterval != m_config.pcapRotateInterval))
       {
         m_pcap.reset();
-        startPCAP(newConfig.pcapOutput);
+        startPCAP(newConfig);
       }
 
       if(newConfig.listenOnly && !m_config.listenOnly)
@@ -223,22 +226,16 @@ void Kernel::start()
   if(m_config.listenOnly)
     Log::log(logId, LogMessage::N2006_LISTEN_ONLY_MODE_ACTIVATED);
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("loconet");
-      boost::asio::executor_work_guard<decltype(m_ioContext.get_executor())> work{m_ioContext.get_executor()};
-      m_ioContext.run();
-    });
+  startExecutor("loconet");
 
   if(m_config.fastClock == LocoNetFastClock::Master)
     enableClockEvents();
 
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this]()
     {
       if(m_config.pcap)
-        startPCAP(m_config.pcapOutput);
+        startPCAP(m_config);
 
       try
       {
@@ -267,7 +264,7 @@ void Kernel::stop()
 
   disableClockEvents();
 
-  boost::asio::post(m_ioContext, 
+  stopExecutor(
     [this]()
     {
       m_waitingForEchoTimer.cancel();
@@ -277,10 +274,6 @@ void Kernel::stop()
       m_pcap.reset();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
-
 #ifndef NDEBUG
   m_started = false;
 #endif
@@ -307,6 +300,8 @@ void Kernel::receive(const Message& message)
   assert(isKernelThread());
   assert(isValid(message)); // only valid messages should be received
 
+  messageReceived();
+
   if(m_pcap)
     m_pcap->writeRecord(&message, message.size());
 
@@ -393,7 +388,7 @@ void Kernel::receive(const Message& message)
           {
             slot->speed = locoSpd.speed;
 
-            EventLoop::call(
+            postUpdate(
               [this, address=slot->address, speed=slot->speed]()
               {
                 if(auto decoder = getDecoder(address))
@@ -420,7 +415,7 @@ void Kernel::receive(const Message& message)
             {
               slot->direction = locoDirF.direction();
 
-              EventLoop::call(
+              postUpdate(
                 [this, address=slot->address, direction=locoDirF.direction()]()
                 {
                   if(auto decoder = getDecoder(address))
@@ -485,11 +480,7 @@ void Kernel::receive(const Message& message)
 
             m_inputValues[inputRep.fullAddress()] = value;
 
-            EventLoop::call(
-              [this, address=1 + inputRep.fullAddress(), value]()
-              {
-                m_inputController->updateInputValue(InputChannel::Input, InputAddress(address), value);
-              });
+            postInputValue(*m_inputController, InputChannel::Input, InputAddress(1 + inputRep.fullAddress()), value);
           }
         }
       }
@@ -506,11 +497,7 @@ void Kernel::receive(const Message& message)
           {
             m_outputValues[switchRequest.address() - accessoryOutputAddressMin] = value;
 
-            EventLoop::call(
-              [this, address=switchRequest.address(), value]()
-              {
-                m_outputController->updateOutputValue(OutputChannel::Accessory, OutputAddress(address), value);
-              });
+            postOutputValue(*m_outputController, OutputChannel::Accessory, OutputAddress(switchRequest.address()), value);
           }
         }
       }
@@ -548,7 +535,7 @@ void Kernel::receive(const Message& message)
 
         if(changed)
         {
-          EventLoop::call(
+          postUpdate(
             [this, address=locoSlot->address, speed=locoSlot->speed, direction=locoSlot->direction]()
             {
               if(auto decoder = getDecoder(address))
@@ -763,7 +750,7 @@ void Kernel::receive(const Message& message)
                   slot->functions[20] = toTriState(locoF12F20F28.f20());
                   slot->functions[28] = toTriState(locoF12F20F28.f28());
 
-                  EventLoop::call(
+                  postUpdate(
                     [this, address=slot->address, f12=locoF12F20F28.f12(), f20=locoF12F20F28.f20(), f28=locoF12F20F28.f28()]()
                     {
                       if(auto decoder = getDecoder(address))
@@ -944,7 +931,7 @@ void Kernel::receive(const Message& message)
 void Kernel::setState(bool powerOn, bool run)
 {
   assert(isEventLoopThread());
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, powerOn, run]()
     {
       if(!powerOn) // disable power
@@ -1038,7 +1025,7 @@ bool Kernel::send(std::span<uint8_t> packet)
   if(!isValid(*reinterpret_cast<Message*>(data.data())))
     return false;
 
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, message=std::move(data)]()
     {
       send(*reinterpret_cast<const Message*>(message.data()));
@@ -1062,7 +1049,7 @@ void Kernel::readLNCV(uint16_t moduleId, uint16_t address, uint16_t lncv, std::f
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, moduleId, address, lncv, callback]()
     {
       m_lncvReads.emplace(LNCVRead{moduleId, address, lncv, std::move(callback)});
@@ -1264,7 +1251,7 @@ bool Kernel::setOutput(OutputChannel channel, uint16_t address, OutputValue valu
       if(!inRange(address, accessoryOutputAddressMin, accessoryOutputAddressMax))
         return false;
 
-      boost::asio::post(m_ioContext, 
+      boost::asio::post(m_executor, 
         [this, address, dir=std::get<OutputPairValue>(value) == OutputPairValue::Second]()
         {
           send(SwitchRequest(address, dir, true));
@@ -1289,7 +1276,7 @@ void Kernel::simulateInputChange(uint16_t address, SimulateInputAction action)
   assert(isEventLoopThread());
   assert(inRange(address, inputAddressMin, inputAddressMax));
   if(m_simulation)
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this, fullAddress=address - 1, action]()
       {
         switch(action)
@@ -1314,7 +1301,7 @@ void Kernel::simulateInputChange(uint16_t address, SimulateInputAction action)
 void Kernel::lncvStart(uint16_t moduleId, uint16_t moduleAddress)
 {
   assert(isEventLoopThread());
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, moduleId, moduleAddress]()
     {
       if(m_lncvActive)
@@ -1330,7 +1317,7 @@ void Kernel::lncvStart(uint16_t moduleId, uint16_t moduleAddress)
 void Kernel::lncvRead(uint16_t lncv)
 {
   assert(isEventLoopThread());
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, lncv]()
     {
       if(m_lncvActive)
@@ -1341,7 +1328,7 @@ void Kernel::lncvRead(uint16_t lncv)
 void Kernel::lncvWrite(uint16_t lncv, uint16_t value)
 {
   assert(isEventLoopThread());
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, lncv, value]()
     {
       if(m_lncvActive)
@@ -1352,7 +1339,7 @@ void Kernel::lncvWrite(uint16_t lncv, uint16_t value)
 void Kernel::lncvStop()
 {
   assert(isEventLoopThread());
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this]()
     {
       if(!m_lncvActive)
@@ -1490,6 +1477,7 @@ void Kernel::sendNextMessage()
 
       if(m_ioHandler->send(message))
       {
+        messageSent();
         m_sentMessagePriority = priority;
 
         m_waitingForEcho = true;
@@ -1623,7 +1611,7 @@ void Kernel::enableClockEvents()
       m_fastClock.store(FastClock{event == Clock::ClockEvent::Freeze ? multiplierFreeze : multiplier, time.hour(), time.minute()});
       if(event == Clock::ClockEvent::Freeze || event == Clock::ClockEvent::Resume)
       {
-        boost::asio::post(m_ioContext, 
+        boost::asio::post(m_executor, 
           [this]()
           {
             setFastClockMaster(true);
@@ -1673,7 +1661,7 @@ bool Kernel::updateFunctions(LocoSlot& slot, const T& message)
     }
   }
 
-  EventLoop::call(
+  postUpdate(
     [this, address=slot.address, message]()
     {
       if(auto decoder = getDecoder(address))
@@ -1684,7 +1672,7 @@ bool Kernel::updateFunctions(LocoSlot& slot, const T& message)
   return changed;
 }
 
-void Kernel::startPCAP(PCAPOutput pcapOutput)
+void Kernel::startPCAP(const Config& config)
 {
   assert(isKernelThread());
   assert(!m_pcap);
@@ -1693,7 +1681,7 @@ void Kernel::startPCAP(PCAPOutput pcapOutput)
 
   try
   {
-    switch(pcapOutput)
+    switch(config.pcapOutput)
     {
       case PCAPOutput::File:
       {
@@ -1703,7 +1691,11 @@ void Kernel::startPCAP(PCAPOutput pcapOutput)
           {
             Log::log(logId, LogMessage::N2004_STARTING_PCAP_FILE_LOG_X, filename);
           });
-        m_pcap = std::make_unique<PCAPFile>(filename, DLT_USER0);
+        m_pcap = std::make_unique<PCAPFile>(logId, filename, DLT_USER0,
+          PCAPFile::Options{
+            .rotateSize = static_cast<uintmax_t>(config.pcapRotateSize) * 1024 * 1024,
+            .rotateInterval = std::chrono::minutes(config.pcapRotateInterval),
+          });
         break;
       }
       case PCAPOutput::Pipe:
@@ -1719,7 +1711,7 @@ void Kernel::startPCAP(PCAPOutput pcapOutput)
           {
             Log::log(logId, LogMessage::N2005_STARTING_PCAP_LOG_PIPE_X, pipe);
           });
-        m_pcap = std::make_unique<PCAPPipe>(std::move(pipe), DLT_USER0);
+        m_pcap = std::make_unique<PCAPPipe>(logId, std::move(pipe), DLT_USER0);
         break;
       }
     }
@@ -230,7 +230,7 @@ class Kernel : public ::KernelBase
     void postSend(const T& message)
     {
       assert(sizeof(message) == message.size());
-      boost::asio::post(m_ioContext, 
+      boost::asio::post(m_executor, 
         [this, message]()
         {
           send(message);
@@ -240,7 +240,7 @@ class Kernel : public ::KernelBase
     void postSend(const T& message, Priority priority)
     {
       assert(sizeof(message) == message.size());
-      boost::asio::post(m_ioContext, 
+      boost::asio::post(m_executor, 
         [this, message, priority]()
         {
           send(message, priority);
@@ -255,7 +255,7 @@ class Kernel : public ::KernelBase
     template<class T>
     void postSend(uint16_t address, const T& message)
     {
-      boost::asio::post(m_ioContext, 
+      boost::asio::post(m_executor, 
         [this, address, message]()
         {
           T msg(message);
@@ -278,7 +278,7 @@ class Kernel : public ::KernelBase
     template<uint8_t First, uint8_t Last, class T>
     bool updateFunctions(LocoSlot& slot, const T& message);
 
-    void startPCAP(PCAPOutput pcapOutput);
+    void startPCAP(const Config& config);
 
   public:
     static constexpr uint16_t inputAddressMin = 1;
@@ -290,13 +290,6 @@ class Kernel : public ::KernelBase
     Kernel& operator =(const Kernel&) = delete;
     ~Kernel();
 
-#ifndef NDEBUG
-    bool isKernelThread() const
-    {
-      return std::this_thread::get_id() == m_thread.get_id();
-    }
-#endif
-
     /**
      * @brief Create kernel and IO handler
      *
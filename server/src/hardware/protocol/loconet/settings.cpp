@@ -47,8 +47,15 @@ Settings::Settings(Object& _parent, std::string_view parentPropertyName)
       [this](bool value)
       {
         Attributes::setEnabled(pcapOutput, value);
+        updatePCAPRotateEnabled();
       }}
-  , pcapOutput{this, "pcap_output", PCAPOutput::File, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , pcapOutput{this, "pcap_output", PCAPOutput::File, PropertyFlags::ReadWrite | PropertyFlags::Store,
+      [this](PCAPOutput /*value*/)
+      {
+        updatePCAPRotateEnabled();
+      }}
+  , pcapRotateSize{this, "pcap_rotate_size", 0, PropertyFlags::ReadWrite | PropertyFlags::Store}
+  , pcapRotateInterval{this, "pcap_rotate_interval", 0, PropertyFlags::ReadWrite | PropertyFlags::Store}
   , listenOnly{this, "listen_only", false, PropertyFlags::ReadWrite | PropertyFlags::Store}
 {
   Attributes::addDisplayName(commandStation, DisplayName::Hardware::commandStation);
@@ -98,6 +105,16 @@ Settings::Settings(Object& _parent, std::string_view parentPropertyName)
   Attributes::addValues(pcapOutput, pcapOutputValues);
   m_interfaceItems.add(pcapOutput);
 
+  Attributes::addEnabled(pcapRotateSize, false);
+  Attributes::addMinMax(pcapRotateSize, Config::pcapRotateSizeMin, Config::pcapRotateSizeMax);
+  Attributes::addUnit(pcapRotateSize, "MiB");
+  m_interfaceItems.add(pcapRotateSize);
+
+  Attributes::addEnabled(pcapRotateInterval, false);
+  Attributes::addMinMax(pcapRotateInterval, Config::pcapRotateIntervalMin, Config::pcapRotateIntervalMax);
+  Attributes::addUnit(pcapRotateInterval, "min");
+  m_interfaceItems.add(pcapRotateInterval);
+
   //Attributes::addGroup(listenOnly, Group::developer);
   m_interfaceItems.add(listenOnly);
 }
@@ -120,6 +137,8 @@ Config Settings::config() const
   config.debugLogRXTX = debugLogRXTX;
   config.pcap = pcap;
   config.pcapOutput = pcapOutput;
+  config.pcapRotateSize = pcapRotateSize;
+  config.pcapRotateInterval = pcapRotateInterval;
   config.listenOnly = listenOnly;
 
   return config;
@@ -131,10 +150,18 @@ void Settings::loaded()
 
   Attributes::setEnabled(fastClockSyncInterval, fastClockSyncEnabled);
   Attributes::setEnabled(pcapOutput, pcap);
+  updatePCAPRotateEnabled();
 
   commandStationChanged(commandStation);
 }
 
+void Settings::updatePCAPRotateEnabled()
+{
+  const bool enabled = pcap && pcapOutput == PCAPOutput::File;
+  Attributes::setEnabled(pcapRotateSize, enabled);
+  Attributes::setEnabled(pcapRotateInterval, enabled);
+}
+
 void Settings::commandStationChanged(LocoNetCommandStation value)
 {
   const bool isCustom = (value == LocoNetCommandStation::Custom);
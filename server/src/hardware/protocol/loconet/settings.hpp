@@ -36,6 +36,7 @@ class Settings final : public SubObject
 
   private:
     void commandStationChanged(LocoNetCommandStation value);
+    void updatePCAPRotateEnabled();
 
   protected:
     void loaded() final;
@@ -53,6 +54,8 @@ class Settings final : public SubObject
     Property<bool> debugLogRXTX;
     Property<bool> pcap;
     Property<PCAPOutput> pcapOutput;
+    Property<uint16_t> pcapRotateSize; //!< PCAP file rotate size in MiB, zero is disabled
+    Property<uint16_t> pcapRotateInterval; //!< PCAP file rotate interval in minutes, zero is disabled
     Property<bool> listenOnly;
 
     Settings(Object& _parent, std::string_view parentPropertyName);
@@ -32,7 +32,7 @@ namespace MarklinCAN {
 
 SerialIOHandler::SerialIOHandler(Kernel& kernel, const std::string& device, uint32_t baudrate, SerialFlowControl flowControl)
   : NetworkIOHandler(kernel)
-  , m_serialPort{m_kernel.ioContext()}
+  , m_serialPort{m_kernel.executor()}
   , m_readBufferOffset{0}
 {
   SerialPort::open(m_serialPort, device, baudrate, 8, SerialParity::None, SerialStopBits::One, flowControl);
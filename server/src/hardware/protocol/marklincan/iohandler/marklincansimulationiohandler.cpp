@@ -31,9 +31,9 @@ namespace MarklinCAN {
 
 SimulationIOHandler::SimulationIOHandler(Kernel& kernel)
   : IOHandler(kernel)
-  , m_pingTimer{kernel.ioContext()}
-  , m_bootloaderCANTimer{kernel.ioContext()}
-  , m_delayedMessageTimer{kernel.ioContext()}
+  , m_pingTimer{kernel.executor()}
+  , m_bootloaderCANTimer{kernel.executor()}
+  , m_delayedMessageTimer{kernel.executor()}
 {
 }
 
@@ -291,7 +291,7 @@ bool SimulationIOHandler::send(const Message& message)
 void SimulationIOHandler::reply(const Message& message)
 {
   // post the reply, so it has some delay
-  boost::asio::post(m_kernel.ioContext(),
+  boost::asio::post(m_kernel.executor(),
     [this, message]()
     {
       m_kernel.receive(message);
@@ -27,7 +27,7 @@ namespace MarklinCAN {
 
 SocketCANIOHandler::SocketCANIOHandler(Kernel& kernel, const std::string& interface)
   : IOHandler(kernel)
-  , m_socketCAN{kernel.ioContext(), interface, m_kernel.logId,
+  , m_socketCAN{kernel.executor(), interface, m_kernel.logId,
       [this](const CAN::SocketCANIOHandler::Frame& frame)
       {
         Message message;
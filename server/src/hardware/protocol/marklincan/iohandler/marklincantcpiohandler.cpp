@@ -32,7 +32,7 @@ namespace MarklinCAN {
 TCPIOHandler::TCPIOHandler(Kernel& kernel, std::string hostname)
   : NetworkIOHandler(kernel)
   , m_hostname{std::move(hostname)}
-  , m_socket{m_kernel.ioContext()}
+  , m_socket{m_kernel.executor()}
   , m_readBufferOffset{0}
 {
 }
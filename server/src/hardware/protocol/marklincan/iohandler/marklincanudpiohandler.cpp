@@ -30,8 +30,8 @@ namespace MarklinCAN {
 
 UDPIOHandler::UDPIOHandler(Kernel& kernel, const std::string& hostname)
   : NetworkIOHandler(kernel)
-  , m_readSocket{m_kernel.ioContext()}
-  , m_writeSocket{m_kernel.ioContext()}
+  , m_readSocket{m_kernel.executor()}
+  , m_writeSocket{m_kernel.executor()}
 {
   boost::system::error_code ec;
 
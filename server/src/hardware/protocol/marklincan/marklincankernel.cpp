@@ -67,7 +67,7 @@ static std::tuple<bool, DecoderProtocol, uint16_t> uidToProtocolAddress(uint32_t
 Kernel::Kernel(std::string logId_, const Config& config, bool simulation)
   : KernelBase(std::move(logId_))
   , m_simulation{simulation}
-  , m_statusDataConfigRequestTimer{m_ioContext}
+  , m_statusDataConfigRequestTimer{m_executor}
   , m_debugDir{Traintastic::instance->debugDir()}
   , m_config{config}
 {
@@ -79,7 +79,7 @@ void Kernel::setConfig(const Config& config)
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, newConfig=config]()
     {
       if(m_config.defaultSwitchTime != newConfig.defaultSwitchTime)
@@ -135,15 +135,9 @@ void Kernel::start()
   m_outputValuesMotorola.fill(OutputPairValue::Undefined);
   m_outputValuesDCC.fill(OutputPairValue::Undefined);
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("marklin_can");
-      boost::asio::executor_work_guard<decltype(m_ioContext.get_executor())> work{m_ioContext.get_executor()};
-      m_ioContext.run();
-    });
+  startExecutor("marklin_can");
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       try
@@ -170,16 +164,12 @@ void Kernel::stop()
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext,
+  stopExecutor(
     [this]()
     {
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
-
 #ifndef NDEBUG
   m_started = false;
 #endif
@@ -210,6 +200,8 @@ void Kernel::receive(const Message& message)
 {
   assert(isKernelThread());
 
+  messageReceived();
+
   if(m_config.debugLogRXTX)
     EventLoop::call([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2002_RX_X, msg); });
 
@@ -383,11 +375,7 @@ void Kernel::receive(const Message& message)
           break;
         }
 
-        EventLoop::call(
-          [this, channel, address, value]()
-          {
-            m_outputController->updateOutputValue(channel, OutputAddress(address), value);
-          });
+        postOutputValue(*m_outputController, channel, OutputAddress(address), value);
       }
       break;
 
@@ -410,11 +398,7 @@ void Kernel::receive(const Message& message)
             {
               m_inputValues[feedbackState.contactId() - s88AddressMin] = value;
 
-              EventLoop::call(
-                [this, address=feedbackState.contactId(), value]()
-                {
-                  m_inputController->updateInputValue(InputChannel::Input, InputAddress(address), value);
-                });
+              postInputValue(*m_inputController, InputChannel::Input, InputAddress(feedbackState.contactId()), value);
             }
           }
         }
@@ -546,7 +530,7 @@ void Kernel::receive(const Message& message)
 void Kernel::systemStop()
 {
   assert(isEventLoopThread());
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       send(SystemStop());
@@ -556,7 +540,7 @@ void Kernel::systemStop()
 void Kernel::systemGo()
 {
   assert(isEventLoopThread());
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       send(SystemGo());
@@ -566,7 +550,7 @@ void Kernel::systemGo()
 void Kernel::systemHalt()
 {
   assert(isEventLoopThread());
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
         send(SystemHalt());
@@ -576,7 +560,7 @@ void Kernel::systemHalt()
 void Kernel::getLocomotiveList()
 {
   assert(isEventLoopThread());
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this]()
     {
       send(ConfigData(m_config.nodeUID, ConfigDataName::loks));
@@ -654,7 +638,7 @@ bool Kernel::setOutput(OutputChannel channel, uint16_t address, OutputPairValue
   assert(isEventLoopThread());
   assert(value == OutputPairValue::First || value == OutputPairValue::Second);
 
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, channel, address, value]()
     {
       uint32_t uid = 0;
@@ -706,11 +690,12 @@ void Kernel::send(const Message& message)
     EventLoop::call([this, msg=toString(message)](){ Log::log(logId, LogMessage::D2001_TX_X, msg); });
 
   m_ioHandler->send(message);
+  messageSent();
 }
 
 void Kernel::postSend(const Message& message)
 {
-  boost::asio::post(m_ioContext,
+  boost::asio::post(m_executor,
     [this, message]()
     {
       send(message);
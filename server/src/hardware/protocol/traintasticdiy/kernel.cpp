@@ -74,8 +74,8 @@ Kernel::Kernel(std::string logId_, World& world, const Config& config, bool simu
   : KernelBase(std::move(logId_))
   , m_world{world}
   , m_simulation{simulation}
-  , m_startupDelayTimer{m_ioContext}
-  , m_heartbeatTimeout{m_ioContext}
+  , m_startupDelayTimer{m_executor}
+  , m_heartbeatTimeout{m_executor}
   , m_inputController{nullptr}
   , m_outputController{nullptr}
   , m_config{config}
@@ -84,7 +84,7 @@ Kernel::Kernel(std::string logId_, World& world, const Config& config, bool simu
 
 void Kernel::setConfig(const Config& config)
 {
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, newConfig=config]()
     {
       m_config = newConfig;
@@ -106,15 +106,9 @@ void Kernel::start()
   m_featureFlags3 = FeatureFlags3::None;
   m_featureFlags4 = FeatureFlags4::None;
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("traintasticdiy");
-      boost::asio::executor_work_guard<decltype(m_ioContext.get_executor())> work{m_ioContext.get_executor()};
-      m_ioContext.run();
-    });
+  startExecutor("traintasticdiy");
 
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this]()
     {
       try
@@ -143,17 +137,13 @@ void Kernel::stop()
   for(auto& it : m_decoderSubscriptions)
     it.second.connection.disconnect();
 
-  boost::asio::post(m_ioContext, 
+  stopExecutor(
     [this]()
     {
       m_heartbeatTimeout.cancel();
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
-
   m_inputValues.clear();
   m_outputValues.clear();
   m_throttleSubscriptions.clear();
@@ -174,6 +164,8 @@ void Kernel::started()
 
 void Kernel::receive(const Message& message)
 {
+  messageReceived();
+
   if(m_config.debugLogRXTX && (message != Heartbeat() || m_config.debugLogHeartbeat))
     EventLoop::call(
       [this, msg=toString(message)]()
@@ -202,17 +194,17 @@ void Kernel::receive(const Message& message)
         {
           m_inputValues[address] = setInputState.state;
 
-          EventLoop::call(
-            [this, address, state=setInputState.state]()
-            {
-              if(state == InputState::Invalid)
+          if(setInputState.state == InputState::Invalid)
+          {
+            postUpdate(
+              [this, address]()
               {
                 if(m_inputController->inputMap().count({InputChannel::Input, InputAddress(address)}) != 0)
                   Log::log(logId, LogMessage::W2004_INPUT_ADDRESS_X_IS_INVALID, address);
-              }
-              else
-                m_inputController->updateInputValue(InputChannel::Input, InputAddress(address), toTriState(state));
-            });
+              });
+          }
+          else
+            postInputValue(*m_inputController, InputChannel::Input, InputAddress(address), toTriState(setInputState.state));
         }
       }
       break;
@@ -231,17 +223,17 @@ void Kernel::receive(const Message& message)
         {
           m_outputValues[address] = setOutputState.state;
 
-          EventLoop::call(
-            [this, address, state=setOutputState.state]()
-            {
-              if(state == OutputState::Invalid)
+          if(setOutputState.state == OutputState::Invalid)
+          {
+            postUpdate(
+              [this, address]()
               {
                 if(m_outputController->outputMap().count({OutputChannel::Output, OutputAddress(address)}) != 0)
                   Log::log(logId, LogMessage::W2005_OUTPUT_ADDRESS_X_IS_INVALID, address);
-              }
-              else
-                m_outputController->updateOutputValue(OutputChannel::Output, OutputAddress(address), toTriState(state));
-            });
+              });
+          }
+          else
+            postOutputValue(*m_outputController, OutputChannel::Output, OutputAddress(address), toTriState(setOutputState.state));
         }
       }
       break;
@@ -409,7 +401,7 @@ bool Kernel::setOutput(uint16_t address, bool value)
 void Kernel::simulateInputChange(uint16_t address, SimulateInputAction action)
 {
   if(m_simulation)
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this, address, action]()
       {
         TraintasticDIY::InputState state;
@@ -451,6 +443,8 @@ void Kernel::send(const Message& message)
 {
   if(m_ioHandler->send(message))
   {
+    messageSent();
+
     if(m_config.debugLogRXTX && (message != Heartbeat() || m_config.debugLogHeartbeat))
       EventLoop::call(
         [this, msg=toString(message)]()
@@ -560,7 +554,7 @@ void Kernel::throttleDecoderChanged(const Decoder& decoder, DecoderChangeFlags c
         speedMax = std::numeric_limits<uint8_t>::max();
     }
 
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this,
         key,
         direction=decoder.direction.value(),
@@ -577,7 +571,7 @@ void Kernel::throttleDecoderChanged(const Decoder& decoder, DecoderChangeFlags c
   {
     assert(functionNumber <= std::numeric_limits<uint8_t>::max());
 
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this,
         key,
         number=static_cast<uint8_t>(functionNumber),
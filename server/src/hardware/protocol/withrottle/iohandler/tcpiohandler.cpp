@@ -30,7 +30,7 @@ namespace WiThrottle {
 TCPIOHandler::TCPIOHandler(Kernel& kernel, uint16_t port)
   : IOHandler(kernel)
   , m_port{port}
-  , m_acceptor{kernel.ioContext()}
+  , m_acceptor{kernel.executor()}
 {
 }
 
@@ -124,7 +124,7 @@ void TCPIOHandler::doAccept()
   assert(isKernelThread());
 
   if(!m_socketTCP)
-    m_socketTCP = std::make_shared<boost::asio::ip::tcp::socket>(m_kernel.ioContext());
+    m_socketTCP = std::make_shared<boost::asio::ip::tcp::socket>(m_kernel.executor());
 
   m_acceptor.async_accept(*m_socketTCP,
     [this](boost::system::error_code ec)
@@ -101,7 +101,7 @@ Kernel::Kernel(std::string logId_, const Config& config)
 
 void Kernel::setConfig(const Config& config)
 {
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, newConfig=config]()
     {
       m_config = newConfig;
@@ -126,13 +126,7 @@ void Kernel::start()
 
   m_powerOn = TriState::Undefined;
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("withrottle");
-      boost::asio::executor_work_guard<decltype(m_ioContext.get_executor())> work{m_ioContext.get_executor()};
-      m_ioContext.run();
-    });
+  startExecutor("withrottle");
 
   if(m_clock)
     m_clockChangeConnection = m_clock->onChange.connect(
@@ -141,7 +135,7 @@ void Kernel::start()
         postSendToAll(fastClock((time.hour() * 60U + time.minute()) * 60U, (event == Clock::ClockEvent::Freeze) ? 0 : multiplier));
       });
 
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this]()
     {
       try
@@ -187,21 +181,18 @@ void Kernel::stop()
   }
 
   // stop iohandler and kernel thread:
-  boost::asio::post(m_ioContext, 
+  stopExecutor(
     [this]()
     {
       m_ioHandler->stop();
-      m_ioContext.stop();
     });
-
-  m_thread.join();
 }
 
 void Kernel::setPowerOn(bool on)
 {
   assert(isEventLoopThread());
 
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, on]()
     {
       if(m_powerOn != toTriState(on))
@@ -268,6 +259,8 @@ void Kernel::receiveFrom(std::string_view message, IOHandler::ClientId clientId)
   assert(isKernelThread());
   assert(m_running);
 
+  messageReceived();
+
   if(m_config.debugLogRXTX)
     EventLoop::call(
       [this, clientId, msg=std::string(message)]()
@@ -422,7 +415,7 @@ void Kernel::receiveFrom(std::string_view message, IOHandler::ClientId clientId)
   else if(message == quit())
   {
     // post disconnect to finish current callback
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this, clientId]()
       {
         m_ioHandler->disconnect(clientId);
@@ -444,6 +437,8 @@ void Kernel::sendTo(std::string_view message, IOHandler::ClientId clientId)
 
   if(m_ioHandler->sendTo(message, clientId))
   {
+    messageSent();
+
     if(m_config.debugLogRXTX)
       EventLoop::call(
         [this, clientId, msg=std::string(message)]()
@@ -459,6 +454,8 @@ void Kernel::sendToAll(std::string_view message)
 
   if(m_ioHandler->hasClients() && m_ioHandler->sendToAll(message))
   {
+    messageSent();
+
     if(m_config.debugLogRXTX)
       EventLoop::call(
         [this, msg=std::string(message)]()
@@ -78,7 +78,7 @@ class Kernel : public ::KernelBase
 
     void postSendTo(std::string message, IOHandler::ClientId clientId)
     {
-      boost::asio::post(m_ioContext, 
+      boost::asio::post(m_executor, 
         [this, msg=std::move(message), clientId]()
         {
           sendTo(msg, clientId);
@@ -87,7 +87,7 @@ class Kernel : public ::KernelBase
 
     void postSendToAll(std::string message)
     {
-      boost::asio::post(m_ioContext, 
+      boost::asio::post(m_executor, 
         [this, msg=std::move(message)]()
         {
           sendToAll(msg);
@@ -111,13 +111,6 @@ class Kernel : public ::KernelBase
     Kernel(const Kernel&) = delete;
     Kernel& operator =(const Kernel&) = delete;
 
-#ifndef NDEBUG
-    bool isKernelThread() const
-    {
-      return std::this_thread::get_id() == m_thread.get_id();
-    }
-#endif
-
     /**
      * \brief Create kernel and IO handler
      *
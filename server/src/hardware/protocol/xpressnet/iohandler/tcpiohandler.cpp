@@ -34,7 +34,7 @@ TCPIOHandler::TCPIOHandler(Kernel& kernel, std::string hostname, uint16_t port)
   : HardwareIOHandler(kernel)
   , m_hostname{std::move(hostname)}
   , m_port{port}
-  , m_socket{m_kernel.ioContext()}
+  , m_socket{m_kernel.executor()}
 {
   m_extraHeader = true;
 }
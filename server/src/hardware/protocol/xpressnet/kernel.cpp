@@ -44,7 +44,7 @@ Kernel::Kernel(std::string logId_, const Config& config, bool simulation)
 
 void Kernel::setConfig(const Config& config)
 {
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, newConfig=config]()
     {
       m_config = newConfig;
@@ -61,15 +61,9 @@ void Kernel::start()
   m_emergencyStop = TriState::Undefined;
   m_inputValues.fill(TriState::Undefined);
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("xpressnet");
-      boost::asio::executor_work_guard<decltype(m_ioContext.get_executor())> work{m_ioContext.get_executor()};
-      m_ioContext.run();
-    });
+  startExecutor("xpressnet");
 
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this]()
     {
       try
@@ -95,16 +89,12 @@ void Kernel::start()
 
 void Kernel::stop()
 {
-  boost::asio::post(m_ioContext, 
+  stopExecutor(
     [this]()
     {
       m_ioHandler->stop();
-
-      m_ioContext.stop();
     });
 
-  m_thread.join();
-
 #ifndef NDEBUG
   m_started = false;
 #endif
@@ -119,6 +109,8 @@ void Kernel::started()
 
 void Kernel::receive(const Message& message)
 {
+  messageReceived();
+
   if(m_config.debugLogRXTX)
     EventLoop::call(
       [this, msg=toString(message)]()
@@ -163,11 +155,7 @@ void Kernel::receive(const Message& message)
 
                   m_inputValues[fullAddress] = value;
 
-                  EventLoop::call(
-                    [this, address=1 + fullAddress, value]()
-                    {
-                      m_inputController->updateInputValue(InputChannel::Input, InputAddress(address), value);
-                    });
+                  postInputValue(*m_inputController, InputChannel::Input, InputAddress(1 + fullAddress), value);
                 }
               }
             }
@@ -240,7 +228,7 @@ void Kernel::resumeOperations()
 
   if(m_trackPowerOn != TriState::True || m_emergencyStop != TriState::False)
   {
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this]()
       {
         send(ResumeOperationsRequest());
@@ -254,7 +242,7 @@ void Kernel::stopOperations()
 
   if(m_trackPowerOn != TriState::False || m_emergencyStop != TriState::False)
   {
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this]()
       {
         send(StopOperationsRequest());
@@ -268,7 +256,7 @@ void Kernel::stopAllLocomotives()
 
   if(m_trackPowerOn != TriState::True || m_emergencyStop != TriState::True)
   {
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this]()
       {
         send(StopAllLocomotivesRequest());
@@ -404,7 +392,7 @@ bool Kernel::setOutput(uint16_t address, OutputPairValue value)
   assert(isEventLoopThread());
   assert(address >= accessoryOutputAddressMin && address <= accessoryOutputAddressMax);
   assert(value == OutputPairValue::First || value == OutputPairValue::Second);
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, address, value]()
     {
       send(
@@ -419,7 +407,7 @@ bool Kernel::setOutput(uint16_t address, OutputPairValue value)
 void Kernel::simulateInputChange(uint16_t address, SimulateInputAction action)
 {
   if(m_simulation)
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this, address, action]()
       {
         if((action == SimulateInputAction::SetFalse && m_inputValues[address - 1] == TriState::False) ||
@@ -477,6 +465,8 @@ void Kernel::send(const Message& message)
 {
   if(m_ioHandler->send(message))
   {
+    messageSent();
+
     if(m_config.debugLogRXTX)
       EventLoop::call(
         [this, msg=toString(message)]()
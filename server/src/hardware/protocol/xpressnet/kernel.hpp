@@ -104,7 +104,7 @@ class Kernel : public ::KernelBase
     template<class T>
     void postSend(const T& message)
     {
-      boost::asio::post(m_ioContext, 
+      boost::asio::post(m_executor, 
         [this, message]()
         {
           send(message);
@@ -117,13 +117,6 @@ class Kernel : public ::KernelBase
     Kernel(const Kernel&) = delete;
     Kernel& operator =(const Kernel&) = delete;
 
-#ifndef NDEBUG
-    bool isKernelThread() const
-    {
-      return std::this_thread::get_id() == m_thread.get_id();
-    }
-#endif
-
     /**
      * @brief Create kernel and IO handler
      *
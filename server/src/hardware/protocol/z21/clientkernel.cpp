@@ -35,16 +35,16 @@ namespace Z21 {
 ClientKernel::ClientKernel(std::string logId_, const ClientConfig& config, bool simulation)
   : Kernel(std::move(logId_))
   , m_simulation{simulation}
-  , m_keepAliveTimer(m_ioContext)
-  , m_inactiveDecoderPurgeTimer(m_ioContext)
-  , m_schedulePendingRequestTimer(m_ioContext)
+  , m_keepAliveTimer(m_executor)
+  , m_inactiveDecoderPurgeTimer(m_executor)
+  , m_schedulePendingRequestTimer(m_executor)
   , m_config{config}
 {
 }
 
 void ClientKernel::setConfig(const ClientConfig& config)
 {
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, newConfig=config]()
     {
       m_config = newConfig;
@@ -53,6 +53,8 @@ void ClientKernel::setConfig(const ClientConfig& config)
 
 void ClientKernel::receive(const Message& message)
 {
+  messageReceived();
+
   if(m_config.debugLogRXTX)
     EventLoop::call(
       [this, msg=toString(message)]()
@@ -83,11 +85,7 @@ void ClientKernel::receive(const Message& message)
               value = reply.state() ? OutputPairValue::Second : OutputPairValue::First;
             }
 
-            EventLoop::call(
-              [this, address=reply.address(), value]()
-              {
-                m_outputController->updateOutputValue(OutputChannel::Accessory, OutputAddress(address), value);
-              });
+            postOutputValue(*m_outputController, OutputChannel::Accessory, OutputAddress(reply.address()), value);
           }
           break;
 
@@ -97,11 +95,7 @@ void ClientKernel::receive(const Message& message)
             const auto& reply = static_cast<const LanXExtAccessoryInfo&>(message);
             if(reply.isDataValid())
             {
-              EventLoop::call(
-                [this, address=reply.address(), value=reply.aspect()]()
-                {
-                  m_outputController->updateOutputValue(OutputChannel::DCCext, OutputAddress(address), value);
-                });
+              postOutputValue(*m_outputController, OutputChannel::DCCext, OutputAddress(reply.address()), reply.aspect());
             }
           }
           break;
@@ -242,7 +236,7 @@ void ClientKernel::receive(const Message& message)
               break;
             }
 
-            EventLoop::call(
+            postUpdate(
               [this, address=reply.address(), isEStop=reply.isEmergencyStop(),
               speed = reply.speedStep(), speedMax=reply.speedSteps(),
               dir = reply.direction(), val, functionIndexMax, changes]()
@@ -351,11 +345,7 @@ void ClientKernel::receive(const Message& message)
           {
             m_rbusFeedbackStatus[index] = value;
 
-            EventLoop::call(
-              [this, address=rbusAddressMin + index, value]()
-              {
-                m_inputController->updateInputValue(InputChannel::RBus, InputAddress(address), value);
-              });
+            postInputValue(*m_inputController, InputChannel::RBus, InputAddress(rbusAddressMin + index), value);
           }
         }
       }
@@ -375,11 +365,7 @@ void ClientKernel::receive(const Message& message)
             {
               m_loconetFeedbackStatus[index] = value;
 
-              EventLoop::call(
-                [this, address=loconetAddressMin + index, value]()
-                {
-                  m_inputController->updateInputValue(InputChannel::LocoNet, InputAddress(address), value);
-                });
+              postInputValue(*m_inputController, InputChannel::LocoNet, InputAddress(loconetAddressMin + index), value);
             }
             break;
           }
@@ -465,7 +451,7 @@ void ClientKernel::trackPowerOn()
 
   if(m_trackPowerOn != TriState::True || m_emergencyStop != TriState::False)
   {
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this]()
       {
         send(LanXSetTrackPowerOn());
@@ -479,7 +465,7 @@ void ClientKernel::trackPowerOff()
 
   if(m_trackPowerOn != TriState::False || m_emergencyStop != TriState::False)
   {
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this]()
       {
         send(LanXSetTrackPowerOff());
@@ -493,7 +479,7 @@ void ClientKernel::emergencyStop()
 
   if(m_trackPowerOn != TriState::True || m_emergencyStop != TriState::True)
   {
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this]()
       {
         send(LanXSetStop());
@@ -527,7 +513,7 @@ void ClientKernel::decoderChanged(const Decoder& decoder, DecoderChangeFlags cha
     return;
   }
 
-  boost::asio::post(m_ioContext, [this, address, longAddress, direction, throttle, speedSteps, isEStop, changes, functionNumber, funcVal]()
+  boost::asio::post(m_executor, [this, address, longAddress, direction, throttle, speedSteps, isEStop, changes, functionNumber, funcVal]()
     {
       LanXSetLocoDrive cmd;
       cmd.setAddress(address, longAddress);
@@ -600,7 +586,7 @@ bool ClientKernel::setOutput(OutputChannel channel, uint16_t address, OutputValu
 
   if(channel == OutputChannel::Accessory)
   {
-    boost::asio::post(m_ioContext, 
+    boost::asio::post(m_executor, 
       [this, address, port=std::get<OutputPairValue>(value) == OutputPairValue::Second]()
       {
         send(LanXSetTurnout(address, port, true));
@@ -619,7 +605,7 @@ bool ClientKernel::setOutput(OutputChannel channel, uint16_t address, OutputValu
 
     if(inRange<int16_t>(std::get<int16_t>(value), std::numeric_limits<uint8_t>::min(), std::numeric_limits<uint8_t>::max())) /*[[likely]]*/
     {
-      boost::asio::post(m_ioContext, 
+      boost::asio::post(m_executor, 
         [this, address, data=static_cast<uint8_t>(std::get<int16_t>(value))]()
         {
           send(LanXSetExtAccessory(address, data));
@@ -635,7 +621,7 @@ void ClientKernel::simulateInputChange(InputChannel channel, uint32_t address, S
   if(!m_simulation)
     return;
 
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, channel, address, action]()
     {
       (void)address;
@@ -756,6 +742,8 @@ void ClientKernel::send(const Message& message, bool wantReply, uint8_t customRe
 {
   if(m_ioHandler->send(message))
   {
+    messageSent();
+
     if(m_config.debugLogRXTX)
       EventLoop::call(
         [this, msg=toString(message)]()
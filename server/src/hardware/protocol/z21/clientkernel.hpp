@@ -163,7 +163,7 @@ class ClientKernel final : public Kernel
     template<class T>
     void postSend(const T& message, bool wantReply = true, uint8_t customRetryCount = 0)
     {
-      boost::asio::post(m_ioContext, 
+      boost::asio::post(m_executor, 
         [this, message, wantReply, customRetryCount]()
         {
           send(message, wantReply, customRetryCount);
@@ -310,7 +310,7 @@ void SimulationIOHandler::reply(const Message& message)
 {
   // post the reply, so it has some delay
   //! \todo better delay simulation? at least z21 message transfer time?
-  boost::asio::post(m_kernel.ioContext(), 
+  boost::asio::post(m_kernel.executor(), 
     [this, data=copy(message)]()
     {
       static_cast<ClientKernel&>(m_kernel).receive(*reinterpret_cast<const Message*>(data.get()));
@@ -31,7 +31,7 @@ namespace Z21 {
 
 UDPIOHandler::UDPIOHandler(Kernel& kernel)
   : IOHandler(kernel)
-  , m_socket{m_kernel.ioContext()}
+  , m_socket{m_kernel.executor()}
 {
 }
 
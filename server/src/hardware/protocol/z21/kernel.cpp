@@ -43,15 +43,9 @@ void Kernel::start()
   assert(m_ioHandler);
   assert(!m_started);
 
-  m_thread = std::thread(
-    [this]()
-    {
-      setThreadName("z21");
-      boost::asio::executor_work_guard<decltype(m_ioContext.get_executor())> work{m_ioContext.get_executor()};
-      m_ioContext.run();
-    });
+  startExecutor("z21");
 
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this]()
     {
       try
@@ -81,7 +75,7 @@ void Kernel::start()
 
 void Kernel::stop()
 {
-  boost::asio::post(m_ioContext, 
+  stopExecutor(
     [this]()
     {
       onStop();
@@ -89,10 +83,6 @@ void Kernel::stop()
       m_ioHandler->stop();
     });
 
-  m_ioContext.stop();
-
-  m_thread.join();
-
 #ifndef NDEBUG
   m_started = false;
 #endif
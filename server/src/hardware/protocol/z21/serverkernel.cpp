@@ -32,7 +32,7 @@ namespace Z21 {
 
 ServerKernel::ServerKernel(std::string logId_, const ServerConfig& config, std::shared_ptr<DecoderList> decoderList)
   : Kernel(std::move(logId_))
-  , m_inactiveClientPurgeTimer{m_ioContext}
+  , m_inactiveClientPurgeTimer{m_executor}
   , m_config{config}
   , m_decoderList{std::move(decoderList)}
 {
@@ -40,7 +40,7 @@ ServerKernel::ServerKernel(std::string logId_, const ServerConfig& config, std::
 
 void ServerKernel::setConfig(const ServerConfig& config)
 {
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, newConfig=config]()
     {
       m_config = newConfig;
@@ -49,7 +49,7 @@ void ServerKernel::setConfig(const ServerConfig& config)
 
 void ServerKernel::setState(bool trackPowerOn, bool emergencyStop)
 {
-  boost::asio::post(m_ioContext, 
+  boost::asio::post(m_executor, 
     [this, trackPowerOn, emergencyStop]()
     {
       const auto trackPowerOnTri = toTriState(trackPowerOn);
@@ -77,6 +77,8 @@ void ServerKernel::setState(bool trackPowerOn, bool emergencyStop)
 
 void ServerKernel::receiveFrom(const Message& message, IOHandler::ClientId clientId)
 {
+  messageReceived();
+
   if(m_config.debugLogRXTX)
     EventLoop::call(
       [this, clientId, msg=toString(message)]()
@@ -303,6 +305,8 @@ void ServerKernel::sendTo(const Message& message, IOHandler::ClientId clientId)
 {
   if(m_ioHandler->sendTo(message, clientId))
   {
+    messageSent();
+
     if(m_config.debugLogRXTX)
       EventLoop::call(
         [this, clientId, msg=toString(message)]()
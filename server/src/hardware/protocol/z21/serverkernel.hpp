@@ -72,7 +72,7 @@ class ServerKernel final : public Kernel
     template<class T>
     void postSendTo(const T& message, IOHandler::ClientId clientId)
     {
-      boost::asio::post(m_ioContext, 
+      boost::asio::post(m_executor, 
         [this, message, clientId]()
         {
           sendTo(message, clientId);
@@ -21,46 +21,287 @@
  */
 
 #include "filelogger.hpp"
-#include <iomanip>
+#include <algorithm>
+#include <charconv>
+#include <limits>
 #include <version.hpp>
 #include "../os/localtime.hpp"
+#include "../utils/rotatefile.hpp"
+#include "../utils/setthreadname.hpp"
 
-FileLogger::FileLogger(const std::filesystem::path& filename)
+namespace {
+
+constexpr size_t stringLengthMax = std::numeric_limits<uint16_t>::max();
+
+void appendString(std::string& data, std::string_view value)
+{
+  const size_t length = std::min(value.size(), stringLengthMax);
+  data.push_back(static_cast<char>(length & 0xFF));
+  data.push_back(static_cast<char>(length >> 8));
+  data.append(value.data(), length);
+}
+
+std::string_view readString(std::string_view& data)
+{
+  const size_t length = static_cast<uint8_t>(data[0]) | (static_cast<size_t>(static_cast<uint8_t>(data[1])) << 8);
+  const std::string_view value = data.substr(2, length);
+  data.remove_prefix(2 + length);
+  return value;
+}
+
+void appendNumber(std::string& s, uint32_t value, int width)
+{
+  char buffer[16];
+  const auto r = std::to_chars(buffer, buffer + sizeof(buffer), value);
+  const auto length = static_cast<int>(r.ptr - buffer);
+  if(length < width)
+    s.append(static_cast<size_t>(width - length), '0');
+  s.append(buffer, r.ptr);
+}
+
+}
+
+std::atomic<FileLogger*> FileLogger::s_instance = nullptr;
+std::terminate_handler FileLogger::s_previousTerminateHandler = nullptr;
+
+FileLogger::FileLogger(const std::filesystem::path& filename, const Options& options)
+  : m_filename{filename}
+  , m_options{options}
 {
   // try create directory if it doesn't exist
-  const auto path = filename.parent_path();
+  const auto path = m_filename.parent_path();
   if(!std::filesystem::is_directory(path))
     std::filesystem::create_directories(path);
 
-  // open logfile and write marker
-  m_file.open(filename, std::ios::app);
-  m_file << "=== Traintastic v" TRAINTASTIC_VERSION_FULL << std::endl;
+  m_recordPool.reserve(recordPoolSize);
+
+  open();
+
+  m_thread = std::thread(&FileLogger::run, this);
+
+  // make sure queued messages are written if the application terminates:
+  if(!s_instance.exchange(this))
+    s_previousTerminateHandler = std::set_terminate(terminateHandler);
+}
+
+FileLogger::~FileLogger()
+{
+  FileLogger* self = this;
+  if(s_instance.compare_exchange_strong(self, nullptr))
+    std::set_terminate(s_previousTerminateHandler);
+
+  stop();
+
+  for(Record* record : m_recordPool)
+    delete record;
 }
 
 void FileLogger::log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message)
 {
-  write(time, objectId, message, toString(message));
+  enqueue(time, objectId, message, {});
 }
 
 void FileLogger::log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, const std::vector<std::string>& args)
 {
-  write(time, objectId, message, toString(message, args));
+  enqueue(time, objectId, message, args);
+}
+
+void FileLogger::terminateHandler()
+{
+  if(FileLogger* logger = s_instance.exchange(nullptr))
+    logger->stop();
+
+  if(s_previousTerminateHandler)
+    s_previousTerminateHandler();
+  std::abort();
+}
+
+FileLogger::Record* FileLogger::acquireRecord()
+{
+  {
+    // never wait for the writer thread, just allocate a new record if the pool is busy:
+    std::unique_lock<std::mutex> lock(m_recordPoolMutex, std::try_to_lock);
+    if(lock.owns_lock() && !m_recordPool.empty())
+    {
+      Record* record = m_recordPool.back();
+      m_recordPool.pop_back();
+      return record;
+    }
+  }
+  return new Record();
+}
+
+void FileLogger::enqueue(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage code, std::span<const std::string> args)
+{
+  Record* record = acquireRecord();
+  record->time = time;
+  record->code = code;
+  record->argc = static_cast<uint8_t>(std::min<size_t>(args.size(), std::numeric_limits<uint8_t>::max()));
+
+  size_t size = 2 + std::min(objectId.size(), stringLengthMax);
+  for(uint8_t i = 0; i < record->argc; i++)
+    size += 2 + std::min(args[i].size(), stringLengthMax);
+  record->data.clear();
+  record->data.reserve(size);
+  appendString(record->data, objectId);
+  for(uint8_t i = 0; i < record->argc; i++)
+    appendString(record->data, args[i]);
+
+  m_queue.push(record);
+
+  if(isCriticalLogMessage(code) || isFatalLogMessage(code))
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_wakeupMutex);
+      m_flush = true;
+    }
+    m_wakeup.notify_one();
+  }
+}
+
+void FileLogger::run()
+{
+  setThreadName("filelogger");
+
+  while(!m_stop.load(std::memory_order_acquire))
+  {
+    {
+      std::unique_lock<std::mutex> lock(m_wakeupMutex);
+      m_wakeup.wait_for(lock, m_options.flushInterval, [this]() { return m_flush || m_stop.load(std::memory_order_relaxed); });
+      m_flush = false;
+    }
+    writeBatch();
+  }
+
+  writeBatch(); // write remaining
+}
+
+void FileLogger::writeBatch()
+{
+  while(Record* record = m_queue.pop())
+  {
+    format(*record);
+    m_written.push_back(record);
+  }
+  recycleRecords();
+
+  if(m_buffer.empty())
+    return;
+
+  m_file.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+  m_file.flush();
+  m_fileSize += m_buffer.size();
+  m_buffer.clear();
+
+  if(m_options.rotateSize != 0 && m_fileSize >= m_options.rotateSize)
+    rotate();
+}
+
+void FileLogger::format(const Record& record)
+{
+  // only format date and time if the second changed:
+  const auto systemTime = std::chrono::system_clock::to_time_t(record.time);
+  if(systemTime != m_bufferTime)
+  {
+    const char timeFormat[] = TRAINTASTIC_LOG_DATE_FORMAT ";" TRAINTASTIC_LOG_TIME_FORMAT;
+    tm tm;
+    m_bufferTimeLength = std::strftime(m_bufferTimeText, sizeof(m_bufferTimeText), timeFormat, localTime(&systemTime, &tm));
+    m_bufferTime = systemTime;
+  }
+  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(record.time.time_since_epoch()) % 1000000;
+
+  std::string_view data{record.data};
+  const std::string_view objectId = readString(data);
+
+  m_buffer.append(m_bufferTimeText, m_bufferTimeLength);
+  m_buffer.push_back('.');
+  appendNumber(m_buffer, static_cast<uint32_t>(us.count()), 6);
+  m_buffer.push_back(';');
+  m_buffer.append(objectId);
+  m_buffer.push_back(';');
+  m_buffer.push_back(logMessageChar(record.code));
+  appendNumber(m_buffer, logMessageNumber(record.code), 4);
+  m_buffer.push_back(';');
+
+  if(record.argc == 0)
+  {
+    m_buffer.append(toString(record.code));
+  }
+  else
+  {
+    if(m_args.size() < record.argc)
+      m_args.resize(record.argc);
+    for(uint8_t i = 0; i < record.argc; i++)
+      m_args[i].assign(readString(data));
+    append(m_buffer, record.code, std::span<const std::string>(m_args.data(), record.argc));
+  }
+
+  m_buffer.push_back('\n');
+}
+
+void FileLogger::recycleRecords()
+{
+  if(m_written.empty())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(m_recordPoolMutex);
+    for(Record*& record : m_written)
+    {
+      if(m_recordPool.size() < recordPoolSize && record->data.capacity() <= recordDataCapacityMax)
+      {
+        m_recordPool.push_back(record);
+        record = nullptr;
+      }
+    }
+  }
+
+  for(Record* record : m_written)
+    delete record; // nullptr if recycled
+  m_written.clear();
+}
+
+void FileLogger::open()
+{
+  // open logfile and write marker
+  m_file.open(m_filename, std::ios::app | std::ios::binary);
+  std::error_code ec;
+  m_fileSize = std::filesystem::file_size(m_filename, ec);
+  if(ec)
+    m_fileSize = 0;
+
+  const std::string_view marker = "=== Traintastic v" TRAINTASTIC_VERSION_FULL "\n";
+  m_file.write(marker.data(), static_cast<std::streamsize>(marker.size()));
+  m_file.flush();
+  m_fileSize += marker.size();
+}
+
+void FileLogger::rotate()
+{
+  m_file.close();
+  rotateFile(m_filename, m_options.rotateCount);
+  open();
 }
 
-void FileLogger::write(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage code, std::string_view message)
+void FileLogger::stop()
 {
-  const auto systemTime = std::chrono::system_clock::to_time_t(time);
-  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(time.time_since_epoch()) % 1000000;
-  tm tm;
+  if(!m_thread.joinable())
+    return;
 
-  std::lock_guard<std::mutex> lock(m_fileMutex);
+  if(std::this_thread::get_id() == m_thread.get_id())
+  {
+    // terminating from the writer thread, write what is left:
+    m_stop = true;
+    writeBatch();
+    return;
+  }
 
-  const char time_format[] = TRAINTASTIC_LOG_DATE_FORMAT ";" TRAINTASTIC_LOG_TIME_FORMAT;
+  {
+    std::lock_guard<std::mutex> lock(m_wakeupMutex);
+    m_stop = true;
+  }
+  m_wakeup.notify_one();
+  m_thread.join();
 
-  m_file
-    << std::put_time(localTime(&systemTime, &tm), time_format) << '.' << std::setfill('0') << std::setw(6) << us.count() << ';'
-    << objectId << ';'
-    << logMessageChar(code) << std::setw(4) << logMessageNumber(code) << ';'
-    << message
-    << std::endl;
+  writeBatch(); // messages logged while the writer was stopping
 }
@@ -24,20 +24,89 @@
 #define TRAINTASTIC_SERVER_LOG_FILELOGGER_HPP
 
 #include "logger.hpp"
-#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
 #include <fstream>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
 #include <traintastic/utils/stdfilesystem.hpp>
+#include "../utils/mpscqueue.hpp"
 
+//! \brief Writes log messages to file using a dedicated writer thread.
+//!
+//! Logging only enqueues a compact record, the writer thread formats the queued records
+//! and writes them in batches every flush interval. Critical and fatal messages wake the
+//! writer immediately. When the file exceeds the rotate size it is renamed to
+//! <tt>name.1.ext</tt> (older files are shifted) and a new file is started.
 class FileLogger : public Logger
 {
+  public:
+    struct Options
+    {
+      std::chrono::milliseconds flushInterval{1000};
+      uintmax_t rotateSize = 10 * 1024 * 1024; //!< in bytes, zero disables rotation
+      uint8_t rotateCount = 5; //!< number of rotated files to keep
+    };
+
   private:
+    struct Record
+    {
+      std::atomic<Record*> next;
+      std::chrono::system_clock::time_point time;
+      LogMessage code;
+      uint8_t argc;
+      std::string data; //!< object id followed by the arguments, each prefixed by its 16 bit length
+    };
+
+    static constexpr size_t recordPoolSize = 256; //!< maximum number of records kept for reuse
+    static constexpr size_t recordDataCapacityMax = 1024; //!< records with a larger data buffer aren't reused
+
+    static std::atomic<FileLogger*> s_instance;
+    static std::terminate_handler s_previousTerminateHandler;
+
+    const std::filesystem::path m_filename;
+    const Options m_options;
     std::ofstream m_file;
-    std::mutex m_fileMutex;
+    uintmax_t m_fileSize = 0;
+    MPSCQueue<Record> m_queue;
+    std::mutex m_recordPoolMutex;
+    std::vector<Record*> m_recordPool; //!< written records, reused by enqueue() to avoid allocations
+    std::atomic_bool m_stop = false;
+    std::mutex m_wakeupMutex;
+    bool m_flush = false; //!< write now instead of waiting for the flush interval, guarded by m_wakeupMutex
+    std::condition_variable m_wakeup;
+    std::thread m_thread;
+
+    // writer thread only:
+    std::string m_buffer;
+    std::vector<std::string> m_args;
+    std::vector<Record*> m_written;
+    time_t m_bufferTime = -1;
+    char m_bufferTimeText[32];
+    size_t m_bufferTimeLength = 0;
+
+    static void terminateHandler();
 
-    void write(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage code, std::string_view message);
+    Record* acquireRecord();
+    void enqueue(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage code, std::span<const std::string> args);
+    void run();
+    void writeBatch();
+    void format(const Record& record);
+    void recycleRecords();
+    void open();
+    void rotate();
+    void stop();
 
   public:
-    FileLogger(const std::filesystem::path& filename);
+    FileLogger(const std::filesystem::path& filename, const Options& options);
+    FileLogger(const std::filesystem::path& filename)
+      : FileLogger(filename, Options())
+    {
+    }
+    ~FileLogger() final;
 
     void log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message) final;
     void log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, const std::vector<std::string>& args) final;
@@ -32,9 +32,9 @@ void Log::enableConsoleLogger()
   enable<ConsoleLogger>();
 }
 
-void Log::enableFileLogger(const std::filesystem::path& filename)
+void Log::enableFileLogger(const std::filesystem::path& filename, std::chrono::milliseconds flushInterval, uintmax_t rotateSize)
 {
-  enable<FileLogger>(filename);
+  enable<FileLogger>(filename, FileLogger::Options{.flushInterval = flushInterval, .rotateSize = rotateSize});
 }
 
 void Log::disableFileLogger()
@@ -70,7 +70,7 @@ class Log
   public:
     static void enableConsoleLogger();
 
-    static void enableFileLogger(const std::filesystem::path& filename);
+    static void enableFileLogger(const std::filesystem::path& filename, std::chrono::milliseconds flushInterval, uintmax_t rotateSize);
     static void disableFileLogger();
 
     static void enableMemoryLogger(uint32_t size);
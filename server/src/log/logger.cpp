@@ -38,27 +38,38 @@ std::string_view Logger::toString(LogMessage message)
   return Locale::tr(key);
 }
 
-std::string Logger::toString(LogMessage message, const std::vector<std::string>& args)
+std::string Logger::toString(LogMessage message, std::span<const std::string> args)
 {
-  std::string s{toString(message)};
+  std::string s;
+  append(s, message, args);
+  return s;
+}
 
-  for(size_t i = 0; i < args.size(); i++)
+void Logger::append(std::string& s, LogMessage message, std::span<const std::string> args)
+{
+  const std::string_view text = toString(message);
+
+  size_t pos = 0;
+  while(pos < text.size())
   {
-    const std::string placeholder = std::string("%").append(std::to_string(1 + i));
-    auto pos = s.find(placeholder);
-    while(pos != std::string::npos)
-    {
-      if(pos + placeholder.size() == s.size() || s[pos + placeholder.size()] < '0' || s[pos + placeholder.size()] > '9')
-      {
-        s.replace(pos, placeholder.size(), args[i]);
-        pos += args[i].size();
-      }
-      else
-        pos += placeholder.size();
+    const size_t placeholder = text.find('%', pos);
+    if(placeholder == std::string_view::npos)
+      break;
 
-      pos = s.find(placeholder, pos);
+    // parse all digits, so %1 doesn't match %10:
+    size_t end = placeholder + 1;
+    size_t n = 0;
+    while(end < text.size() && text[end] >= '0' && text[end] <= '9')
+      n = n * 10 + static_cast<size_t>(text[end++] - '0');
+
+    if(n >= 1 && n <= args.size())
+    {
+      s.append(text.substr(pos, placeholder - pos));
+      s.append(args[n - 1]);
     }
+    else
+      s.append(text.substr(pos, end - pos));
+    pos = end;
   }
-
-  return s;
+  s.append(text.substr(pos));
 }
@@ -23,6 +23,7 @@
 #define TRAINTASTIC_SERVER_LOG_LOGGER_HPP
 
 #include <vector>
+#include <span>
 #include <string>
 #include <string_view>
 #include <chrono>
@@ -42,7 +43,9 @@ class Logger
 {
   public:
     static std::string_view toString(LogMessage message);
-    static std::string toString(LogMessage message, const std::vector<std::string>& args);
+    static std::string toString(LogMessage message, std::span<const std::string> args);
+    //! \brief Append message text with its placeholders replaced by \a args to \a s.
+    static void append(std::string& s, LogMessage message, std::span<const std::string> args);
 
     virtual ~Logger() = default;
 
@@ -21,43 +21,106 @@
  */
 
 #include "memorylogger.hpp"
+#include <limits>
 #include "../core/eventloop.hpp"
 
 MemoryLogger::MemoryLogger(uint32_t sizeMax)
   : m_sizeMax{sizeMax}
 {
+  m_entries.reserve(m_sizeMax);
 }
 
 void MemoryLogger::log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message)
 {
-  add(time, std::string{objectId}, message, nullptr);
+  add(time, objectId, message, {});
 }
 
 void MemoryLogger::log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, const std::vector<std::string>& args)
 {
-  add(time, std::string{objectId}, message, new std::vector<std::string>(args));
+  add(time, objectId, message, args);
 }
 
-void MemoryLogger::add(std::chrono::system_clock::time_point time, std::string objectId, LogMessage message, std::vector<std::string>* args)
+uint32_t MemoryLogger::internObjectId(std::string_view objectId)
 {
-  if(isEventLoopThread())
+  if(auto it = m_objectIdIndex.find(objectId); it != m_objectIdIndex.end())
   {
-    m_logs.emplace_back(std::move(time), std::move(objectId), message, std::unique_ptr<std::vector<std::string>>{args});
-    changed(*this, 1, cleanUp());
+    m_objectIds[it->second].refs++;
+    return it->second;
+  }
+
+  uint32_t index;
+  if(!m_objectIdsUnused.empty()) // reuse, the string keeps its capacity
+  {
+    index = m_objectIdsUnused.back();
+    m_objectIdsUnused.pop_back();
+    m_objectIds[index].id.assign(objectId);
   }
   else
+  {
+    index = static_cast<uint32_t>(m_objectIds.size());
+    m_objectIds.emplace_back(ObjectId{std::string(objectId), 0});
+  }
+  m_objectIds[index].refs = 1;
+  m_objectIdIndex.emplace(m_objectIds[index].id, index);
+  return index;
+}
+
+void MemoryLogger::releaseObjectId(uint32_t index)
+{
+  auto& objectId = m_objectIds[index];
+  assert(objectId.refs > 0);
+  if(--objectId.refs == 0)
+  {
+    m_objectIdIndex.erase(objectId.id);
+    m_objectIdsUnused.push_back(index);
+  }
+}
+
+void MemoryLogger::add(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, std::span<const std::string> args)
+{
+  if(!isEventLoopThread())
   {
     EventLoop::call(
-      [this, time=std::move(time), objectId=std::move(objectId), message, args]()
+      [this, time, objectId=std::string(objectId), message, args=std::vector<std::string>(args.begin(), args.end())]()
       {
-        add(std::move(time), std::move(objectId), message, args);
+        add(time, objectId, message, args);
       });
+    return;
   }
-}
 
-uint32_t MemoryLogger::cleanUp()
-{
-  const uint32_t remove = (size() > m_sizeMax) ? (size() - m_sizeMax) : 0;
-  m_logs.erase(m_logs.begin(), m_logs.begin() + remove);
-  return remove;
+  if(m_sizeMax == 0) [[unlikely]]
+  {
+    return;
+  }
+
+  const uint32_t objectIdIndex = internObjectId(objectId); // before releasing the overwritten one, it's likely the same
+
+  uint32_t removed = 0;
+  Entry* entry;
+  if(m_entries.size() < m_sizeMax)
+  {
+    entry = &m_entries.emplace_back();
+  }
+  else // full, overwrite oldest:
+  {
+    entry = &m_entries[m_first];
+    m_first = (m_first + 1) % m_sizeMax;
+    releaseObjectId(entry->objectId);
+    removed = 1;
+  }
+
+  entry->time = time;
+  entry->objectId = objectIdIndex;
+  entry->message = message;
+  entry->argc = static_cast<uint8_t>(std::min<size_t>(args.size(), std::numeric_limits<uint8_t>::max()));
+  if(entry->args.size() < entry->argc)
+  {
+    entry->args.resize(entry->argc);
+  }
+  for(uint8_t i = 0; i < entry->argc; i++)
+  {
+    entry->args[i].assign(args[i]);
+  }
+
+  changed(*this, 1, removed);
 }
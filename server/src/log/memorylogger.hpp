@@ -23,46 +23,97 @@
 #define TRAINTASTIC_SERVER_LOG_MEMORYLOGGER_HPP
 
 #include "logger.hpp"
-#include <list>
-#include <functional>
+#include <cassert>
+#include <deque>
+#include <span>
+#include <unordered_map>
 #include <boost/signals2/signal.hpp>
 
+//! \brief Keeps the last \c sizeMax log messages in memory.
+//!
+//! Messages are stored in a fixed capacity ring buffer, when full the oldest message is overwritten.
+//! Object ids are interned and the argument storage of a slot is reused, so once the buffer is full
+//! logging a message doesn't allocate anymore (as long as the arguments fit in the reused strings).
+//! An interned object id is released when no slot references it anymore, so there are never more
+//! interned ids than slots.
 class MemoryLogger : public Logger
 {
   public:
+    //! \brief View of a stored log message, only valid until the next message is logged.
     struct Log
     {
       std::chrono::system_clock::time_point time;
-      std::string objectId;
+      std::string_view objectId;
       LogMessage message;
-      std::unique_ptr<std::vector<std::string>> args;
-
-      Log(std::chrono::system_clock::time_point _time, std::string _objectId, LogMessage _message, std::unique_ptr<std::vector<std::string>> _args = {})
-        : time{std::move(_time)}
-        , objectId{std::move(_objectId)}
-        , message{_message}
-        , args{std::move(_args)}
-      {
-      }
+      std::span<const std::string> args;
+    };
+
+    class const_iterator
+    {
+      private:
+        const MemoryLogger* m_logger;
+        uint32_t m_index;
+
+      public:
+        const_iterator(const MemoryLogger& logger, uint32_t index)
+          : m_logger{&logger}
+          , m_index{index}
+        {
+        }
+
+        Log operator*() const { return (*m_logger)[m_index]; }
+        const_iterator& operator++() { m_index++; return *this; }
+        bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
     };
 
   private:
-    std::vector<Log> m_logs;
-    size_t m_sizeMax;
+    struct Entry
+    {
+      std::chrono::system_clock::time_point time;
+      uint32_t objectId;
+      LogMessage message;
+      uint8_t argc;
+      std::vector<std::string> args; //!< reused when the slot is overwritten, only the first \c argc are valid
+    };
+
+    std::vector<Entry> m_entries;
+    uint32_t m_first = 0; //!< slot of the oldest message
+    const uint32_t m_sizeMax;
+    struct ObjectId
+    {
+      std::string id;
+      uint32_t refs; //!< number of slots referencing the id, zero if unused
+    };
 
-    void add(std::chrono::system_clock::time_point time, std::string objectId, LogMessage message, std::vector<std::string>* args);
-    uint32_t cleanUp();
+    std::deque<ObjectId> m_objectIds; //!< deque, so string_views in m_objectIdIndex stay valid
+    std::unordered_map<std::string_view, uint32_t> m_objectIdIndex;
+    std::vector<uint32_t> m_objectIdsUnused; //!< indexes in m_objectIds for reuse
+
+    uint32_t internObjectId(std::string_view objectId);
+    void releaseObjectId(uint32_t index);
+    void add(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, std::span<const std::string> args);
 
   public:
     boost::signals2::signal<void(const MemoryLogger&, uint32_t added, uint32_t removed)> changed;
 
     MemoryLogger(uint32_t sizeMax);
 
-    auto begin() const { return m_logs.begin(); }
-    auto end() const { return m_logs.end(); }
+    const_iterator begin() const { return {*this, 0}; }
+    const_iterator end() const { return {*this, size()}; }
+
+    //! \param[in] index Message index, zero is the oldest message.
+    inline Log operator[](uint32_t index) const
+    {
+      assert(index < size());
+      const auto& entry = m_entries[(m_first + index) % m_entries.size()];
+      return {entry.time, m_objectIds[entry.objectId].id, entry.message, std::span<const std::string>(entry.args.data(), entry.argc)};
+    }
+
+    inline uint32_t size() const { return static_cast<uint32_t>(m_entries.size()); }
 
-    inline const Log& operator[](uint32_t index) const { return m_logs[index]; }
-    inline uint32_t size() const { return static_cast<uint32_t>(m_logs.size()); }
+    //! \brief Number of interned object ids referenced by the stored messages.
+    inline size_t objectIdCount() const { return m_objectIdIndex.size(); }
 
     void log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message) final;
     void log(const std::chrono::system_clock::time_point& time, std::string_view objectId, LogMessage message, const std::vector<std::string>& args) final;
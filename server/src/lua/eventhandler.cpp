@@ -149,6 +149,7 @@ EventHandler::EventHandler(AbstractEvent& evt, lua_State* L, int functionIndex)
   , m_L{L}
   , m_function{LUA_NOREF}
   , m_userData{LUA_NOREF}
+  , m_name{evt.object().getObjectId().append(".").append(evt.name())}
 {
   luaL_checktype(L, functionIndex, LUA_TFUNCTION);
 
@@ -229,13 +230,13 @@ void EventHandler::execute(const Arguments& args)
 
   lua_rawgeti(m_L, LUA_REGISTRYINDEX, m_userData);
 
-  if(Sandbox::pcall(m_L, args.size() + 1, 0, 0) != LUA_OK)
+  if(Sandbox::pcall(m_L, args.size() + 1, 0, 0, m_name) != LUA_OK)
   {
     Log::log(
       Sandbox::getStateData(m_L).script().id,
       LogMessage::E9001_X_DURING_EXECUTION_OF_X_EVENT_HANDLER,
       to<std::string_view>(m_L, -1),
-      m_event.object().getObjectId().append(".").append(m_event.name()));
+      m_name);
   }
 }
 
@@ -57,6 +57,7 @@ private:
   int m_function;
   int m_userData;
   bool m_paused = false;
+  const std::string m_name; //!< e.g. train_1.on_block_assigned, for profiling and logging, object id at connect time
 
   void release();
 };
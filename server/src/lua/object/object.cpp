@@ -39,8 +39,125 @@
 
 namespace Lua::Object {
 
+namespace {
+
+/**
+ * Dispatch tables map a key to an interface item, there is one per item layout (i.e. per class),
+ * see InterfaceItems::index(). They are bound to the object userdata as user value, so a lookup is
+ * a single raw table get with an interned string as key.
+ *
+ * An entry is the item index shifted left by \ref itemKindBits or'ed with the item kind,
+ * or \ref noItem if the key isn't an interface item.
+ */
+constexpr char dispatchTablesKey = 0; //!< address is used as registry key
+constexpr lua_Integer dispatchLayoutIndex = 0; //!< dispatch table index of the layout it belongs to
+constexpr lua_Integer noItem = -1;
+
+enum class ItemKind : lua_Integer
+{
+  Property = 0,
+  VectorProperty = 1,
+  Method = 2,
+  Event = 3,
+};
+
+constexpr int itemKindBits = 2;
+constexpr lua_Integer itemKindMask = (1 << itemKindBits) - 1;
+
+lua_Integer resolveDispatchEntry(::Object& object, std::string_view key)
+{
+  if(key == "on_changed")
+  {
+    return noItem; // handled by Object::index()
+  }
+
+  InterfaceItem* item = object.getItem(key);
+  if(!item)
+  {
+    return noItem;
+  }
+
+  ItemKind kind;
+  if(dynamic_cast<AbstractProperty*>(item))
+    kind = ItemKind::Property;
+  else if(dynamic_cast<AbstractVectorProperty*>(item))
+    kind = ItemKind::VectorProperty;
+  else if(dynamic_cast<AbstractMethod*>(item))
+    kind = ItemKind::Method;
+  else if(dynamic_cast<AbstractEvent*>(item))
+    kind = ItemKind::Event;
+  else
+  {
+    assert(false); // it must be a property, method or event
+    return noItem;
+  }
+  return (static_cast<lua_Integer>(item->index()) << itemKindBits) | static_cast<lua_Integer>(kind);
+}
+
+//! \brief Push the dispatch table of the object at index 1, (re)binds it if the item layout changed.
+void pushDispatchTable(lua_State* L, ::Object& object)
+{
+  const void* layout = &object.interfaceItems().index(typeid(object));
+
+  if(lua_getuservalue(L, 1) == LUA_TTABLE)
+  {
+    const bool bound = lua_rawgeti(L, -1, dispatchLayoutIndex) == LUA_TLIGHTUSERDATA && lua_touserdata(L, -1) == layout;
+    lua_pop(L, 1); // pop layout
+    if(bound)
+    {
+      return;
+    }
+  }
+  lua_pop(L, 1); // pop user value
+
+  lua_rawgetp(L, LUA_REGISTRYINDEX, &dispatchTablesKey);
+  assert(lua_istable(L, -1));
+  if(lua_rawgetp(L, -1, layout) != LUA_TTABLE)
+  {
+    lua_pop(L, 1); // pop nil
+    lua_newtable(L);
+    lua_pushlightuserdata(L, const_cast<void*>(layout));
+    lua_rawseti(L, -2, dispatchLayoutIndex);
+    lua_pushvalue(L, -1);
+    lua_rawsetp(L, -3, layout);
+  }
+  lua_remove(L, -2); // remove dispatch tables
+  lua_pushvalue(L, -1);
+  lua_setuservalue(L, 1);
+}
+
+//! \brief Get the dispatch entry for the key at index 2, resolves it on first use.
+lua_Integer getDispatchEntry(lua_State* L, ::Object& object)
+{
+  if(lua_type(L, 2) != LUA_TSTRING)
+  {
+    return noItem;
+  }
+
+  pushDispatchTable(L, object);
+  lua_pushvalue(L, 2);
+  if(lua_rawget(L, -2) != LUA_TNUMBER)
+  {
+    lua_pop(L, 1); // pop nil
+    const lua_Integer entry = resolveDispatchEntry(object, to<std::string_view>(L, 2));
+    lua_pushvalue(L, 2);
+    lua_pushinteger(L, entry);
+    lua_rawset(L, -3);
+    lua_pop(L, 1); // pop dispatch table
+    return entry;
+  }
+  const lua_Integer entry = lua_tointeger(L, -1);
+  lua_pop(L, 2); // pop entry and dispatch table
+  return entry;
+}
+
+}
+
 void Object::registerType(lua_State* L)
 {
+  lua_newtable(L);
+  lua_rawsetp(L, LUA_REGISTRYINDEX, &dispatchTablesKey);
+
   luaL_newmetatable(L, metaTableName);
   lua_pushcfunction(L, __gc);
   lua_setfield(L, -2, "__gc");
@@ -105,54 +222,57 @@ void Object::pushPropertyValue(lua_State* L, AbstractProperty& property)
 
 int Object::index(lua_State* L, ::Object& object)
 {
-  const auto key = to<std::string_view>(L, 2);
-
-  LUA_OBJECT_METHOD(on_changed)
-
-  if(InterfaceItem* item = object.getItem(key))
+  if(const lua_Integer entry = getDispatchEntry(L, object); entry != noItem)
   {
-    if(auto* property = dynamic_cast<AbstractProperty*>(item))
-    {
-      pushPropertyValue(L, *property);
-    }
-    else if(auto* vectorProperty = dynamic_cast<AbstractVectorProperty*>(item))
-    {
-      if(vectorProperty->isScriptReadable())
-        VectorProperty::push(L, *vectorProperty);
-      else
-        lua_pushnil(L);
-    }
-    else if(auto* method = dynamic_cast<AbstractMethod*>(item))
+    InterfaceItem* item = object.interfaceItems().get(static_cast<size_t>(entry >> itemKindBits));
+    assert(item);
+    switch(static_cast<ItemKind>(entry & itemKindMask))
     {
-      if(method->isScriptCallable())
-        Method::push(L, *method);
-      else
-        lua_pushnil(L);
-    }
-    else if(auto* event = dynamic_cast<AbstractEvent*>(item))
-    {
-      if(event->isScriptable())
-        Event::push(L, *event);
-      else
-        lua_pushnil(L);
-    }
-    else
-    {
-      assert(false); // it must be a property or method
-      lua_pushnil(L);
+      case ItemKind::Property:
+        pushPropertyValue(L, static_cast<AbstractProperty&>(*item));
+        return 1;
+
+      case ItemKind::VectorProperty:
+        if(auto& vectorProperty = static_cast<AbstractVectorProperty&>(*item); vectorProperty.isScriptReadable())
+          VectorProperty::push(L, vectorProperty);
+        else
+          lua_pushnil(L);
+        return 1;
+
+      case ItemKind::Method:
+        if(auto& method = static_cast<AbstractMethod&>(*item); method.isScriptCallable())
+          Method::push(L, method);
+        else
+          lua_pushnil(L);
+        return 1;
+
+      case ItemKind::Event:
+        if(auto& event = static_cast<AbstractEvent&>(*item); event.isScriptable())
+          Event::push(L, event);
+        else
+          lua_pushnil(L);
+        return 1;
     }
+    unreachable();
   }
-  else
-    lua_pushnil(L);
 
+  const auto key = to<std::string_view>(L, 2);
+
+  LUA_OBJECT_METHOD(on_changed)
+
+  lua_pushnil(L);
   return 1;
 }
 
 int Object::newindex(lua_State* L, ::Object& object)
 {
-  const auto key = to<std::string_view>(L, 2);
+  AbstractProperty* property = nullptr;
+  if(const lua_Integer entry = getDispatchEntry(L, object); entry != noItem && static_cast<ItemKind>(entry & itemKindMask) == ItemKind::Property)
+  {
+    property = static_cast<AbstractProperty*>(object.interfaceItems().get(static_cast<size_t>(entry >> itemKindBits)));
+  }
 
-  if(AbstractProperty* property = object.getProperty(key))
+  if(property)
   {
     if(!property->isScriptWriteable() || !property->isWriteable())
       errorCantSetReadOnlyProperty(L);
@@ -185,6 +185,16 @@ void OnChangedHandler::setFilter(std::vector<std::string> filter)
   m_filter = std::move(filter);
 }
 
+const std::string& OnChangedHandler::name(const ::BaseProperty& property)
+{
+  auto it = m_names.find(&property);
+  if(it == m_names.end())
+  {
+    it = m_names.emplace(&property, property.object().getObjectId().append(".").append(property.name())).first;
+  }
+  return it->second;
+}
+
 void OnChangedHandler::propertyChanged(::BaseProperty& baseProperty)
 {
   if(m_paused)
@@ -228,13 +238,14 @@ void OnChangedHandler::propertyChanged(::BaseProperty& baseProperty)
   Lua::push(m_L, baseProperty.name());
   lua_rawgeti(m_L, LUA_REGISTRYINDEX, m_userData);
 
-  if(Sandbox::pcall(m_L, 4, 0, 0) != LUA_OK)
+  const auto& handlerName = name(baseProperty);
+  if(Sandbox::pcall(m_L, 4, 0, 0, handlerName) != LUA_OK)
   {
     Log::log(
       Sandbox::getStateData(m_L).script().id,
       LogMessage::E9002_X_DURING_EXECUTION_OF_X_ON_CHANGED_HANDLER,
       to<std::string_view>(m_L, -1),
-      baseProperty.object().getObjectId().append(".").append(baseProperty.name()));
+      handlerName);
   }
 }
 
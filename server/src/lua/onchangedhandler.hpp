@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <boost/signals2/connection.hpp>
 #include <lua.hpp>
@@ -69,6 +70,9 @@ private:
   boost::signals2::scoped_connection m_connection;
   std::vector<std::string> m_filter;
   bool m_paused = false;
+  std::unordered_map<const ::BaseProperty*, std::string> m_names; //!< e.g. train_1.name, for profiling and logging, object id at first change
+
+  const std::string& name(const ::BaseProperty& property);
 
   void propertyChanged(::BaseProperty& property);
   void release();
@@ -0,0 +1,139 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include "../compat/stdformat.hpp"
+
+namespace Lua {
+
+static double toMilliseconds(Profiler::Duration value)
+{
+  return std::chrono::duration<double, std::milli>(value).count();
+}
+
+void Profiler::Stats::add(Duration duration, uint64_t instructions_, uint64_t allocated_)
+{
+  calls++;
+  total += duration;
+  max = std::max(max, duration);
+  instructions += instructions_;
+  allocated += allocated_;
+
+  const double us = std::chrono::duration<double, std::micro>(duration).count();
+  size_t bucket = 0;
+  if(us > 1)
+  {
+    bucket = std::min(static_cast<size_t>(std::log2(us) * 4), histogramSize - 1);
+  }
+  histogram[bucket]++;
+}
+
+Profiler::Duration Profiler::Stats::percentile(double percentile) const
+{
+  if(calls == 0)
+  {
+    return Duration::zero();
+  }
+
+  const auto threshold = static_cast<uint64_t>(std::ceil(calls * percentile));
+  uint64_t count = 0;
+  for(size_t i = 0; i < histogramSize; i++)
+  {
+    count += histogram[i];
+    if(count >= threshold)
+    {
+      const auto upperBound = std::chrono::duration<double, std::micro>(std::exp2((i + 1) / 4.0));
+      return std::min(max, std::chrono::duration_cast<Duration>(upperBound));
+    }
+  }
+  return max;
+}
+
+std::vector<std::pair<int, Profiler::LineStats>> Profiler::topLines(size_t count) const
+{
+  std::vector<std::pair<int, LineStats>> lines(m_lines.begin(), m_lines.end());
+  std::sort(lines.begin(), lines.end(),
+    [](const auto& a, const auto& b)
+    {
+      return a.second.time > b.second.time;
+    });
+  if(lines.size() > count)
+  {
+    lines.resize(count);
+  }
+  return lines;
+}
+
+void Profiler::add(std::string_view handler, Duration duration, uint64_t instructions, uint64_t allocated)
+{
+  m_total.add(duration, instructions, allocated);
+
+  auto it = m_handlers.find(handler);
+  if(it == m_handlers.end())
+  {
+    it = m_handlers.emplace(handler, Stats()).first;
+  }
+  it->second.add(duration, instructions, allocated);
+}
+
+void Profiler::addSample(int line, Duration duration)
+{
+  auto& stats = m_lines[line];
+  stats.samples++;
+  stats.time += duration;
+}
+
+void Profiler::reset()
+{
+  m_total = Stats();
+  m_handlers.clear();
+  m_lines.clear();
+}
+
+std::string Profiler::report(size_t lineCount) const
+{
+  static constexpr auto format = [](const Stats& stats)
+    {
+      return std::format("calls: {}, total: {:.3f} ms, max: {:.3f} ms, p99: {:.3f} ms, instructions: {}, allocated: {} bytes\n",
+        stats.calls,
+        toMilliseconds(stats.total),
+        toMilliseconds(stats.max),
+        toMilliseconds(stats.percentile(0.99)),
+        stats.instructions,
+        stats.allocated);
+    };
+
+  std::string s = format(m_total);
+  for(const auto& [name, stats] : m_handlers)
+  {
+    s.append("  ").append(name).append(": ").append(format(stats));
+  }
+  for(const auto& [line, stats] : topLines(lineCount))
+  {
+    s.append(std::format("  line {}: {} samples, {:.3f} ms\n", line, stats.samples, toMilliseconds(stats.time)));
+  }
+  return s;
+}
+
+}
@@ -0,0 +1,106 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef TRAINTASTIC_SERVER_LUA_PROFILER_HPP
+#define TRAINTASTIC_SERVER_LUA_PROFILER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Lua {
+
+/**
+ * \brief Execution statistics of a script
+ *
+ * Collects per handler statistics of every top level call into the script
+ * and, when sampling is enabled, the time spent per source line.
+ */
+class Profiler
+{
+  public:
+    using Duration = std::chrono::nanoseconds;
+
+    struct Stats
+    {
+      static constexpr size_t histogramSize = 96; //!< bucket i: 2^(i/4) .. 2^((i+1)/4) us
+
+      uint64_t calls = 0;
+      Duration total = Duration::zero();
+      Duration max = Duration::zero();
+      uint64_t instructions = 0;
+      uint64_t allocated = 0; //!< bytes
+      std::array<uint32_t, histogramSize> histogram = {};
+
+      void add(Duration duration, uint64_t instructions_, uint64_t allocated_);
+
+      //! \brief Upper bound of the duration of \a percentile of the calls.
+      Duration percentile(double percentile) const;
+    };
+
+    struct LineStats
+    {
+      uint64_t samples = 0;
+      Duration time = Duration::zero();
+    };
+
+  private:
+    Stats m_total;
+    std::map<std::string, Stats, std::less<>> m_handlers;
+    std::map<int, LineStats> m_lines;
+
+  public:
+    static constexpr std::string_view mainChunk = "main";
+
+    const Stats& total() const
+    {
+      return m_total;
+    }
+
+    const std::map<std::string, Stats, std::less<>>& handlers() const
+    {
+      return m_handlers;
+    }
+
+    const std::map<int, LineStats>& lines() const
+    {
+      return m_lines;
+    }
+
+    //! \brief Lines sorted by time spent, most expensive first.
+    std::vector<std::pair<int, LineStats>> topLines(size_t count) const;
+
+    void add(std::string_view handler, Duration duration, uint64_t instructions, uint64_t allocated);
+    void addSample(int line, Duration duration);
+    void reset();
+
+    //! \brief Human readable summary, for the diagnostic report.
+    std::string report(size_t lineCount = 10) const;
+};
+
+}
+
+#endif
@@ -34,6 +34,7 @@
 #include "type.hpp"
 #include "object.hpp"
 #include "onchangedhandler.hpp"
+#include "timer.hpp"
 #include "enums.hpp"
 #include "sets.hpp"
 #include "getversion.hpp"
@@ -49,7 +50,7 @@
 #define LUA_SANDBOX "_sandbox"
 #define LUA_SANDBOX_GLOBALS "_sandbox_globals"
 
-constexpr std::array<std::string_view, 24> readOnlyGlobals = {{
+constexpr std::array<std::string_view, 28> readOnlyGlobals = {{
   // Lua baselib:
   "assert",
   "type",
@@ -63,6 +64,7 @@ constexpr std::array<std::string_view, 24> readOnlyGlobals = {{
   LUA_MATHLIBNAME,
   LUA_STRLIBNAME,
   LUA_TABLIBNAME,
+  LUA_COLIBNAME,
   // Constants:
   "VERSION",
   "VERSION_MAJOR",
@@ -76,6 +78,9 @@ constexpr std::array<std::string_view, 24> readOnlyGlobals = {{
   "pv",
   // Functions:
   "is_instance",
+  "delay",
+  "every",
+  "wait",
   // Type info:
   "class",
   "enum",
@@ -191,6 +196,7 @@ SandboxPtr Sandbox::create(Script& script)
   Event::registerType(L);
   EventHandler::registerType(L);
   OnChangedHandler::registerType(L);
+  Timer::registerType(L);
 
   // setup sandbox:
   lua_newtable(L);
@@ -226,6 +232,16 @@ SandboxPtr Sandbox::create(Script& script)
   addLib(L, LUA_TABLIBNAME, luaopen_table, {
     "concat", "insert", "pack", "unpack", "remove", "move", "sort",
     });
+  addLib(L, LUA_COLIBNAME, luaopen_coroutine, {
+    "create", "isyieldable", "resume", "running", "status", "wrap", "yield",
+    });
+
+  // add timer functions:
+  addExtensions(L, {
+    {"delay", Timer::delay},
+    {"every", Timer::every},
+    {"wait", Timer::wait},
+    });
 
   // set VERSION:
   lua_pushstring(L, TRAINTASTIC_VERSION_FULL);
@@ -309,57 +325,118 @@ void Sandbox::syncPersistentVariables(lua_State* L)
   lua_pop(L, 1);
 }
 
-int Sandbox::pcall(lua_State* L, int nargs, int nresults, int errfunc)
+bool Sandbox::setEnvironment(lua_State* L, int index)
 {
   // check if the function has _ENV as first upvalue
   // if so, replace it by the sandbox
   // NOTE: functions which don't use any globals, don't have an _ENV !!
-  assert(lua_isfunction(L, -(1 + nargs)));
-  const char* name = lua_getupvalue(L, -(1 + nargs), 1);
+  assert(lua_isfunction(L, index));
+  index = lua_absindex(L, index);
+  const char* name = lua_getupvalue(L, index, 1);
   if(name)
     lua_pop(L, 1); // remove upvalue from stack
   if(name && strcmp(name, "_ENV") == 0)
   {
     lua_getglobal(L, LUA_SANDBOX); // get the sandbox
     assert(lua_istable(L, -1));
-    if(!lua_setupvalue(L, -(2 + nargs), 1)) // change _ENV to the sandbox
+    if(!lua_setupvalue(L, index, 1)) // change _ENV to the sandbox
     {
       assert(false); // should never happen
-      lua_pop(L, 2 + nargs); // clear stack
-      lua_pushliteral(L, "Internal error @ " __FILE__ ":" STR(__LINE__));
-      return LUA_ERRRUN;
+      lua_pop(L, 1);
+      return false;
     }
   }
+  return true;
+}
+
+int Sandbox::pcall(lua_State* L, int nargs, int nresults, int errfunc, std::string_view handler)
+{
+  if(!setEnvironment(L, -(1 + nargs)))
+  {
+    lua_pop(L, 1 + nargs); // clear stack
+    lua_pushliteral(L, "Internal error @ " __FILE__ ":" STR(__LINE__));
+    return LUA_ERRRUN;
+  }
 
   // limit execution time:
   // Only start for first pcall, a pcall can cause another pcall.
   const bool firstCall = lua_gethook(L) == nullptr;
   if(firstCall)
   {
-    auto& stateData = getStateData(L);
-    stateData.pcallStart = std::chrono::steady_clock::now();
-    stateData.pcallExecutionTimeViolation = false;
-    lua_sethook(L, hook, LUA_MASKCOUNT, 1000);
+    beginCall(L);
+    lua_sethook(L, hook, LUA_MASKCOUNT, getHookCount(L));
   }
 
   const int r = lua_pcall(L, nargs, nresults, errfunc);
 
   if(firstCall)
   {
-    if(!getStateData(L).pcallExecutionTimeViolation)
-    {
-      const auto duration = (std::chrono::steady_clock::now() - getStateData(L).pcallStart);
-      if(duration >= pcallDurationWarning)
-      {
-        ::Log::log(getStateData(L).script(), LogMessage::W9001_EXECUTION_TOOK_X_US, std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
-      }
-    }
     lua_sethook(L, nullptr, 0, 0);
+    endCall(L, handler);
   }
 
   return r;
 }
 
+int Sandbox::resume(lua_State* L, lua_State* thread, int nargs, int* nresults, std::string_view handler)
+{
+  if(lua_status(thread) == LUA_OK && lua_gettop(thread) == nargs + 1 && !setEnvironment(thread, 1)) // start of coroutine
+  {
+    lua_settop(thread, 0);
+    lua_pushliteral(thread, "Internal error @ " __FILE__ ":" STR(__LINE__));
+    return LUA_ERRRUN;
+  }
+
+  // limit execution time, like pcall():
+  const bool firstCall = lua_gethook(L) == nullptr;
+  if(firstCall)
+  {
+    beginCall(L);
+  }
+  lua_sethook(thread, hook, LUA_MASKCOUNT, getHookCount(L)); // a coroutine has its own hook
+
+#if LUA_VERSION_NUM >= 504
+  const int r = lua_resume(thread, L, nargs, nresults);
+#else
+  const int r = lua_resume(thread, L, nargs);
+  *nresults = lua_gettop(thread);
+#endif
+
+  lua_sethook(thread, nullptr, 0, 0);
+  if(firstCall)
+  {
+    endCall(L, handler);
+  }
+
+  return r;
+}
+
+int Sandbox::getHookCount(lua_State* L)
+{
+  return getStateData(L).script().profileSampling ? hookCountSampling : hookCount;
+}
+
+void Sandbox::beginCall(lua_State* L)
+{
+  auto& stateData = getStateData(L);
+  stateData.pcallStart = std::chrono::steady_clock::now();
+  stateData.pcallExecutionTimeViolation = false;
+  stateData.sampleStart = stateData.pcallStart;
+  stateData.instructions = 0;
+  stateData.allocated = 0;
+}
+
+void Sandbox::endCall(lua_State* L, std::string_view handler)
+{
+  auto& stateData = getStateData(L);
+  const auto duration = (std::chrono::steady_clock::now() - stateData.pcallStart);
+  if(!stateData.pcallExecutionTimeViolation && duration >= pcallDurationWarning)
+  {
+    ::Log::log(stateData.script(), LogMessage::W9001_EXECUTION_TOOK_X_US, std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+  }
+  stateData.script().profile(handler.empty() ? Profiler::mainChunk : handler, duration, stateData.instructions, stateData.allocated);
+}
+
 void* Sandbox::alloc(void* userData, void* ptr, size_t oldSize, size_t newSize)
 {
   auto& stateData = *static_cast<StateData*>(userData);
@@ -382,6 +459,7 @@ void* Sandbox::alloc(void* userData, void* ptr, size_t oldSize, size_t newSize)
     if(newptr)
     {
       stateData.memoryUsed += newSize;
+      stateData.allocated += newSize;
     }
     return newptr;
   }
@@ -395,21 +473,43 @@ void* Sandbox::alloc(void* userData, void* ptr, size_t oldSize, size_t newSize)
   if(newptr)
   {
     stateData.memoryUsed = stateData.memoryUsed - oldSize + newSize;
+    if(newSize > oldSize)
+    {
+      stateData.allocated += newSize - oldSize;
+    }
   }
   return newptr;
 }
 
-void Sandbox::hook(lua_State* L, lua_Debug* /*ar*/)
+void Sandbox::hook(lua_State* L, lua_Debug* ar)
 {
-  if((std::chrono::steady_clock::now() - getStateData(L).pcallStart) > pcallDurationMax)
+  auto& stateData = getStateData(L);
+  const auto now = std::chrono::steady_clock::now();
+
+  stateData.instructions += lua_gethookcount(L);
+  if(stateData.script().profileSampling && lua_getinfo(L, "l", ar) && ar->currentline > 0)
   {
-    getStateData(L).pcallExecutionTimeViolation = true;
+    // attribute the time since the previous sample to the current line:
+    stateData.script().profileSample(ar->currentline, now - stateData.sampleStart);
+  }
+  stateData.sampleStart = now;
+
+  if((now - stateData.pcallStart) > pcallDurationMax)
+  {
+    stateData.pcallExecutionTimeViolation = true;
     luaL_error(L, "Exceeded maximum execution time.");
   }
 }
 
 Sandbox::StateData::~StateData()
 {
+  // Cancel timers, suspended coroutines are never resumed:
+  for(const auto& timer : m_timers)
+  {
+    timer->stop();
+  }
+  m_timers.clear();
+
   while(!m_eventHandlers.empty())
   {
     m_eventHandlers.front()->disconnect();
@@ -25,8 +25,10 @@
 #include <memory>
 #include <map>
 #include <set>
+#include <unordered_set>
 #include <algorithm>
 #include <limits>
+#include <string_view>
 #include <chrono>
 #include <cassert>
 #include <vector>
@@ -43,6 +45,7 @@ namespace Lua {
 class Script;
 class EventHandler;
 class OnChangedHandler;
+class Timer;
 
 using SandboxPtr = std::unique_ptr<lua_State, void(*)(lua_State*)>;
 
@@ -51,13 +54,19 @@ class Sandbox
   private:
     static constexpr auto pcallDurationMax = std::chrono::milliseconds(10); //!< Execution time limit
     static constexpr auto pcallDurationWarning = pcallDurationMax / 2; //!< Execution time warning level
+    static constexpr int hookCount = 1000; //!< Instructions between hook calls
+    static constexpr int hookCountSampling = 100; //!< Instructions between hook calls, when profile sampling is enabled
 
     static void close(lua_State* L);
     static int __index(lua_State* L);
     static int __newindex(lua_State* L);
 
     static void* alloc(void* ud, void* ptr, size_t osize, size_t nsize);
-    static void hook(lua_State* L, lua_Debug* /*ar*/);
+    static void hook(lua_State* L, lua_Debug* ar);
+    static bool setEnvironment(lua_State* L, int index);
+    static int getHookCount(lua_State* L);
+    static void beginCall(lua_State* L);
+    static void endCall(lua_State* L, std::string_view handler);
 
   public:
     class StateData
@@ -67,6 +76,7 @@ class Sandbox
         lua_Integer m_eventHandlerId;
         std::vector<std::shared_ptr<EventHandler>> m_eventHandlers;
         std::vector<std::shared_ptr<OnChangedHandler>> m_onChangedHandlers;
+        std::unordered_set<std::shared_ptr<Timer>> m_timers;
         std::map<
           std::weak_ptr<InputController>,
           std::set<std::weak_ptr<Input>, std::owner_less<std::weak_ptr<Input>>>,
@@ -84,6 +94,9 @@ class Sandbox
         size_t memoryUsed = 0;
         std::chrono::time_point<std::chrono::steady_clock> pcallStart;
         bool pcallExecutionTimeViolation;
+        std::chrono::time_point<std::chrono::steady_clock> sampleStart; //!< for profile sampling
+        uint64_t instructions = 0; //!< executed by the current call, counted per hook call
+        uint64_t allocated = 0; //!< bytes allocated by the current call
 
         StateData(Script& script)
           : m_script{script}
@@ -104,6 +117,16 @@ class Sandbox
         void registerOnChangedHandler(std::shared_ptr<OnChangedHandler> handler);
         void unregisterOnChangedHandler(const std::shared_ptr<OnChangedHandler>& handler);
 
+        void registerTimer(std::shared_ptr<Timer> timer)
+        {
+          m_timers.emplace(std::move(timer));
+        }
+
+        void unregisterTimer(const std::shared_ptr<Timer>& timer)
+        {
+          m_timers.erase(timer);
+        }
+
         void registerInput(std::weak_ptr<InputController> inputController, std::weak_ptr<Input> input)
         {
           m_inputs[inputController].emplace(input);
@@ -123,7 +146,10 @@ class Sandbox
     static SandboxPtr create(Script& script);
     static StateData& getStateData(lua_State* L);
     static int getGlobal(lua_State* L, const char* name);
-    static int pcall(lua_State* L, int nargs = 0, int nresults = 0, int errfunc = 0);
+    //! \brief Call a function in the sandbox, \a handler is the name used for profiling.
+    static int pcall(lua_State* L, int nargs = 0, int nresults = 0, int errfunc = 0, std::string_view handler = {});
+    //! \brief Resume a coroutine from C++, with the same execution time limit as pcall().
+    static int resume(lua_State* L, lua_State* thread, int nargs, int* nresults, std::string_view handler = {});
     static void syncPersistentVariables(lua_State* L);
 };
 
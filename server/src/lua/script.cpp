@@ -27,10 +27,12 @@
 #include <traintastic/enum/worldevent.hpp>
 #include <traintastic/set/worldstate.hpp>
 #include "../core/attributes.hpp"
+#include "../core/eventloop.hpp"
 #include "../core/method.tpp"
 #include "../core/objectproperty.tpp"
 #include "../world/worldloader.hpp"
 #include "../world/worldsaver.hpp"
+#include "../utils/category.hpp"
 #include "../utils/displayname.hpp"
 #include "../log/log.hpp"
 
@@ -41,6 +43,7 @@ constexpr std::string_view dotLua = ".lua";
 
 Script::Script(World& world, std::string_view _id) :
   IdObject(world, _id),
+  m_profileUpdateTimer{EventLoop::ioContext()},
   m_sandbox{nullptr, nullptr},
   name{this, "name", std::string(_id), PropertyFlags::ReadWrite | PropertyFlags::Store},
   disabled{this, "disabled", false, PropertyFlags::ReadWrite | PropertyFlags::NoStore | PropertyFlags::NoScript,
@@ -52,6 +55,13 @@ Script::Script(World& world, std::string_view _id) :
   state{this, "state", LuaScriptState::Stopped, PropertyFlags::ReadOnly | PropertyFlags::Store},
   code{this, "code", "", PropertyFlags::ReadWrite | PropertyFlags::NoStore},
   error{this, "error", "", PropertyFlags::ReadOnly | PropertyFlags::NoStore},
+  calls{this, "calls", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::NoScript},
+  executionTime{this, "execution_time", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::NoScript},
+  executionTimeMax{this, "execution_time_max", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::NoScript},
+  executionTimeP99{this, "execution_time_p99", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::NoScript},
+  instructions{this, "instructions", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::NoScript},
+  memoryAllocated{this, "memory_allocated", 0, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::NoScript},
+  profileSampling{this, "profile_sampling", false, PropertyFlags::ReadWrite | PropertyFlags::NoStore | PropertyFlags::NoScript},
   start{*this, "start",
     [this]()
     {
@@ -71,6 +81,12 @@ Script::Script(World& world, std::string_view _id) :
         Log::log(*this, LogMessage::I9003_CLEARED_PERSISTENT_VARIABLES);
         updateEnabled();
       }}
+  , resetProfile{*this, "reset_profile",
+      [this]()
+      {
+        m_profiler.reset();
+        updateProfile();
+      }}
 {
   Attributes::addDisplayName(name, DisplayName::Object::name);
   Attributes::addEnabled(name, false);
@@ -82,12 +98,32 @@ Script::Script(World& world, std::string_view _id) :
   Attributes::addEnabled(code, false);
   m_interfaceItems.add(code);
   m_interfaceItems.add(error);
+  Attributes::addCategory(calls, Category::debug);
+  m_interfaceItems.add(calls);
+  Attributes::addCategory(executionTime, Category::debug);
+  Attributes::addUnit(executionTime, "ms");
+  m_interfaceItems.add(executionTime);
+  Attributes::addCategory(executionTimeMax, Category::debug);
+  Attributes::addUnit(executionTimeMax, "ms");
+  m_interfaceItems.add(executionTimeMax);
+  Attributes::addCategory(executionTimeP99, Category::debug);
+  Attributes::addUnit(executionTimeP99, "ms");
+  m_interfaceItems.add(executionTimeP99);
+  Attributes::addCategory(instructions, Category::debug);
+  m_interfaceItems.add(instructions);
+  Attributes::addCategory(memoryAllocated, Category::debug);
+  Attributes::addUnit(memoryAllocated, "B");
+  m_interfaceItems.add(memoryAllocated);
+  Attributes::addCategory(profileSampling, Category::debug);
+  m_interfaceItems.add(profileSampling);
   Attributes::addEnabled(start, false);
   m_interfaceItems.add(start);
   Attributes::addEnabled(stop, false);
   m_interfaceItems.add(stop);
   Attributes::addEnabled(clearPersistentVariables, false);
   m_interfaceItems.add(clearPersistentVariables);
+  Attributes::addCategory(resetProfile, Category::debug);
+  m_interfaceItems.add(resetProfile);
 
   updateEnabled();
 }
@@ -135,6 +171,7 @@ void Script::addToWorld()
 
 void Script::destroying()
 {
+  m_profileUpdateTimer.cancel();
   m_world.luaScripts->removeObject(shared_ptr<Script>());
   IdObject::destroying();
 }
@@ -255,6 +292,9 @@ void Script::startSandbox()
     return;
   }
 
+  m_profiler.reset();
+  updateProfile();
+
   if((m_sandbox = Sandbox::create(*this)))
   {
     Log::log(*this, LogMessage::N9001_STARTING_SCRIPT);
@@ -286,6 +326,7 @@ void Script::stopSandbox()
 {
   assert(m_sandbox);
   m_sandbox.reset();
+  updateProfile();
   if(state == LuaScriptState::Running)
   {
     setState(LuaScriptState::Stopped);
@@ -293,4 +334,48 @@ void Script::stopSandbox()
   }
 }
 
+void Script::profile(std::string_view handler, Profiler::Duration duration, uint64_t instructionCount, uint64_t allocatedBytes)
+{
+  m_profiler.add(handler, duration, instructionCount, allocatedBytes);
+
+  // limit property updates to once per second:
+  if(!m_profileUpdatePending)
+  {
+    m_profileUpdatePending = true;
+    m_profileUpdateTimer.expires_after(std::chrono::seconds(1));
+    m_profileUpdateTimer.async_wait(
+      [this](const boost::system::error_code& ec)
+      {
+        if(ec)
+        {
+          return;
+        }
+        m_profileUpdatePending = false;
+        updateProfile();
+      });
+  }
+}
+
+void Script::profileSample(int line, Profiler::Duration duration)
+{
+  m_profiler.addSample(line, duration);
+}
+
+void Script::updateProfile()
+{
+  static constexpr auto toMilliseconds =
+    [](Profiler::Duration value)
+    {
+      return std::chrono::duration<double, std::milli>(value).count();
+    };
+
+  const auto& total = m_profiler.total();
+  calls.setValueInternal(total.calls);
+  executionTime.setValueInternal(toMilliseconds(total.total));
+  executionTimeMax.setValueInternal(toMilliseconds(total.max));
+  executionTimeP99.setValueInternal(toMilliseconds(total.percentile(0.99)));
+  instructions.setValueInternal(total.instructions);
+  memoryAllocated.setValueInternal(total.allocated);
+}
+
 }
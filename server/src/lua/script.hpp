@@ -26,6 +26,8 @@
 #include "../core/method.hpp"
 #include "../enum/luascriptstate.hpp"
 #include "sandbox.hpp"
+#include "profiler.hpp"
+#include <boost/asio/steady_timer.hpp>
 
 namespace Lua {
 
@@ -36,6 +38,13 @@ class Script : public IdObject
 
   private:
     mutable std::string m_basename; //!< filename on disk for script
+    Profiler m_profiler;
+    boost::asio::steady_timer m_profileUpdateTimer;
+    bool m_profileUpdatePending = false;
+
+    void profile(std::string_view handler, Profiler::Duration duration, uint64_t instructionCount, uint64_t allocatedBytes);
+    void profileSample(int line, Profiler::Duration duration);
+    void updateProfile();
 
   protected:
     SandboxPtr m_sandbox;
@@ -66,9 +75,22 @@ class Script : public IdObject
     Property<LuaScriptState> state;
     Property<std::string> code;
     Property<std::string> error;
+    Property<int64_t> calls;
+    Property<double> executionTime;
+    Property<double> executionTimeMax;
+    Property<double> executionTimeP99;
+    Property<int64_t> instructions;
+    Property<int64_t> memoryAllocated;
+    Property<bool> profileSampling;
     ::Method<void()> start;
     ::Method<void()> stop;
     ::Method<void()> clearPersistentVariables;
+    ::Method<void()> resetProfile;
+
+    const Profiler& profiler() const
+    {
+      return m_profiler;
+    }
 };
 
 }
@@ -49,27 +49,22 @@ ScriptListTableModel::ScriptListTableModel(ScriptList& list) :
     });
 }
 
-std::string ScriptListTableModel::getText(uint32_t column, uint32_t row) const
+std::string ScriptListTableModel::getItemText(uint32_t column, const Script& script) const
 {
-  if(row < rowCount())
+  switch(column)
   {
-    const Script& script = getItem(row);
+    case columnId:
+      return script.id;
 
-    switch(column)
-    {
-      case columnId:
-        return script.id;
+    case columnName:
+      return script.name;
 
-      case columnName:
-        return script.name;
+    case columnState:
+      return toLocaleString(script.state.value());
 
-      case columnState:
-        return toLocaleString(script.state.value());
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
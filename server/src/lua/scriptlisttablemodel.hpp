@@ -44,7 +44,7 @@ class ScriptListTableModel : public ObjectListTableModel<Script>
 
     ScriptListTableModel(ScriptList& list);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const Script& script) const final;
 };
 
 }
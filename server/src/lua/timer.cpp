@@ -0,0 +1,309 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "timer.hpp"
+#include <cmath>
+#include "sandbox.hpp"
+#include "error.hpp"
+#include "to.hpp"
+#include "script.hpp"
+#include "../log/log.hpp"
+#include "../world/world.hpp"
+
+namespace Lua {
+
+constexpr char const* timerGlobal = "timers";
+constexpr char const* timerThreadsGlobal = "timer_threads";
+
+using TimerData = std::weak_ptr<Timer>;
+
+void Timer::push(lua_State* L, Timer& value)
+{
+  lua_getglobal(L, timerGlobal);
+  lua_rawgetp(L, -1, &value);
+  if(lua_isnil(L, -1)) // timer not in table
+  {
+    lua_pop(L, 1); // remove nil
+    new(lua_newuserdata(L, sizeof(TimerData))) TimerData(value.shared_from_this());
+    luaL_setmetatable(L, metaTableName);
+    lua_pushvalue(L, -1); // copy userdata on stack
+    lua_rawsetp(L, -3, &value); // add timer to table
+  }
+  lua_insert(L, lua_gettop(L) - 1); // swap table and userdata
+  lua_pop(L, 1); // remove table
+}
+
+void Timer::registerType(lua_State* L)
+{
+  luaL_newmetatable(L, metaTableName);
+  lua_pushcfunction(L, __gc);
+  lua_setfield(L, -2, "__gc");
+  lua_pushcfunction(L, __index);
+  lua_setfield(L, -2, "__index");
+  lua_pop(L, 1);
+
+  // weak table for timer userdata:
+  lua_newtable(L);
+  lua_newtable(L); // metatable
+  lua_pushliteral(L, "__mode");
+  lua_pushliteral(L, "v");
+  lua_rawset(L, -3);
+  lua_setmetatable(L, -2);
+  lua_setglobal(L, timerGlobal);
+
+  // weak table for coroutines created by timers, only these may use wait():
+  lua_newtable(L);
+  lua_newtable(L); // metatable
+  lua_pushliteral(L, "__mode");
+  lua_pushliteral(L, "k");
+  lua_rawset(L, -3);
+  lua_setmetatable(L, -2);
+  lua_setglobal(L, timerThreadsGlobal);
+}
+
+int Timer::delay(lua_State* L)
+{
+  return create(L, false);
+}
+
+int Timer::every(lua_State* L)
+{
+  return create(L, true);
+}
+
+int Timer::wait(lua_State* L)
+{
+  const auto interval = checkInterval(L, 1);
+  if(!lua_isyieldable(L) || !isTimerThread(L))
+  {
+    luaL_error(L, "wait can only be used in a function started by delay or every");
+  }
+
+  auto timer = std::make_shared<Timer>(L, interval, false);
+  lua_Debug ar;
+  if(lua_getstack(L, 1, &ar) && lua_getinfo(L, "l", &ar)) // caller of wait()
+  {
+    timer->m_name = std::string("wait:").append(std::to_string(ar.currentline));
+  }
+  lua_pushthread(L);
+  timer->m_thread = luaL_ref(L, LUA_REGISTRYINDEX);
+  Sandbox::getStateData(L).registerTimer(timer);
+  timer->start();
+
+  return lua_yield(L, 0);
+}
+
+int Timer::__gc(lua_State* L)
+{
+  static_cast<TimerData*>(lua_touserdata(L, 1))->~TimerData();
+  return 0;
+}
+
+int Timer::__index(lua_State* L)
+{
+  const auto& timer = *static_cast<TimerData*>(luaL_checkudata(L, 1, metaTableName));
+  const auto key = to<std::string_view>(L, 2);
+
+  if(key == "cancel")
+  {
+    lua_pushvalue(L, 1);
+    lua_pushcclosure(L, cancel, 1);
+    return 1;
+  }
+  if(key == "active")
+  {
+    lua_pushboolean(L, !timer.expired());
+    return 1;
+  }
+  return 0;
+}
+
+int Timer::cancel(lua_State* L)
+{
+  // cancelling an expired timer is allowed, it just does nothing:
+  if(auto timer = static_cast<TimerData*>(luaL_checkudata(L, lua_upvalueindex(1), metaTableName))->lock())
+  {
+    timer->cancel();
+  }
+  return 0;
+}
+
+std::chrono::milliseconds Timer::checkInterval(lua_State* L, int index)
+{
+  const lua_Number seconds = luaL_checknumber(L, index);
+  if(!std::isfinite(seconds) || seconds < 0)
+  {
+    errorArgumentOutOfRange(L, index);
+  }
+  return std::chrono::milliseconds(static_cast<int64_t>(std::ceil(seconds * 1000)));
+}
+
+bool Timer::isTimerThread(lua_State* L)
+{
+  lua_getglobal(L, timerThreadsGlobal);
+  lua_pushthread(L);
+  lua_rawget(L, -2);
+  const bool r = lua_toboolean(L, -1);
+  lua_pop(L, 2); // remove value and table
+  return r;
+}
+
+int Timer::create(lua_State* L, bool repeat)
+{
+  const auto interval = checkInterval(L, 1);
+  luaL_checktype(L, 2, LUA_TFUNCTION);
+
+  auto timer = std::make_shared<Timer>(L, interval, repeat);
+
+  // add function to registry:
+  lua_pushvalue(L, 2);
+  timer->m_function = luaL_ref(L, LUA_REGISTRYINDEX);
+
+  lua_Debug ar;
+  lua_pushvalue(L, 2);
+  lua_getinfo(L, ">S", &ar); // pops function
+  timer->m_name = std::string("timer:").append(std::to_string(ar.linedefined));
+
+  // add userdata to registry (if available):
+  if(!lua_isnoneornil(L, 3))
+  {
+    lua_pushvalue(L, 3);
+    timer->m_userData = luaL_ref(L, LUA_REGISTRYINDEX);
+  }
+
+  Sandbox::getStateData(L).registerTimer(timer);
+  timer->start();
+
+  push(L, *timer);
+  return 1;
+}
+
+Timer::Timer(lua_State* L, std::chrono::milliseconds interval, bool repeat)
+  : m_wheel{Sandbox::getStateData(L).script().world().timerWheel()}
+  , m_interval{interval}
+  , m_repeat{repeat}
+{
+  lua_rawgeti(L, LUA_REGISTRYINDEX, LUA_RIDX_MAINTHREAD);
+  m_L = lua_tothread(L, -1);
+  lua_pop(L, 1);
+}
+
+Timer::~Timer()
+{
+  stop();
+}
+
+void Timer::stop()
+{
+  m_wheel.cancel(m_id);
+  m_id = TimerWheel::invalidId;
+  release();
+}
+
+void Timer::cancel()
+{
+  if(!m_L)
+  {
+    return; // already stopped
+  }
+  auto& stateData = Sandbox::getStateData(m_L);
+  stop();
+  stateData.unregisterTimer(shared_from_this());
+}
+
+void Timer::start()
+{
+  m_id = m_wheel.add(m_interval,
+    [this]()
+    {
+      expired();
+    });
+}
+
+void Timer::expired()
+{
+  auto self = shared_from_this(); // the timer function may cancel the timer
+  lua_State* L = m_L;
+
+  m_id = TimerWheel::invalidId;
+  if(m_repeat)
+  {
+    start(); // next interval doesn't depend on the execution time
+  }
+
+  // run the timer function in a new coroutine, or resume the coroutine suspended by wait():
+  lua_State* thread;
+  int nargs = 0;
+  if(m_thread != LUA_NOREF)
+  {
+    lua_rawgeti(L, LUA_REGISTRYINDEX, m_thread); // keep reference on the stack while running
+    thread = lua_tothread(L, -1);
+  }
+  else
+  {
+    thread = lua_newthread(L);
+    lua_getglobal(L, timerThreadsGlobal);
+    lua_pushvalue(L, -2); // copy thread
+    lua_pushboolean(L, 1);
+    lua_rawset(L, -3); // mark as timer thread, allows wait()
+    lua_pop(L, 1); // remove table
+    lua_rawgeti(thread, LUA_REGISTRYINDEX, m_function);
+    if(m_userData != LUA_NOREF)
+    {
+      lua_rawgeti(thread, LUA_REGISTRYINDEX, m_userData);
+      nargs = 1;
+    }
+  }
+
+  int nresults = 0;
+  const int r = Sandbox::resume(L, thread, nargs, &nresults, m_name);
+  if(r == LUA_OK || r == LUA_YIELD)
+  {
+    lua_pop(thread, nresults); // a yielded coroutine is referenced by its wait() timer
+  }
+  else
+  {
+    Log::log(Sandbox::getStateData(L).script().id, LogMessage::E9003_X_DURING_EXECUTION_OF_TIMER, to<std::string_view>(thread, -1));
+  }
+  lua_pop(L, 1); // remove thread
+
+  if(!m_repeat)
+  {
+    cancel();
+  }
+}
+
+void Timer::release()
+{
+  if(m_L)
+  {
+    luaL_unref(m_L, LUA_REGISTRYINDEX, m_function);
+    luaL_unref(m_L, LUA_REGISTRYINDEX, m_userData);
+    luaL_unref(m_L, LUA_REGISTRYINDEX, m_thread);
+    m_function = LUA_NOREF;
+    m_userData = LUA_NOREF;
+    m_thread = LUA_NOREF;
+    m_L = nullptr;
+  }
+}
+
+}
@@ -0,0 +1,91 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef TRAINTASTIC_SERVER_LUA_TIMER_HPP
+#define TRAINTASTIC_SERVER_LUA_TIMER_HPP
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <lua.hpp>
+#include "../core/timerwheel.hpp"
+
+namespace Lua {
+
+/**
+ * \brief Script timer, see delay(), every() and wait()
+ *
+ * Timer functions run in their own coroutine, so they can use wait().
+ * All timers of a script are cancelled when the script stops.
+ */
+class Timer : public std::enable_shared_from_this<Timer>
+{
+public:
+  static constexpr char const* metaTableName = "timer";
+
+  static void push(lua_State* L, Timer& value);
+
+  static void registerType(lua_State* L);
+
+  //! \brief delay(seconds, function [, user_data]) call function once after seconds.
+  static int delay(lua_State* L);
+  //! \brief every(seconds, function [, user_data]) call function every seconds.
+  static int every(lua_State* L);
+  //! \brief wait(seconds) suspend the running timer function for seconds.
+  //! Only allowed in coroutines created by a timer, a script's own coroutines are resumed by the script.
+  static int wait(lua_State* L);
+
+  Timer(lua_State* L, std::chrono::milliseconds interval, bool repeat);
+  ~Timer();
+
+  //! \brief Stop the timer and release its Lua references.
+  void stop();
+  //! \brief Stop the timer and remove it from the script.
+  void cancel();
+
+private:
+  static int __gc(lua_State* L);
+  static int __index(lua_State* L);
+  static int cancel(lua_State* L);
+
+  static std::chrono::milliseconds checkInterval(lua_State* L, int index);
+  static bool isTimerThread(lua_State* L);
+  static int create(lua_State* L, bool repeat);
+
+  lua_State* m_L; //!< main thread
+  TimerWheel& m_wheel;
+  TimerWheel::Id m_id = TimerWheel::invalidId;
+  const std::chrono::milliseconds m_interval;
+  const bool m_repeat;
+  int m_function = LUA_NOREF;
+  int m_userData = LUA_NOREF;
+  int m_thread = LUA_NOREF; //!< coroutine suspended by wait()
+  std::string m_name; //!< for profiling, e.g. timer:12 for a timer function defined at line 12
+
+  void start();
+  void expired();
+  void release();
+};
+
+}
+
+#endif
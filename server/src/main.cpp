@@ -23,6 +23,7 @@
 #include <functional>
 #include "options.hpp"
 #include "core/eventloop.hpp"
+#include "core/iothreadpool.hpp"
 #include "traintastic/traintastic.hpp"
 #include "log/log.hpp"
 #include <traintastic/locale/locale.hpp>
@@ -98,6 +99,8 @@ int main(int argc, char* argv[])
     EventLoop::reset();
 
     {
+      Log::disableFileLogger(); // stop the writer thread, it uses the locale
+
       const auto localePath = getLocalePath();
       try
       {
@@ -129,9 +132,12 @@ int main(int argc, char* argv[])
         Log::disableMemoryLogger();
 
       if(settings.enableFileLogger)
-        Log::enableFileLogger(dataDir / "log" / "traintastic.txt");
+        Log::enableFileLogger(dataDir / "log" / "traintastic.txt", std::chrono::milliseconds(settings.fileLoggerFlushInterval), static_cast<uintmax_t>(settings.fileLoggerRotateSize) * 1024 * 1024);
       else
         Log::disableFileLogger();
+
+      if(settings.ioThreadPoolSize > 0)
+        IOThreadPool::start(settings.ioThreadPoolSize, settings.ioThreadPoolCpuPinning);
     }
 
 #ifdef WIN32
@@ -188,6 +194,8 @@ int main(int argc, char* argv[])
       assert(weak.expired());
 #endif
     }
+
+    IOThreadPool::stop(); // after all interfaces are destroyed
   }
   while(restart);
 
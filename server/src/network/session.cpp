@@ -20,16 +20,17 @@
  */
 
 #include "session.hpp"
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include "../traintastic/traintastic.hpp"
 #include "clientconnection.hpp"
 #include <traintastic/enum/interfaceitemtype.hpp>
 #include <traintastic/enum/attributetype.hpp>
+#include <traintastic/enum/timeseriesresolution.hpp>
+#include <traintastic/enum/valuetype.hpp>
 #include "../compat/stdformat.hpp"
-#ifndef NDEBUG
-  #include "../core/eventloop.hpp" // for: isEventLoopThread()
-#endif
+#include "../core/eventloop.hpp"
 #include "../core/abstractobjectlist.hpp"
 #include "../core/abstractunitproperty.hpp"
 #include "../core/objectproperty.tpp"
@@ -37,6 +38,7 @@
 #include "../log/log.hpp"
 #include "../log/logmessageexception.hpp"
 #include "../log/memorylogger.hpp"
+#include "../world/telemetry.hpp"
 #include "../board/board.hpp"
 #include "../board/tile/tiles.hpp"
 #include "../hardware/input/monitor/inputmonitor.hpp"
@@ -62,7 +64,8 @@ std::pair<std::string_view, std::string_view> splitOnLastDot(std::string_view sv
 
 Session::Session(const std::shared_ptr<ClientConnection>& connection) :
   m_connection{connection},
-  m_uuid{boost::uuids::random_generator()()}
+  m_uuid{boost::uuids::random_generator()()},
+  m_tableModelUpdateTimer{EventLoop::ioContext()}
 {
   assert(isEventLoopThread());
 }
@@ -127,11 +130,11 @@ bool Session::processMessage(const Message& message)
       {
         auto response = Message::newResponse(message.command(), message.requestId());
         writeObject(*response, obj);
-        m_connection->sendMessage(std::move(response));
+        sendMessage(std::move(response));
       }
       else
       {
-        m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+        sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
       }
       return true;
     }
@@ -144,9 +147,13 @@ bool Session::processMessage(const Message& message)
       const auto counter = message.read<uint32_t>();
       if(counter == m_handles.getCounter(handle))
       {
-        if(auto object = m_handles.getItem(handle); object && isSessionObject(object))
+        if(auto object = m_handles.getItem(handle))
         {
-          object->destroy();
+          discardChangedProperties(*object);
+          if(isSessionObject(object))
+          {
+            object->destroy();
+          }
         }
 
         m_handles.removeHandle(handle);
@@ -161,7 +168,7 @@ bool Session::processMessage(const Message& message)
 
         auto event = Message::newEvent(message.command(), sizeof(Handle));
         event->write(handle);
-        m_connection->sendMessage(std::move(event));
+        sendMessage(std::move(event));
       }
       break;
     }
@@ -171,7 +178,7 @@ bool Session::processMessage(const Message& message)
       {
         if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
         {
-          if(AbstractProperty* property = object->getProperty(message.read<std::string>()); property && !property->isInternal())
+          if(auto* property = dynamic_cast<AbstractProperty*>(object->interfaceItems().get(message.read<uint16_t>())); property && !property->isInternal())
           {
             try
             {
@@ -201,23 +208,23 @@ bool Session::processMessage(const Message& message)
             {
               if(message.isRequest()) // send error response
               {
-                m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
+                sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
               }
               else // send changed event with current value:
                 objectPropertyChanged(*property);
             }
 
             if(message.isRequest()) // send success response
-              m_connection->sendMessage(Message::newResponse(message.command(), message.requestId()));
+              sendMessage(Message::newResponse(message.command(), message.requestId()));
           }
           else if(message.isRequest()) // send error response
           {
-            m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
+            sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
           }
         }
         else if(message.isRequest()) // send error response
         {
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
         }
       }
       return true;
@@ -260,23 +267,23 @@ bool Session::processMessage(const Message& message)
             {
               if(message.isRequest()) // send error response
               {
-                m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
+                sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
               }
               else // send changed event with current value:
                 objectPropertyChanged(*property);
             }
 
             if(message.isRequest()) // send success response
-              m_connection->sendMessage(Message::newResponse(message.command(), message.requestId()));
+              sendMessage(Message::newResponse(message.command(), message.requestId()));
           }
           else if(message.isRequest()) // send error response
           {
-            m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
+            sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
           }
         }
         else if(message.isRequest()) // send error response
         {
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
         }
       }
       return true;
@@ -311,16 +318,16 @@ bool Session::processMessage(const Message& message)
             {
               auto response = Message::newResponse(message.command(), message.requestId());
               writeObject(*response, obj);
-              m_connection->sendMessage(std::move(response));
+              sendMessage(std::move(response));
             }
             else
-              m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+              sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
           }
           else // send error response
-            m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
+            sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
         }
         else // send error response
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
 
         return true;
       }
@@ -341,16 +348,16 @@ bool Session::processMessage(const Message& message)
               auto response = Message::newResponse(message.command(), message.requestId());
               for(size_t i = startIndex; i <= endIndex; i++)
                 writeObject(*response, property->getObject(i));
-              m_connection->sendMessage(std::move(response));
+              sendMessage(std::move(response));
             }
             else // send error response
-              m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1017_INVALID_INDICES));
+              sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1017_INVALID_INDICES));
           }
           else // send error response
-            m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
+            sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1016_UNKNOWN_PROPERTY));
         }
         else // send error response
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1015_UNKNOWN_OBJECT));
 
         return true;
       }
@@ -360,7 +367,7 @@ bool Session::processMessage(const Message& message)
     {
       if(ObjectPtr object = m_handles.getItem(message.read<Handle>()))
       {
-        if(AbstractObjectProperty* property = dynamic_cast<AbstractObjectProperty*>(object->getProperty(message.read<std::string>())); property && !property->isInternal())
+        if(auto* property = dynamic_cast<AbstractObjectProperty*>(object->interfaceItems().get(message.read<uint16_t>())); property && !property->isInternal())
         {
           try
           {
@@ -428,7 +435,7 @@ bool Session::processMessage(const Message& message)
           assert(model);
           auto response = Message::newResponse(message.command(), message.requestId());
           writeTableModel(*response, model);
-          m_connection->sendMessage(std::move(response));
+          sendMessage(std::move(response));
 
           model->columnHeadersChanged = [this](const TableModelPtr& tableModel)
             {
@@ -437,7 +444,7 @@ bool Session::processMessage(const Message& message)
               event->write(tableModel->columnCount());
               for(const auto& text : tableModel->columnHeaders())
                 event->write(text);
-              m_connection->sendMessage(std::move(event));
+              sendMessage(std::move(event));
             };
 
           model->rowCountChanged = [this](const TableModelPtr& tableModel)
@@ -445,34 +452,27 @@ bool Session::processMessage(const Message& message)
               auto event = Message::newEvent(Message::Command::TableModelRowCountChanged);
               event->write(m_handles.getHandle(std::dynamic_pointer_cast<Object>(tableModel)));
               event->write(tableModel->rowCount());
-              m_connection->sendMessage(std::move(event));
+              sendMessage(std::move(event));
             };
 
           model->updateRegion = [this](const TableModelPtr& tableModel, const TableModel::Region& region)
             {
-              auto event = Message::newEvent(Message::Command::TableModelUpdateRegion);
-              event->write(m_handles.getHandle(std::dynamic_pointer_cast<Object>(tableModel)));
-              event->write(region.columnMin);
-              event->write(region.columnMax);
-              event->write(region.rowMin);
-              event->write(region.rowMax);
-
-              for(uint32_t row = region.rowMin; row <= region.rowMax; row++)
-                for(uint32_t column = region.columnMin; column <= region.columnMax; column++)
-                  event->write(tableModel->getText(column, row));
-
-              m_connection->sendMessage(std::move(event));
+              tableModelChanged(tableModel, region);
             };
 
           return true;
         }
       }
-      m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1019_OBJECT_NOT_A_TABLE));
+      sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1019_OBJECT_NOT_A_TABLE));
       return true;
     }
     case Message::Command::ReleaseTableModel:
-      m_handles.removeHandle(message.read<Handle>());
+    {
+      const auto handle = message.read<Handle>();
+      m_tableModels.erase(handle);
+      m_handles.removeHandle(handle);
       break;
+    }
 
     case Message::Command::TableModelSetRegion:
     {
@@ -488,6 +488,23 @@ bool Session::processMessage(const Message& message)
       }
       break;
     }
+    case Message::Command::TableModelSetView:
+    {
+      const auto handle = message.read<Handle>();
+      TableModelPtr model = std::dynamic_pointer_cast<TableModel>(m_handles.getItem(handle));
+      if(model && model->isViewSupported())
+      {
+        // the client drops its cell values when the view changes:
+        if(auto it = m_tableModels.find(handle); it != m_tableModels.end())
+          it->second.values.clear();
+
+        const auto sortColumn = message.read<uint32_t>();
+        const auto sortDescending = message.read<bool>();
+        const auto search = message.read<std::string_view>();
+        model->setView(sortColumn, sortDescending, search);
+      }
+      break;
+    }
     case Message::Command::InputMonitorGetInputInfo:
     {
       auto inputMonitor = std::dynamic_pointer_cast<InputMonitor>(m_handles.getItem(message.read<Handle>()));
@@ -502,11 +519,50 @@ bool Session::processMessage(const Message& message)
           response->write(info.used);
           response->write(info.value);
         }
-        m_connection->sendMessage(std::move(response));
+        sendMessage(std::move(response));
         return true;
       }
       break;
     }
+    case Message::Command::GetTimeSeries:
+      if(message.isRequest())
+      {
+        ObjectPtr object = m_handles.getItem(message.read<Handle>());
+        if(!object)
+        {
+          sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT));
+          return true;
+        }
+
+        const auto name = message.read<std::string_view>();
+        const auto resolution = message.read<TimeSeriesResolution>();
+        const auto from = message.read<int64_t>();
+        const auto to = message.read<int64_t>();
+
+        const auto& world = Traintastic::instance->world.value();
+        const auto* series = world ? world->telemetry().find(*object, name) : nullptr;
+        if(!series || static_cast<size_t>(resolution) >= TimeSeries::periods.size())
+        {
+          sendMessage(message.errorResponse(LogMessage::C1016_UNKNOWN_PROPERTY));
+          return true;
+        }
+
+        const auto window = series->window(resolution, from, to);
+        auto response = message.response(sizeof(int64_t) * 2 + sizeof(uint32_t) + window.buckets.size() * sizeof(float) * 3);
+        response->write(window.start);
+        response->write(window.period);
+        response->write(static_cast<uint32_t>(window.buckets.size()));
+        for(const auto& bucket : window.buckets)
+        {
+          response->write(bucket.min);
+          response->write(bucket.average());
+          response->write(bucket.max);
+        }
+        sendMessage(std::move(response));
+        return true;
+      }
+      break;
+
     case Message::Command::OutputKeyboardGetOutputInfo:
     {
       auto outputKeyboard = std::dynamic_pointer_cast<OutputKeyboard>(m_handles.getItem(message.read<Handle>()));
@@ -536,7 +592,7 @@ bool Session::processMessage(const Message& message)
               break;
           }
         }
-        m_connection->sendMessage(std::move(response));
+        sendMessage(std::move(response));
         return true;
       }
       break;
@@ -558,7 +614,7 @@ bool Session::processMessage(const Message& message)
           if(tile.data().isActive())
             writeObject(*response, it.second);
         }
-        m_connection->sendMessage(std::move(response));
+        sendMessage(std::move(response));
         return true;
       }
       break;
@@ -577,7 +633,7 @@ bool Session::processMessage(const Message& message)
         response->write(item.menu);
         response->writeBlockEnd();
       }
-      m_connection->sendMessage(std::move(response));
+      sendMessage(std::move(response));
       return true;
     }
     case Message::Command::ServerLog:
@@ -601,11 +657,11 @@ bool Session::processMessage(const Message& message)
           std::vector<std::byte> worldData;
           message.read(worldData);
           Traintastic::instance->importWorld(worldData);
-          m_connection->sendMessage(Message::newResponse(message.command(), message.requestId()));
+          sendMessage(Message::newResponse(message.command(), message.requestId()));
         }
         catch(const LogMessageException& e)
         {
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
         }
       }
       break;
@@ -621,16 +677,16 @@ bool Session::processMessage(const Message& message)
             Traintastic::instance->world->export_(worldData);
             auto response = Message::newResponse(message.command(), message.requestId());
             response->write(worldData);
-            m_connection->sendMessage(std::move(response));
+            sendMessage(std::move(response));
           }
           catch(const LogMessageException& e)
           {
-            m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
+            sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
           }
         }
         else
         {
-          m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1010_EXPORTING_WORLD_FAILED_X, "nullptr"));
+          sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1010_EXPORTING_WORLD_FAILED_X, "nullptr"));
         }
         return true;
       }
@@ -647,16 +703,16 @@ bool Session::processMessage(const Message& message)
             auto throttle = ClientThrottle::create(*Traintastic::instance->world);
             auto response = message.response();
             writeObject(*response, throttle);
-            m_connection->sendMessage(std::move(response));
+            sendMessage(std::move(response));
           }
           else
           {
-            m_connection->sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT)); // FIXME change error
+            sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT)); // FIXME change error
           }
         }
         else
         {
-          m_connection->sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT)); // FIXME change error
+          sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT)); // FIXME change error
         }
         return true;
       }
@@ -679,21 +735,21 @@ bool Session::processMessage(const Message& message)
               {
                 writeObject(*response, list->getObject(i));
               }
-              m_connection->sendMessage(std::move(response));
+              sendMessage(std::move(response));
             }
             else // send error response
             {
-              m_connection->sendMessage(message.errorResponse(LogMessage::C1017_INVALID_INDICES));
+              sendMessage(message.errorResponse(LogMessage::C1017_INVALID_INDICES));
             }
           }
           else
           {
-            m_connection->sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT));
+            sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT));
           }
         }
         else
         {
-          m_connection->sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT));
+          sendMessage(message.errorResponse(LogMessage::C1015_UNKNOWN_OBJECT));
         }
         return true;
       }
@@ -742,9 +798,9 @@ bool Session::processMessage(const Message& message)
                   logMessageChar(log.message),
                   logMessageNumber(log.message)));
 
-              if(log.args)
+              if(!log.args.empty())
               {
-                serverLog.append(Logger::toString(log.message, *log.args));
+                serverLog.append(Logger::toString(log.message, log.args));
               }
               else
               {
@@ -763,7 +819,7 @@ bool Session::processMessage(const Message& message)
           response->write(worldData);
         }
 
-        m_connection->sendMessage(std::move(response));
+        sendMessage(std::move(response));
       }
       break;
 
@@ -773,6 +829,13 @@ bool Session::processMessage(const Message& message)
   return false;
 }
 
+void Session::sendMessage(std::unique_ptr<Message> message)
+{
+  // keep message order, property changes must arrive before anything sent after them:
+  flushChangedProperties();
+  m_connection->sendMessage(std::move(message));
+}
+
 bool Session::isSessionObject(const ObjectPtr& object)
 {
   assert(object);
@@ -865,7 +928,7 @@ bool Session::callMethod(const Message& message, AbstractMethod& method)
           break;
       }
 
-      m_connection->sendMessage(std::move(response));
+      sendMessage(std::move(response));
       return true;
     }
   }
@@ -873,7 +936,7 @@ bool Session::callMethod(const Message& message, AbstractMethod& method)
   {
     if(message.isRequest())
     {
-      m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
+      sendMessage(Message::newErrorResponse(message.command(), message.requestId(), e.message(), e.args()));
       return true;
     }
     // we can't report it back to the caller, so just log it.
@@ -883,7 +946,7 @@ bool Session::callMethod(const Message& message, AbstractMethod& method)
   {
     if(message.isRequest())
     {
-      m_connection->sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
+      sendMessage(Message::newErrorResponse(message.command(), message.requestId(), LogMessage::C1018_EXCEPTION_X, e.what()));
       return true;
     }
   }
@@ -912,99 +975,81 @@ void Session::writeObject(Message& message, const ObjectPtr& object)
 
     bool hasPublicEvents = false;
 
+    // the item descriptions are sent once per session per schema, objects only carry values and attributes:
+    auto& schemas = m_objectSchemas[{object->getClassId(), objectSchemaHash(*object)}];
+    auto schemaIt = std::find_if(schemas.begin(), schemas.end(),
+      [&object](const ObjectSchema& s)
+      {
+        return isObjectSchema(s, *object);
+      });
+    const bool isNewSchema = (schemaIt == schemas.end());
+    if(isNewSchema) // also if the hash of a different layout is equal
+    {
+      ObjectSchema& newSchema = schemas.emplace_back();
+      newSchema.id = ++m_objectSchemaCount;
+      for(const auto& [name, item] : object->interfaceItems())
+        if(!item.isInternal())
+          newSchema.names.emplace_back(name);
+      schemaIt = std::prev(schemas.end());
+    }
+    ObjectSchema& schema = *schemaIt;
+
     message.write(handle);
     message.write(object->getClassId());
-
-    message.writeBlock(); // items
-    const InterfaceItems& interfaceItems = object->interfaceItems();
-    for(const auto& name : interfaceItems.names())
+    message.write(schema.id);
+    message.write(isNewSchema);
+    if(isNewSchema)
+      writeObjectSchema(message, *object);
+
+    message.writeBlock(); // values
+    size_t index = 0;
+    for(const auto& [name, item] : object->interfaceItems())
     {
-      InterfaceItem& item = interfaceItems[name];
-
       if(item.isInternal())
         continue;
 
       message.writeBlock(); // item
-      message.write(name);
 
-      if(auto* baseProperty = dynamic_cast<BaseProperty*>(&item))
+      if(auto* property = dynamic_cast<AbstractProperty*>(&item))
       {
-        AbstractProperty* property = nullptr;
-        AbstractUnitProperty* unitProperty = nullptr;
-        AbstractVectorProperty* vectorProperty = nullptr;
-
-        if((property = dynamic_cast<AbstractProperty*>(baseProperty)))
-        {
-          if((unitProperty = dynamic_cast<AbstractUnitProperty*>(property)))
-            message.write(InterfaceItemType::UnitProperty);
-          else
-            message.write(InterfaceItemType::Property);
-        }
-        else if((vectorProperty = dynamic_cast<AbstractVectorProperty*>(baseProperty)))
-          message.write(InterfaceItemType::VectorProperty);
-        else
-        {
-          assert(false);
-          continue;
-        }
-
-        message.write(baseProperty->flags());
-        message.write(baseProperty->type());
-
-        if(baseProperty->type() == ValueType::Enum)
-          message.write(baseProperty->enumName());
-        else if(baseProperty->type() == ValueType::Set)
-          message.write(baseProperty->setName());
-
-        if(property)
-        {
-          writePropertyValue(message, *property);
-
-          if(unitProperty)
-          {
-            message.write(unitProperty->unitName());
-            message.write(unitProperty->unitValue());
-          }
-        }
-        else if(vectorProperty)
-          writeVectorPropertyValue(message, *vectorProperty);
-        else
-          assert(false);
+        writePropertyValue(message, *property);
+        if(auto* unitProperty = dynamic_cast<AbstractUnitProperty*>(property))
+          message.write(unitProperty->unitValue());
       }
-      else if(const auto* method = dynamic_cast<const AbstractMethod*>(&item))
-      {
-        message.write(InterfaceItemType::Method);
-        message.write(method->resultTypeInfo().type);
-        message.write(static_cast<uint8_t>(method->argumentTypeInfo().size()));
-        for(const auto& info : method->argumentTypeInfo())
-          message.write(info.type);
-      }
-      else if(const auto* event = dynamic_cast<const AbstractEvent*>(&item))
-      {
+      else if(auto* vectorProperty = dynamic_cast<AbstractVectorProperty*>(&item))
+        writeVectorPropertyValue(message, *vectorProperty);
+      else if(dynamic_cast<const AbstractEvent*>(&item))
         hasPublicEvents = true;
 
-        message.write(InterfaceItemType::Event);
-        message.write(static_cast<uint8_t>(event->argumentTypeInfo().size()));
-        for(const auto& typeInfo : event->argumentTypeInfo())
-          writeTypeInfo(message, typeInfo);
-      }
-      else
-        assert(false);
-
+      // attributes, only if they differ from the ones sent with the schema:
+      const uint32_t attributesFlag = message.dataSize();
+      message.write(true);
+      const uint32_t attributesBegin = message.dataSize();
       message.writeBlock(); // attributes
-
       for(const auto& it : item.attributes())
       {
-        const AbstractAttribute& attribute = *it.second;
         message.writeBlock(); // attribute
-        writeAttribute(message, attribute);
+        writeAttribute(message, *it.second);
         message.writeBlockEnd(); // end attribute
       }
-
       message.writeBlockEnd(); // end attributes
+
+      const auto* attributes = static_cast<const uint8_t*>(message.data()) + attributesBegin;
+      const size_t attributesSize = message.dataSize() - attributesBegin;
+      if(isNewSchema)
+      {
+        schema.attributes.emplace_back(attributes, attributes + attributesSize);
+      }
+      else if(index < schema.attributes.size() && std::equal(attributes, attributes + attributesSize, schema.attributes[index].begin(), schema.attributes[index].end()))
+      {
+        message.truncate(attributesFlag);
+        message.write(false);
+      }
+      index++;
+
       message.writeBlockEnd(); // end item
     }
-    message.writeBlockEnd(); // end items
+    message.writeBlockEnd(); // end values
 
     if(hasPublicEvents)
       m_objectSignals.emplace(handle, object->onEventFired.connect(std::bind(&Session::objectEventFired, this, std::placeholders::_1, std::placeholders::_2)));
@@ -1015,6 +1060,147 @@ void Session::writeObject(Message& message, const ObjectPtr& object)
   message.writeBlockEnd(); // end object
 }
 
+bool Session::isObjectSchema(const ObjectSchema& schema, const Object& object)
+{
+  size_t index = 0;
+  for(const auto& [name, item] : object.interfaceItems())
+  {
+    if(item.isInternal())
+      continue;
+    if(index >= schema.names.size() || schema.names[index] != name)
+      return false;
+    index++;
+  }
+  return index == schema.names.size();
+}
+
+void Session::writeObjectSchema(Message& message, const Object& object)
+{
+  message.writeBlock(); // items
+  for(const auto& [name, item] : object.interfaceItems())
+  {
+    if(item.isInternal())
+      continue;
+
+    message.writeBlock(); // item
+    message.write(name);
+    message.write(item.index()); // used instead of the name in property/attribute changed and event fired messages
+
+    if(const auto* baseProperty = dynamic_cast<const BaseProperty*>(&item))
+    {
+      const auto* unitProperty = dynamic_cast<const AbstractUnitProperty*>(baseProperty);
+
+      if(unitProperty)
+        message.write(InterfaceItemType::UnitProperty);
+      else if(dynamic_cast<const AbstractProperty*>(baseProperty))
+        message.write(InterfaceItemType::Property);
+      else
+      {
+        assert(dynamic_cast<const AbstractVectorProperty*>(baseProperty));
+        message.write(InterfaceItemType::VectorProperty);
+      }
+
+      message.write(baseProperty->flags());
+      message.write(baseProperty->type());
+
+      if(baseProperty->type() == ValueType::Enum)
+        message.write(baseProperty->enumName());
+      else if(baseProperty->type() == ValueType::Set)
+        message.write(baseProperty->setName());
+
+      if(unitProperty)
+        message.write(unitProperty->unitName());
+    }
+    else if(const auto* method = dynamic_cast<const AbstractMethod*>(&item))
+    {
+      message.write(InterfaceItemType::Method);
+      message.write(method->resultTypeInfo().type);
+      message.write(static_cast<uint8_t>(method->argumentTypeInfo().size()));
+      for(const auto& info : method->argumentTypeInfo())
+        message.write(info.type);
+    }
+    else if(const auto* event = dynamic_cast<const AbstractEvent*>(&item))
+    {
+      message.write(InterfaceItemType::Event);
+      message.write(static_cast<uint8_t>(event->argumentTypeInfo().size()));
+      for(const auto& typeInfo : event->argumentTypeInfo())
+        writeTypeInfo(message, typeInfo);
+    }
+    else
+      assert(false);
+
+    message.writeBlockEnd(); // end item
+  }
+  message.writeBlockEnd(); // end items
+}
+
+//! \brief Hash of everything writeObjectSchema() writes, so it doesn't have to be serialized to find a known schema.
+uint64_t Session::objectSchemaHash(const Object& object)
+{
+  uint64_t hash = 0;
+  const auto add =
+    [&hash](uint64_t value)
+    {
+      hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+    };
+  const auto addString =
+    [&add](std::string_view value)
+    {
+      add(std::hash<std::string_view>{}(value));
+    };
+  const auto addTypeInfo =
+    [&add, &addString](const TypeInfo& typeInfo)
+    {
+      add(static_cast<uint64_t>(typeInfo.type));
+      if(typeInfo.type == ValueType::Enum)
+        addString(typeInfo.enumName);
+      else if(typeInfo.type == ValueType::Set)
+        addString(typeInfo.setName);
+    };
+
+  for(const auto& [name, item] : object.interfaceItems())
+  {
+    if(item.isInternal())
+      continue;
+
+    addString(name);
+    add(item.index());
+
+    if(const auto* baseProperty = dynamic_cast<const BaseProperty*>(&item))
+    {
+      const auto* unitProperty = dynamic_cast<const AbstractUnitProperty*>(baseProperty);
+
+      add(static_cast<uint64_t>(unitProperty ? InterfaceItemType::UnitProperty : (dynamic_cast<const AbstractProperty*>(baseProperty) ? InterfaceItemType::Property : InterfaceItemType::VectorProperty)));
+      add(static_cast<uint64_t>(baseProperty->flags()));
+      add(static_cast<uint64_t>(baseProperty->type()));
+
+      if(baseProperty->type() == ValueType::Enum)
+        addString(baseProperty->enumName());
+      else if(baseProperty->type() == ValueType::Set)
+        addString(baseProperty->setName());
+
+      if(unitProperty)
+        addString(unitProperty->unitName());
+    }
+    else if(const auto* method = dynamic_cast<const AbstractMethod*>(&item))
+    {
+      add(static_cast<uint64_t>(InterfaceItemType::Method));
+      add(static_cast<uint64_t>(method->resultTypeInfo().type));
+      add(method->argumentTypeInfo().size());
+      for(const auto& info : method->argumentTypeInfo())
+        add(static_cast<uint64_t>(info.type));
+    }
+    else if(const auto* event = dynamic_cast<const AbstractEvent*>(&item))
+    {
+      add(static_cast<uint64_t>(InterfaceItemType::Event));
+      add(event->argumentTypeInfo().size());
+      for(const auto& typeInfo : event->argumentTypeInfo())
+        addTypeInfo(typeInfo);
+    }
+  }
+  return hash;
+}
+
 void Session::writeTableModel(Message& message, const TableModelPtr& model)
 {
   message.writeBlock(); // model
@@ -1026,9 +1212,127 @@ void Session::writeTableModel(Message& message, const TableModelPtr& model)
   for(const auto& text : model->columnHeaders())
     message.write(text);
   message.write(model->rowCount());
+  message.write(model->isViewSupported());
   message.writeBlockEnd(); // end model
 }
 
+void Session::tableModelChanged(const TableModelPtr& model, const TableModel::Region& region)
+{
+  m_tableModels[m_handles.getHandle(std::dynamic_pointer_cast<Object>(model))].changed.emplace_back(region);
+
+  if(m_tableModelUpdatePending)
+    return;
+
+  // all changes of this event loop turn are sent together, at most maxTableUpdateRate times per second:
+  m_tableModelUpdatePending = true;
+  const auto rate = std::max<uint8_t>(Traintastic::instance->settings->maxTableUpdateRate, 1);
+  m_tableModelUpdateTimer.expires_at(m_tableModelUpdateLast + std::chrono::microseconds(1'000'000 / rate));
+  m_tableModelUpdateTimer.async_wait(
+    [weak=weak_from_this()](const boost::system::error_code& ec)
+    {
+      if(!ec)
+      {
+        if(auto session = weak.lock())
+        {
+          session->flushTableModelUpdates();
+        }
+      }
+    });
+}
+
+void Session::flushTableModelUpdates()
+{
+  assert(isEventLoopThread());
+
+  m_tableModelUpdatePending = false;
+  m_tableModelUpdateLast = std::chrono::steady_clock::now();
+
+  std::vector<uint64_t> cells;
+  std::vector<std::pair<uint64_t, TableModel::Value>> updates;
+
+  for(auto& [handle, state] : m_tableModels)
+  {
+    if(state.changed.empty())
+      continue;
+
+    auto model = std::dynamic_pointer_cast<TableModel>(m_handles.getItem(handle));
+    if(!model || model->columnCount() == 0 || model->rowCount() == 0)
+    {
+      state.changed.clear();
+      continue;
+    }
+
+    // only cells in the region the client shows are sent, in row/column order:
+    const auto& region = model->region();
+    cells.clear();
+    for(const auto& changed : state.changed)
+    {
+      const uint32_t columnMin = std::max(changed.columnMin, region.columnMin);
+      const uint32_t columnMax = std::min({changed.columnMax, region.columnMax, model->columnCount() - 1});
+      const uint32_t rowMin = std::max(changed.rowMin, region.rowMin);
+      const uint32_t rowMax = std::min({changed.rowMax, region.rowMax, model->rowCount() - 1});
+
+      for(uint64_t row = rowMin; row <= rowMax; row++)
+        for(uint32_t column = columnMin; column <= columnMax; column++)
+          cells.emplace_back((row << 32) | column);
+    }
+    state.changed.clear();
+
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+    // skip cells the client already has the value of:
+    updates.clear();
+    for(const uint64_t cell : cells)
+    {
+      auto value = model->getValue(static_cast<uint32_t>(cell), static_cast<uint32_t>(cell >> 32));
+      auto it = state.values.find(cell);
+      if(it == state.values.end())
+        state.values.emplace(cell, value);
+      else if(it->second != value)
+        it->second = value;
+      else
+        continue;
+      updates.emplace_back(cell, std::move(value));
+    }
+
+    if(updates.empty())
+      continue;
+
+    auto event = Message::newEvent(Message::Command::TableModelUpdateRegion);
+    event->write(handle);
+    event->write(static_cast<uint32_t>(updates.size()));
+    for(const auto& [cell, value] : updates)
+    {
+      event->write(static_cast<uint32_t>(cell)); // column
+      event->write(static_cast<uint32_t>(cell >> 32)); // row
+      writeTableModelValue(*event, value);
+    }
+    sendMessage(std::move(event));
+  }
+}
+
+void Session::writeTableModelValue(Message& message, const TableModel::Value& value)
+{
+  std::visit(
+    [&message](const auto& v)
+    {
+      using T = std::decay_t<decltype(v)>;
+      if constexpr(std::is_same_v<T, bool>)
+        message.write(ValueType::Boolean);
+      else if constexpr(std::is_same_v<T, int64_t>)
+        message.write(ValueType::Integer);
+      else if constexpr(std::is_same_v<T, double>)
+        message.write(ValueType::Float);
+      else
+      {
+        static_assert(std::is_same_v<T, std::string>);
+        message.write(ValueType::String);
+      }
+      message.write(v);
+    }, value);
+}
+
 void Session::memoryLoggerChanged(const MemoryLogger& logger, const uint32_t added, const uint32_t removed)
 {
   auto event = Message::newEvent(Message::Command::ServerLog);
@@ -1042,24 +1346,26 @@ void Session::memoryLoggerChanged(const MemoryLogger& logger, const uint32_t add
     event->write((std::chrono::duration_cast<std::chrono::microseconds>(log.time.time_since_epoch())).count());
     event->write(log.objectId);
     event->write(log.message);
-    const size_t argc = log.args ? std::min<size_t>(log.args->size(), std::numeric_limits<uint8_t>::max()) : 0;
+    const size_t argc = std::min<size_t>(log.args.size(), std::numeric_limits<uint8_t>::max());
     event->write(static_cast<uint8_t>(argc));
     for(size_t j = 0; j < argc; j++)
-      event->write(log.args->at(j));
+      event->write(log.args[j]);
   }
 
-  m_connection->sendMessage(std::move(event));
+  sendMessage(std::move(event));
 }
 
 void Session::objectDestroying(Object& object)
 {
+  discardChangedProperties(object);
+
   const auto handle = m_handles.getHandle(object.shared_from_this());
   m_handles.removeHandle(handle);
   m_objectSignals.erase(handle);
 
   auto event = Message::newEvent(Message::Command::ObjectDestroyed, sizeof(Handle));
   event->write(handle);
-  m_connection->sendMessage(std::move(event));
+  sendMessage(std::move(event));
 }
 
 void Session::objectPropertyChanged(BaseProperty& baseProperty)
@@ -1067,25 +1373,92 @@ void Session::objectPropertyChanged(BaseProperty& baseProperty)
   if(baseProperty.isInternal())
     return;
 
-  auto event = Message::newEvent(Message::Command::ObjectPropertyChanged);
-  event->write(m_handles.getHandle(baseProperty.object().shared_from_this()));
-  event->write(baseProperty.name());
-  event->write(baseProperty.type());
+  // only remember which property changed, the value is read when the changes are flushed,
+  // so multiple changes during one event loop turn result in a single update with the last value.
+  if(m_changedPropertiesSet.insert(&baseProperty).second)
+  {
+    m_changedProperties.emplace_back(&baseProperty);
+  }
+
+  if(!m_flushChangedPropertiesPending)
+  {
+    m_flushChangedPropertiesPending = true;
+    EventLoop::call(
+      [weak=weak_from_this()]()
+      {
+        if(auto session = weak.lock())
+        {
+          session->flushChangedProperties();
+        }
+      });
+  }
+}
+
+void Session::writePropertyChanged(Message& message, BaseProperty& baseProperty)
+{
+  message.write(m_handles.getHandle(baseProperty.object().shared_from_this()));
+  message.write(baseProperty.index());
+  message.write(baseProperty.type());
   if(auto* property = dynamic_cast<AbstractProperty*>(&baseProperty))
   {
-    writePropertyValue(*event, *property);
+    writePropertyValue(message, *property);
 
     if(auto* unitProperty = dynamic_cast<AbstractUnitProperty*>(property))
-      event->write(unitProperty->unitValue());
+      message.write(unitProperty->unitValue());
   }
   else if(auto* vectorProperty = dynamic_cast<AbstractVectorProperty*>(&baseProperty))
-    writeVectorPropertyValue(*event, *vectorProperty);
+    writeVectorPropertyValue(message, *vectorProperty);
   else
     assert(false);
+}
+
+void Session::flushChangedProperties()
+{
+  assert(isEventLoopThread());
+
+  m_flushChangedPropertiesPending = false;
+
+  if(m_changedProperties.empty())
+    return;
+
+  std::unique_ptr<Message> event;
+  if(m_changedProperties.size() == 1)
+  {
+    event = Message::newEvent(Message::Command::ObjectPropertyChanged);
+    writePropertyChanged(*event, *m_changedProperties.front());
+  }
+  else
+  {
+    event = Message::newEvent(Message::Command::ObjectPropertiesChanged);
+    event->write(static_cast<uint32_t>(m_changedProperties.size()));
+    for(auto* property : m_changedProperties)
+    {
+      event->writeBlock(); // property
+      writePropertyChanged(*event, *property);
+      event->writeBlockEnd(); // end property
+    }
+  }
+
+  m_changedProperties.clear();
+  m_changedPropertiesSet.clear();
 
   m_connection->sendMessage(std::move(event));
 }
 
+void Session::discardChangedProperties(const Object& object)
+{
+  std::erase_if(m_changedProperties,
+    [this, &object](const BaseProperty* property)
+    {
+      if(&property->object() == &object)
+      {
+        m_changedPropertiesSet.erase(property);
+        return true;
+      }
+      return false;
+    });
+}
+
 void Session::writePropertyValue(Message& message , const AbstractProperty& property)
 {
   switch(property.type())
@@ -1168,16 +1541,16 @@ void Session::objectAttributeChanged(AbstractAttribute& attribute)
 {
   auto event = Message::newEvent(Message::Command::ObjectAttributeChanged);
   event->write(m_handles.getHandle(attribute.item().object().shared_from_this()));
-  event->write(attribute.item().name());
+  event->write(attribute.item().index());
   writeAttribute(*event, attribute);
-  m_connection->sendMessage(std::move(event));
+  sendMessage(std::move(event));
 }
 
 void Session::objectEventFired(const AbstractEvent& event, const Arguments& arguments)
 {
   auto message = Message::newEvent(Message::Command::ObjectEventFired);
   message->write(m_handles.getHandle(event.object().shared_from_this()));
-  message->write(event.name());
+  message->write(event.index());
   message->write(static_cast<uint32_t>(arguments.size()));
   size_t i = 0;
   for(const auto& typeInfo : event.argumentTypeInfo())
@@ -1215,7 +1588,7 @@ void Session::objectEventFired(const AbstractEvent& event, const Arguments& argu
     }
     i++;
   }
-  m_connection->sendMessage(std::move(message));
+  sendMessage(std::move(message));
 }
 
 void Session::writeAttribute(Message& message , const AbstractAttribute& attribute)
@@ -1311,5 +1684,5 @@ void Session::boardTileDataChanged(Board& board, const TileLocation& location, c
     assert(tile);
     writeObject(*event, tile);
   }
-  m_connection->sendMessage(std::move(event));
+  sendMessage(std::move(event));
 }
@@ -22,18 +22,25 @@
 #ifndef TRAINTASTIC_SERVER_NETWORK_SESSION_HPP
 #define TRAINTASTIC_SERVER_NETWORK_SESSION_HPP
 
+#include <chrono>
+#include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <boost/asio/steady_timer.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/signals2/connection.hpp>
 #include <traintastic/network/message.hpp>
 #include <traintastic/enum/tristate.hpp>
 #include "handlelist.hpp"
 #include "../core/objectptr.hpp"
-#include "../core/tablemodelptr.hpp"
+#include "../core/tablemodel.hpp"
 #include "../core/argument.hpp"
 
 class ClientConnection;
 class MemoryLogger;
+class Object;
 class BaseProperty;
 class AbstractProperty;
 class AbstractVectorProperty;
@@ -57,8 +64,31 @@ class Session : public std::enable_shared_from_this<Session>
     static void writeVectorPropertyValue(Message& message, const AbstractVectorProperty& vectorProperty);
     static void writeAttribute(Message& message, const AbstractAttribute& attribute);
     static void writeTypeInfo(Message& message, const TypeInfo& typeInfo);
+    static void writeObjectSchema(Message& message, const Object& object);
+    static uint64_t objectSchemaHash(const Object& object);
+    static void writeTableModelValue(Message& message, const TableModel::Value& value);
+
+    //! \brief Object schema known by the client, see writeObject()
+    struct ObjectSchema
+    {
+      uint32_t id;
+      std::vector<std::string> names; //!< item names, to tell schemas with the same hash apart
+      std::vector<std::vector<uint8_t>> attributes; //!< serialized attributes per item, as sent with the first object
+    };
+
+    std::map<std::pair<std::string_view, uint64_t>, std::vector<ObjectSchema>> m_objectSchemas; //!< key: class id and objectSchemaHash()
+    uint32_t m_objectSchemaCount = 0;
+
+    static bool isObjectSchema(const ObjectSchema& schema, const Object& object);
 
     boost::signals2::scoped_connection m_memoryLoggerChanged;
+    std::vector<BaseProperty*> m_changedProperties; //!< properties changed during this event loop turn, in order of first change
+    std::unordered_set<const BaseProperty*> m_changedPropertiesSet;
+    bool m_flushChangedPropertiesPending = false;
+
+    void writePropertyChanged(Message& message, BaseProperty& baseProperty);
+    void flushChangedProperties();
+    void discardChangedProperties(const Object& object);
 
   protected:
     using Handle = uint32_t;
@@ -69,7 +99,20 @@ class Session : public std::enable_shared_from_this<Session>
     Handles m_handles;
     std::unordered_multimap<Handle, boost::signals2::scoped_connection> m_objectSignals;
 
+    //! \brief Table model update state, see tableModelChanged()
+    struct TableModelState
+    {
+      std::vector<TableModel::Region> changed; //!< regions changed since the last update
+      std::unordered_map<uint64_t, TableModel::Value> values; //!< cell values known by the client, key: row << 32 | column
+    };
+
+    std::unordered_map<Handle, TableModelState> m_tableModels;
+    boost::asio::steady_timer m_tableModelUpdateTimer;
+    std::chrono::steady_clock::time_point m_tableModelUpdateLast;
+    bool m_tableModelUpdatePending = false;
+
     bool processMessage(const Message& message);
+    void sendMessage(std::unique_ptr<Message> message);
 
     bool isSessionObject(const ObjectPtr& object);
 
@@ -78,6 +121,9 @@ class Session : public std::enable_shared_from_this<Session>
     void writeObject(Message& message, const ObjectPtr& object);
     void writeTableModel(Message& message, const TableModelPtr& model);
 
+    void tableModelChanged(const TableModelPtr& model, const TableModel::Region& region);
+    void flushTableModelUpdates();
+
     void memoryLoggerChanged(const MemoryLogger& logger, uint32_t added, uint32_t removed);
 
     void objectDestroying(Object& object);
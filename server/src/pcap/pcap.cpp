@@ -21,22 +21,111 @@
  */
 
 #include "pcap.hpp"
-#include <chrono>
+#include <cassert>
+#include <cstring>
+#include <utility>
+#include "../core/eventloop.hpp"
+#include "../log/log.hpp"
+#include "../utils/setthreadname.hpp"
 
-void PCAP::writeHeader(uint32_t network)
+PCAP::PCAP(std::string logId, uint32_t network)
+  : m_logId{std::move(logId)}
+  , m_network{network}
+{
+  m_buffer.reserve(bufferSize);
+  m_writeBuffer.reserve(bufferSize);
+}
+
+PCAP::~PCAP()
+{
+  assert(!m_thread.joinable()); // derived class must call stopWriter()
+}
+
+void PCAP::writeHeader()
 {
   GlobalHeader header;
   header.thiszone = 0; //! \todo set system timezone offset
   header.sigfigs = 0;
   header.snaplen = 255;
-  header.network = network;
+  header.network = m_network;
   write(&header, sizeof(header));
 }
 
+void PCAP::startWriter()
+{
+  assert(!m_thread.joinable());
+  m_thread = std::thread(&PCAP::run, this);
+}
+
+void PCAP::stopWriter()
+{
+  if(!m_thread.joinable())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_wakeup.notify_one();
+  m_thread.join();
+}
+
 void PCAP::writeRecord(const void* data, uint32_t size)
 {
   const auto us = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
-  RecordHeader header{static_cast<uint32_t>(us / 1'000'000), static_cast<uint32_t>(us % 1'000'000), size, size};
-  write(&header, sizeof(header));
-  write(data, size);
+  const RecordHeader header{static_cast<uint32_t>(us / 1'000'000), static_cast<uint32_t>(us % 1'000'000), size, size};
+
+  bool wakeup;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const size_t offset = m_buffer.size();
+    if(offset + sizeof(header) + size > bufferSizeMax) [[unlikely]]
+    {
+      m_dropped++; // writer can't keep up, drop record
+      return;
+    }
+    m_buffer.resize(offset + sizeof(header) + size);
+    std::memcpy(m_buffer.data() + offset, &header, sizeof(header));
+    std::memcpy(m_buffer.data() + offset + sizeof(header), data, size);
+    wakeup = (m_buffer.size() >= bufferSize);
+  }
+
+  if(wakeup)
+    m_wakeup.notify_one();
+}
+
+void PCAP::run()
+{
+  setThreadName("pcap");
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  for(;;)
+  {
+    m_wakeup.wait_for(lock, flushInterval, [this]() { return m_stop || m_buffer.size() >= bufferSize; });
+    const bool stop = m_stop;
+    std::swap(m_buffer, m_writeBuffer);
+    const uint32_t dropped = std::exchange(m_dropped, 0);
+    lock.unlock();
+
+    if(dropped != 0) [[unlikely]]
+    {
+      EventLoop::call(
+        [logId=m_logId, dropped]()
+        {
+          Log::log(logId, LogMessage::W2029_PCAP_DROPPED_X_RECORDS, std::to_string(dropped));
+        });
+    }
+
+    if(!m_writeBuffer.empty())
+    {
+      write(m_writeBuffer.data(), m_writeBuffer.size());
+      m_writeBuffer.clear();
+    }
+    flush();
+
+    if(stop)
+      break;
+
+    lock.lock();
+  }
 }
@@ -25,7 +25,20 @@
 
 #include <cstdint>
 #include <cstdlib>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
 
+//! \brief PCAP capture writer base.
+//!
+//! writeRecord() only appends the record to a memory buffer, a background thread writes
+//! the buffer every flush interval or as soon as it exceeds bufferSize. Derived classes
+//! must call startWriter() at the end of their constructor and stopWriter() in their
+//! destructor, so the writer thread never uses a (partly) destructed object.
+//! Records that don't fit in the buffer are dropped, their number is logged once per flush.
 class PCAP
 {
   private:
@@ -48,15 +61,34 @@ class PCAP
       uint32_t orig_len; //!< actual length of packet
     };
 
+    const std::string m_logId;
+    const uint32_t m_network;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::vector<std::byte> m_buffer; //!< filled by writeRecord()
+    std::vector<std::byte> m_writeBuffer; //!< written by the writer thread
+    uint32_t m_dropped = 0; //!< records dropped since the last flush
+    bool m_stop = false;
+    std::thread m_thread;
+
+    void run();
+
   protected:
-    PCAP() = default;
+    static constexpr std::chrono::milliseconds flushInterval{1000};
+    static constexpr size_t bufferSize = 64 * 1024; //!< wake the writer when the buffer exceeds this size
+    static constexpr size_t bufferSizeMax = 16 * 1024 * 1024; //!< records are dropped if the writer can't keep up
+
+    PCAP(std::string logId, uint32_t network);
 
-    void writeHeader(uint32_t network);
+    void writeHeader();
+    void startWriter();
+    void stopWriter();
 
     virtual void write(const void* buffer, size_t size) = 0;
+    virtual void flush() {}
 
   public:
-    virtual ~PCAP() = default;
+    virtual ~PCAP();
 
     void writeRecord(const void* data, uint32_t size);
 };
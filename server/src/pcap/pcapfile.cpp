@@ -21,26 +21,56 @@
  */
 
 #include "pcapfile.hpp"
+#include "../utils/rotatefile.hpp"
 
-PCAPFile::PCAPFile(const std::filesystem::path& filename, uint32_t network)
+PCAPFile::PCAPFile(std::string logId, const std::filesystem::path& filename, uint32_t network, const Options& options)
+  : PCAP(std::move(logId), network)
+  , m_filename{filename}
+  , m_options{options}
 {
   // try create directory if it doesn't exist
-  const auto path = filename.parent_path();
+  const auto path = m_filename.parent_path();
   if(!std::filesystem::is_directory(path))
     std::filesystem::create_directories(path);
 
-  m_stream.open(filename, std::ios::binary | std::ios::out | std::ios::trunc);
-
-  writeHeader(network);
+  open();
+  startWriter();
 }
 
 PCAPFile::~PCAPFile()
 {
+  stopWriter();
   m_stream.close();
 }
 
 void PCAPFile::write(const void* buffer, size_t size)
 {
   m_stream.write(reinterpret_cast<const char*>(buffer), size);
+  m_size += size;
+}
+
+void PCAPFile::flush()
+{
   m_stream.flush();
+
+  if((m_options.rotateSize != 0 && m_size >= m_options.rotateSize) ||
+      (m_options.rotateInterval.count() != 0 && std::chrono::steady_clock::now() - m_opened >= m_options.rotateInterval))
+  {
+    rotate();
+  }
+}
+
+void PCAPFile::open()
+{
+  m_stream.open(m_filename, std::ios::binary | std::ios::out | std::ios::trunc);
+  m_size = 0;
+  m_opened = std::chrono::steady_clock::now();
+  writeHeader();
+}
+
+void PCAPFile::rotate()
+{
+  m_stream.close();
+  rotateFile(m_filename, m_options.rotateCount);
+  open();
 }
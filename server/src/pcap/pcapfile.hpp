@@ -27,17 +27,41 @@
 #include <filesystem>
 #include <fstream>
 
+//! \brief PCAP capture to file, with optional size and/or time based rotation.
+//!
+//! When rotating the current file is renamed to <tt>name.1.pcap</tt> (older files are shifted,
+//! the oldest is removed) and a new capture file is started.
 class PCAPFile final : public PCAP
 {
+  public:
+    struct Options
+    {
+      uintmax_t rotateSize = 0; //!< in bytes, zero disables size based rotation
+      std::chrono::seconds rotateInterval{0}; //!< zero disables time based rotation
+      uint8_t rotateCount = 5; //!< number of rotated files to keep
+    };
+
   private:
+    const std::filesystem::path m_filename;
+    const Options m_options;
     std::ofstream m_stream;
+    uintmax_t m_size = 0;
+    std::chrono::steady_clock::time_point m_opened;
+
+    void open();
+    void rotate();
 
   protected:
     void write(const void* buffer, size_t size) final;
+    void flush() final;
 
   public:
-    PCAPFile(const std::filesystem::path& filename, uint32_t network);
-    ~PCAPFile();
+    PCAPFile(std::string logId, const std::filesystem::path& filename, uint32_t network, const Options& options);
+    PCAPFile(std::string logId, const std::filesystem::path& filename, uint32_t network)
+      : PCAPFile(std::move(logId), filename, network, Options())
+    {
+    }
+    ~PCAPFile() final;
 };
 
 #endif
@@ -28,8 +28,9 @@
   #include <sys/stat.h>
 #endif
 
-PCAPPipe::PCAPPipe(std::filesystem::path filename, uint32_t network)
-  : m_filename{std::move(filename)}
+PCAPPipe::PCAPPipe(std::string logId, std::filesystem::path filename, uint32_t network)
+  : PCAP(std::move(logId), network)
+  , m_filename{std::move(filename)}
 {
   // try create directory if it doesn't exist
   const auto path = m_filename.parent_path();
@@ -47,11 +48,13 @@ PCAPPipe::PCAPPipe(std::filesystem::path filename, uint32_t network)
   m_stream.open(m_filename, std::ios::binary | std::ios::out);
 #endif
 
-  writeHeader(network);
+  writeHeader();
+  startWriter();
 }
 
 PCAPPipe::~PCAPPipe()
 {
+  stopWriter();
   m_stream.close();
   std::filesystem::remove(m_filename);
 }
@@ -60,3 +63,8 @@ void PCAPPipe::write(const void* buffer, size_t size)
 {
   m_stream.write(reinterpret_cast<const char*>(buffer), size);
 }
+
+void PCAPPipe::flush()
+{
+  m_stream.flush();
+}
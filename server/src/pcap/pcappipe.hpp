@@ -35,10 +35,11 @@ class PCAPPipe final : public PCAP
 
   protected:
     void write(const void* buffer, size_t size) final;
+    void flush() final;
 
   public:
-    PCAPPipe(std::filesystem::path filename, uint32_t network);
-    ~PCAPPipe();
+    PCAPPipe(std::string logId, std::filesystem::path filename, uint32_t network);
+    ~PCAPPipe() final;
 };
 
 #endif
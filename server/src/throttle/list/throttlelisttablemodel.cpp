@@ -69,44 +69,39 @@ ThrottleListTableModel::ThrottleListTableModel(ThrottleList& list) :
   setColumnHeaders(std::move(labels));
 }
 
-std::string ThrottleListTableModel::getText(uint32_t column, uint32_t row) const
+std::string ThrottleListTableModel::getItemText(uint32_t column, const Throttle& throttle) const
 {
-  if(row < rowCount())
+  assert(column < m_columns.size());
+  switch(m_columns[column])
   {
-    const Throttle& throttle = getItem(row);
-
-    assert(column < m_columns.size());
-    switch(m_columns[column])
-    {
-      case ThrottleListColumn::Name:
-        return throttle.name;
+    case ThrottleListColumn::Name:
+      return throttle.name;
 
-      case ThrottleListColumn::Train:
-        if(throttle.train)
-        {
-          return throttle.train->name;
-        }
-        return {};
+    case ThrottleListColumn::Train:
+      if(throttle.train)
+      {
+        return throttle.train->name;
+      }
+      return {};
 
-      case ThrottleListColumn::Interface:
-        if(const auto* interfaceProperty = throttle.getObjectProperty("interface"); interfaceProperty)
+    case ThrottleListColumn::Interface:
+      if(const auto* interfaceProperty = throttle.getObjectProperty("interface"); interfaceProperty)
+      {
+        if(const auto& interface = std::dynamic_pointer_cast<Object>(interfaceProperty->toObject()))
         {
-          if(const auto& interface = std::dynamic_pointer_cast<Object>(interfaceProperty->toObject()))
-          {
-            if(auto* property = interface->getProperty("name"); property && !property->toString().empty())
-              return property->toString();
+          if(auto* property = interface->getProperty("name"); property && !property->toString().empty())
+            return property->toString();
 
-            return interface->getObjectId();
-          }
-        }
-        else if(dynamic_cast<const WebThrottle*>(&throttle))
-        {
-          return "WebThrottle";
+          return interface->getObjectId();
         }
-        return "";
-    }
-    assert(false);
+      }
+      else if(dynamic_cast<const WebThrottle*>(&throttle))
+      {
+        return "WebThrottle";
+      }
+      return "";
   }
+  assert(false);
 
   return "";
 }
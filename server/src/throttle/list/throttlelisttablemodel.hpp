@@ -48,7 +48,7 @@ class ThrottleListTableModel : public ObjectListTableModel<Throttle>
 
     ThrottleListTableModel(ThrottleList& list);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const Throttle& throttle) const final;
 };
 
 #endif
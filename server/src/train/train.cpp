@@ -21,6 +21,7 @@
 
 #include "train.hpp"
 #include "trainlist.hpp"
+#include "trainmotionscheduler.hpp"
 #include "trainvehiclelist.hpp"
 #include "../world/world.hpp"
 #include "trainblockstatus.hpp"
@@ -30,7 +31,6 @@
 #include "../core/method.tpp"
 #include "../core/objectproperty.tpp"
 #include "../core/objectvectorproperty.tpp"
-#include "../core/eventloop.hpp"
 #include "../board/tile/rail/blockrailtile.hpp"
 #include "../vehicle/rail/poweredrailvehicle.hpp"
 #include "../hardware/decoder/decoder.hpp"
@@ -64,7 +64,7 @@ static inline bool isPowered(const RailVehicle& vehicle)
 
 Train::Train(World& world, std::string_view _id) :
   IdObject(world, _id),
-  m_speedTimer{EventLoop::ioContext()},
+  m_motionIndex{TrainMotionScheduler::noIndex},
   name{this, "name", id, PropertyFlags::ReadWrite | PropertyFlags::Store | PropertyFlags::ScriptReadOnly},
   length{*this, "length", 0, LengthUnit::MilliMeter, PropertyFlags::ReadWrite | PropertyFlags::Store},
   overrideLength{this, "override_length", false, PropertyFlags::ReadWrite | PropertyFlags::Store,
@@ -96,30 +96,10 @@ Train::Train(World& world, std::string_view _id) :
   speedMax{*this, "speed_max", 0, SpeedUnit::KiloMeterPerHour, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::ScriptReadOnly},
   speedLimit{*this, "speed_limit", SpeedLimitProperty::noLimitValue, SpeedUnit::KiloMeterPerHour, PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::ScriptReadOnly},
   throttleSpeed{*this, "throttle_speed", 0, SpeedUnit::KiloMeterPerHour, PropertyFlags::ReadWrite | PropertyFlags::StoreState,
-    [this](double value, SpeedUnit unit)
+    [this](double /*value*/, SpeedUnit /*unit*/)
     {
-      const double currentSpeed = speed.getValue(unit);
-
       emergencyStop.setValueInternal(false);
-
-      if(value > currentSpeed) // Accelerate
-      {
-        if(m_speedState == SpeedState::Accelerate)
-          return;
-
-        m_speedTimer.cancel();
-        m_speedState = SpeedState::Accelerate;
-        updateSpeed();
-      }
-      else if(value < currentSpeed) // brake
-      {
-        if(m_speedState == SpeedState::Braking)
-          return;
-
-        m_speedTimer.cancel();
-        m_speedState = SpeedState::Braking;
-        updateSpeed();
-      }
+      updateSpeed();
     }},
   stop{*this, "stop", MethodFlags::ScriptCallable,
     [this]()
@@ -131,8 +111,7 @@ Train::Train(World& world, std::string_view _id) :
     {
       if(value)
       {
-        m_speedState = SpeedState::Idle;
-        m_speedTimer.cancel();
+        m_world.trainMotionScheduler().remove(*this);
         throttleSpeed.setValueInternal(0);
         speed.setValueInternal(0);
         isStopped.setValueInternal(true);
@@ -370,6 +349,7 @@ void Train::addToWorld()
 
 void Train::destroying()
 {
+  m_world.trainMotionScheduler().remove(*this);
   auto self = shared_ptr<Train>();
   for(const auto& vehicle : *vehicles)
   {
@@ -439,57 +419,43 @@ void Train::setSpeed(const double kmph)
   updateEnabled();
 }
 
-void Train::updateSpeed()
+void Train::setMotionSpeed(double mps, std::vector<std::shared_ptr<Decoder>>& changedDecoders)
 {
-  if(m_speedState == SpeedState::Idle)
-    return;
-
-  if(m_speedState == SpeedState::Accelerate && !active)
-    return;
-
-  const double targetSpeed = throttleSpeed.getValue(SpeedUnit::MeterPerSecond);
-  double currentSpeed = speed.getValue(SpeedUnit::MeterPerSecond);
-
-  double acceleration = 0;
-  if(m_speedState == SpeedState::Accelerate)
-  {
-    //! \todo add realistic acceleration
-    acceleration = accelerationRate; // m/s^2
-  }
-  else if(m_speedState == SpeedState::Braking)
+  const double kmph = convertUnit(mps, SpeedUnit::MeterPerSecond, SpeedUnit::KiloMeterPerHour);
+  for(const auto& vehicle : m_poweredVehicles)
   {
-    //! \todo add realistic braking
-    acceleration = -brakingRate; // m/s^2
+    if(auto decoder = vehicle->setSpeedDeferred(kmph))
+    {
+      changedDecoders.emplace_back(std::move(decoder));
+    }
   }
-  else
-    assert(false);
+  speed.setValueInternal(convertUnit(kmph, SpeedUnit::KiloMeterPerHour, speed.unit()));
+  updateIsStopped();
+}
 
-  currentSpeed += acceleration * 0.1; // x 100ms
+void Train::updateSpeed()
+{
+  const double targetSpeed = throttleSpeed.getValue(SpeedUnit::MeterPerSecond);
+  const double currentSpeed = speed.getValue(SpeedUnit::MeterPerSecond);
 
-  if((m_speedState == SpeedState::Accelerate && currentSpeed >= targetSpeed) ||
-      (m_speedState == SpeedState::Braking && currentSpeed <= targetSpeed))
-  {
-    m_speedState = SpeedState::Idle;
-    setSpeed(convertUnit(targetSpeed, SpeedUnit::MeterPerSecond, SpeedUnit::KiloMeterPerHour));
-    currentSpeed = targetSpeed;
-  }
-  else
+  if(targetSpeed > currentSpeed && !active)
+    return; // only an active train can accelerate
+
+  if(targetSpeed != currentSpeed || m_motionIndex != TrainMotionScheduler::noIndex)
   {
-    using namespace std::literals;
-    setSpeed(convertUnit(currentSpeed, SpeedUnit::MeterPerSecond, SpeedUnit::KiloMeterPerHour));
-    m_speedTimer.expires_after(100ms);
-    m_speedTimer.async_wait(
-      [this](const boost::system::error_code& ec)
-      {
-        if(!ec)
-          updateSpeed();
-      });
+    m_world.trainMotionScheduler().update(*this);
   }
+  updateIsStopped();
+}
 
-  const bool currentValue = isStopped;
-  isStopped.setValueInternal(m_speedState == SpeedState::Idle && almostZero(currentSpeed) && almostZero(targetSpeed));
-  if(currentValue != isStopped)
+void Train::updateIsStopped()
+{
+  const bool value = m_motionIndex == TrainMotionScheduler::noIndex && almostZero(speed.value()) && almostZero(throttleSpeed.value());
+  if(value != isStopped)
+  {
+    isStopped.setValueInternal(value);
     updateEnabled();
+  }
 }
 
 void Train::vehiclesChanged()
@@ -686,15 +652,8 @@ std::error_code Train::setSpeed(Throttle& throttle, double value)
 
   setSpeed(convertUnit(value, speed.unit(), SpeedUnit::KiloMeterPerHour));
   throttleSpeed.setValue(convertUnit(value, speed.unit(), throttleSpeed.unit()));
-  m_speedTimer.cancel();
-  m_speedState = SpeedState::Idle;
-
-  const bool currentValue = isStopped;
-  isStopped.setValueInternal(m_speedState == SpeedState::Idle && almostZero(speed.value()) && almostZero(throttleSpeed.value()));
-  if(currentValue != isStopped)
-  {
-    updateEnabled();
-  }
+  m_world.trainMotionScheduler().remove(*this);
+  updateIsStopped();
   return {};
 }
 
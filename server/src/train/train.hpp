@@ -23,7 +23,6 @@
 #define TRAINTASTIC_SERVER_TRAIN_TRAIN_HPP
 
 #include "../core/idobject.hpp"
-#include <boost/asio/steady_timer.hpp>
 #include <traintastic/enum/blocktraindirection.hpp>
 #include <traintastic/enum/trainmode.hpp>
 #include "../core/event.hpp"
@@ -42,28 +41,24 @@ class BlockRailTile;
 class PoweredRailVehicle;
 class Zone;
 class Throttle;
+class Decoder;
 
 class Train : public IdObject
 {
   friend class TrainVehicleList;
   friend class TrainTracking;
+  friend class TrainMotionScheduler;
 
   private:
-    enum class SpeedState
-    {
-      Idle,
-      Accelerate,
-      Braking,
-    };
-
     std::vector<std::shared_ptr<PoweredRailVehicle>> m_poweredVehicles;
 
-    boost::asio::steady_timer m_speedTimer;
-    SpeedState m_speedState = SpeedState::Idle;
+    size_t m_motionIndex; //!< Index in TrainMotionScheduler, TrainMotionScheduler::noIndex if not in motion.
     std::shared_ptr<Throttle> m_throttle;
 
     void setSpeed(double kmph);
+    void setMotionSpeed(double mps, std::vector<std::shared_ptr<Decoder>>& changedDecoders);
     void updateSpeed();
+    void updateIsStopped();
 
     void vehiclesChanged();
     void updateLength();
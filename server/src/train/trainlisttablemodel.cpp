@@ -60,36 +60,31 @@ TrainListTableModel::TrainListTableModel(TrainList& list) :
     });
 }
 
-std::string TrainListTableModel::getText(uint32_t column, uint32_t row) const
+std::string TrainListTableModel::getItemText(uint32_t column, const Train& train) const
 {
-  if(row < rowCount())
+  switch(column)
   {
-    const Train& train = getItem(row);
+    case columnId:
+      return train.id;
 
-    switch(column)
-    {
-      case columnId:
-        return train.id;
+    case columnName:
+      return train.name;
 
-      case columnName:
-        return train.name;
+    case columnActive:
+      return train.active ? UTF8_CHECKMARK : "";
 
-      case columnActive:
-        return train.active ? UTF8_CHECKMARK : "";
+    case columnBlock:
+      return !train.blocks.empty() ? train.blocks[0]->block->name.value() : std::string{};
 
-      case columnBlock:
-        return !train.blocks.empty() ? train.blocks[0]->block->name.value() : std::string{};
+    case columnLength:
+      return toString(train.length);
 
-      case columnLength:
-        return toString(train.length);
+    case columnWeight:
+      return toString(train.weight);
 
-      case columnWeight:
-        return toString(train.weight);
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
@@ -42,7 +42,7 @@ class TrainListTableModel : public ObjectListTableModel<Train>
 
     TrainListTableModel(TrainList& list);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const Train& train) const final;
 };
 
 #endif
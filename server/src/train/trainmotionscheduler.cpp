@@ -0,0 +1,237 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "trainmotionscheduler.hpp"
+#include <algorithm>
+#include "train.hpp"
+#include "../core/eventloop.hpp"
+#include "../hardware/decoder/decoder.hpp"
+#include "../vehicle/rail/poweredrailvehicle.hpp"
+#include "../world/world.hpp"
+
+namespace {
+
+constexpr double rollingResistance = 0.015; //!< [m/s²], about 1.5 kN per ton
+constexpr double airResistance = 0.00006; //!< [1/m], multiplied by speed squared
+constexpr double accelerationMinRatio = 0.1; //!< Minimum acceleration as ratio of the acceleration rate, so the target speed is always reached.
+
+inline double resistance(double speed)
+{
+  return rollingResistance + airResistance * speed * speed;
+}
+
+}
+
+double TrainMotionScheduler::acceleration(const Motion& motion)
+{
+  if(motion.speed < motion.targetSpeed)
+  {
+    double a = motion.accelerationRate;
+    if(motion.powerPerMass > 0 && motion.speed > 0)
+    {
+      a = std::min(a, motion.powerPerMass / motion.speed); // F = P / v
+    }
+    a -= resistance(motion.speed);
+    return std::max(a, motion.accelerationRate * accelerationMinRatio);
+  }
+  if(motion.speed > motion.targetSpeed)
+  {
+    return -(motion.brakingRate + resistance(motion.speed));
+  }
+  return 0;
+}
+
+TrainMotionScheduler::TrainMotionScheduler(World& world)
+  : m_world{world}
+  , m_timer{EventLoop::ioContext()}
+{
+}
+
+TrainMotionScheduler::~TrainMotionScheduler()
+{
+  m_timer.cancel();
+  for(auto& motion : m_motions)
+  {
+    motion.train->m_motionIndex = noIndex;
+  }
+}
+
+void TrainMotionScheduler::update(Train& train)
+{
+  if(train.m_motionIndex == noIndex)
+  {
+    train.m_motionIndex = m_motions.size();
+    auto& motion = m_motions.emplace_back();
+    motion.train = &train;
+    motion.speed = train.speed.getValue(SpeedUnit::MeterPerSecond);
+  }
+
+  auto& motion = m_motions[train.m_motionIndex];
+  assert(motion.train == &train);
+  motion.targetSpeed = train.throttleSpeed.getValue(SpeedUnit::MeterPerSecond);
+  motion.accelerationRate = train.accelerationRate;
+  motion.brakingRate = train.brakingRate;
+
+  double watt = 0;
+  for(const auto& vehicle : train.m_poweredVehicles)
+  {
+    watt += vehicle->power.getValue(PowerUnit::Watt);
+  }
+  const double kg = train.weight.getValue(WeightUnit::KiloGram);
+  motion.powerPerMass = (watt > 0 && kg > 0) ? watt / kg : 0;
+
+  if(!m_timerActive)
+  {
+    startTimer();
+  }
+}
+
+void TrainMotionScheduler::remove(Train& train)
+{
+  if(train.m_motionIndex != noIndex)
+  {
+    erase(train.m_motionIndex);
+  }
+}
+
+void TrainMotionScheduler::startTimer()
+{
+  const auto interval = std::chrono::milliseconds(m_world.trainMotionInterval.value());
+  if(m_timerActive)
+  {
+    m_timer.expires_at(m_timer.expiry() + interval); // fixed tick, don't drift
+  }
+  else
+  {
+    m_timer.expires_after(interval);
+    m_timerActive = true;
+  }
+  m_timer.async_wait(
+    [this](const boost::system::error_code& ec)
+    {
+      if(!ec)
+      {
+        tick();
+      }
+    });
+}
+
+void TrainMotionScheduler::tick()
+{
+  const double dt = m_world.trainMotionInterval.value() / 1000.0; // s
+
+  // advance all trains:
+  assert(m_speeds.empty());
+  for(size_t i = 0; i < m_motions.size();)
+  {
+    auto& motion = m_motions[i];
+
+    if(motion.speed < motion.targetSpeed && !motion.train->active)
+    {
+      motion.targetSpeed = motion.speed; // inactive trains can't accelerate
+    }
+
+    if(const double a = acceleration(motion); a > 0)
+    {
+      motion.speed = std::min(motion.speed + a * dt, motion.targetSpeed);
+    }
+    else if(a < 0)
+    {
+      motion.speed = std::max(motion.speed + a * dt, motion.targetSpeed);
+    }
+
+    m_speeds.emplace_back(motion.train->shared_ptr<Train>(), motion.speed);
+
+    if(motion.speed == motion.targetSpeed)
+    {
+      erase(i); // target speed reached
+    }
+    else
+    {
+      i++;
+    }
+  }
+
+  // apply new speeds, this can (indirectly) add or remove trains:
+  for(const auto& [train, speed] : m_speeds)
+  {
+    train->setMotionSpeed(speed, m_changedDecoders);
+  }
+  m_speeds.clear();
+
+  notifyDecoderControllers();
+
+  if(!m_motions.empty())
+  {
+    startTimer();
+  }
+  else
+  {
+    m_timerActive = false;
+  }
+}
+
+void TrainMotionScheduler::erase(size_t index)
+{
+  assert(index < m_motions.size());
+  m_motions[index].train->m_motionIndex = noIndex;
+  if(index != m_motions.size() - 1)
+  {
+    m_motions[index] = m_motions.back();
+    m_motions[index].train->m_motionIndex = index;
+  }
+  m_motions.pop_back();
+}
+
+void TrainMotionScheduler::notifyDecoderControllers()
+{
+  if(m_changedDecoders.empty())
+  {
+    return;
+  }
+
+  // group by interface:
+  std::sort(m_changedDecoders.begin(), m_changedDecoders.end(),
+    [](const auto& a, const auto& b)
+    {
+      return a->interface.value() < b->interface.value();
+    });
+
+  auto first = m_changedDecoders.begin();
+  while(first != m_changedDecoders.end())
+  {
+    const auto& controller = (*first)->interface.value();
+    const auto last = std::find_if(first, m_changedDecoders.end(),
+      [&controller](const auto& decoder)
+      {
+        return decoder->interface.value() != controller;
+      });
+
+    if(controller)
+    {
+      controller->decoderThrottlesChanged({first, last});
+    }
+    first = last;
+  }
+
+  m_changedDecoders.clear();
+}
@@ -0,0 +1,92 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef TRAINTASTIC_SERVER_TRAIN_TRAINMOTIONSCHEDULER_HPP
+#define TRAINTASTIC_SERVER_TRAIN_TRAINMOTIONSCHEDULER_HPP
+
+#include <limits>
+#include <memory>
+#include <vector>
+#include <boost/asio/steady_timer.hpp>
+
+class World;
+class Train;
+class Decoder;
+
+/**
+ * \brief Updates the speed of all accelerating and braking trains
+ *
+ * All trains in motion are advanced in one pass at a fixed interval (World::trainMotionInterval),
+ * the resulting decoder throttle changes are handed to each interface as one batch.
+ */
+class TrainMotionScheduler
+{
+  public:
+    static constexpr size_t noIndex = std::numeric_limits<size_t>::max();
+
+    struct Motion
+    {
+      Train* train;
+      double speed; //!< Current speed [m/s]
+      double targetSpeed; //!< [m/s]
+      double accelerationRate; //!< Maximum (adhesion limited) acceleration [m/s²]
+      double brakingRate; //!< [m/s²]
+      double powerPerMass; //!< Tractive power per mass [W/kg], zero if unknown
+    };
+
+    //! \brief Acceleration model
+    //! Acceleration is limited by the acceleration rate at low speed and by the tractive power at higher speed,
+    //! rolling and air resistance reduce acceleration and add to braking.
+    //! \return Acceleration [m/s²], negative when braking
+    static double acceleration(const Motion& motion);
+
+  private:
+    World& m_world;
+    boost::asio::steady_timer m_timer;
+    bool m_timerActive = false;
+    std::vector<Motion> m_motions;
+    std::vector<std::pair<std::shared_ptr<Train>, double>> m_speeds;
+    std::vector<std::shared_ptr<Decoder>> m_changedDecoders;
+
+    void startTimer();
+    void tick();
+    void erase(size_t index);
+    void notifyDecoderControllers();
+
+  public:
+    TrainMotionScheduler(World& world);
+    ~TrainMotionScheduler();
+
+    //! \brief Number of trains in motion
+    inline size_t size() const
+    {
+      return m_motions.size();
+    }
+
+    //! \brief Add train or update its target speed and rates
+    void update(Train& train);
+
+    //! \brief Remove train, its speed is no longer updated
+    void remove(Train& train);
+};
+
+#endif
@@ -21,6 +21,7 @@
  */
 
 #include "settings.hpp"
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include "../core/attributes.hpp"
@@ -60,7 +61,11 @@ Settings::PreStart Settings::getPreStartSettings(const std::filesystem::path& pa
       PreStart preStart;
       preStart.memoryLoggerSize = settings.value(Name::memoryLoggerSize, Default::memoryLoggerSize);
       preStart.enableFileLogger = settings.value(Name::enableFileLogger, Default::enableFileLogger);
+      preStart.fileLoggerFlushInterval = std::clamp(settings.value(Name::fileLoggerFlushInterval, Default::fileLoggerFlushInterval), fileLoggerFlushIntervalMin, fileLoggerFlushIntervalMax);
+      preStart.fileLoggerRotateSize = std::min(settings.value(Name::fileLoggerRotateSize, Default::fileLoggerRotateSize), fileLoggerRotateSizeMax);
       preStart.language = settings.value(Name::language, Default::language);
+      preStart.ioThreadPoolSize = std::min(settings.value(Name::ioThreadPoolSize, Default::ioThreadPoolSize), ioThreadPoolSizeMax);
+      preStart.ioThreadPoolCpuPinning = settings.value(Name::ioThreadPoolCpuPinning, Default::ioThreadPoolCpuPinning);
       return preStart;
     }
     catch(const std::exception& e)
@@ -91,8 +96,13 @@ Settings::Settings(const std::filesystem::path& path)
   , saveWorldUncompressed{this, "save_world_uncompressed", false, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
   , allowClientServerRestart{this, "allow_client_server_restart", false, PropertyFlags::ReadWrite | PropertyFlags::Internal, [this](const bool& /*value*/){ saveToFile(); }}
   , allowClientServerShutdown{this, "allow_client_server_shutdown", false, PropertyFlags::ReadWrite | PropertyFlags::Internal, [this](const bool& /*value*/){ saveToFile(); }}
+  , maxTableUpdateRate{this, "max_table_update_rate", 20, PropertyFlags::ReadWrite, [this](const uint8_t& /*value*/){ saveToFile(); }}
   , memoryLoggerSize{this, Name::memoryLoggerSize, Default::memoryLoggerSize, PropertyFlags::ReadWrite, [this](const uint32_t& /*value*/){ saveToFile(); }}
   , enableFileLogger{this, Name::enableFileLogger, Default::enableFileLogger, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
+  , fileLoggerFlushInterval{this, Name::fileLoggerFlushInterval, Default::fileLoggerFlushInterval, PropertyFlags::ReadWrite, [this](const uint16_t& /*value*/){ saveToFile(); }}
+  , fileLoggerRotateSize{this, Name::fileLoggerRotateSize, Default::fileLoggerRotateSize, PropertyFlags::ReadWrite, [this](const uint16_t& /*value*/){ saveToFile(); }}
+  , ioThreadPoolSize{this, Name::ioThreadPoolSize, Default::ioThreadPoolSize, PropertyFlags::ReadWrite, [this](const uint8_t& /*value*/){ saveToFile(); }}
+  , ioThreadPoolCpuPinning{this, Name::ioThreadPoolCpuPinning, Default::ioThreadPoolCpuPinning, PropertyFlags::ReadWrite, [this](const bool& /*value*/){ saveToFile(); }}
 {
   m_interfaceItems.add(language);
   m_interfaceItems.add(lastWorld);
@@ -116,15 +126,32 @@ Settings::Settings(const std::filesystem::path& path)
   m_interfaceItems.add(allowClientServerRestart);
   Attributes::addCategory(allowClientServerShutdown, Category::network);
   m_interfaceItems.add(allowClientServerShutdown);
+  Attributes::addCategory(maxTableUpdateRate, Category::network);
+  Attributes::addMinMax(maxTableUpdateRate, maxTableUpdateRateMin, maxTableUpdateRateMax);
+  Attributes::addUnit(maxTableUpdateRate, "Hz");
+  m_interfaceItems.add(maxTableUpdateRate);
 
   Attributes::addCategory(memoryLoggerSize, Category::log);
   Attributes::addMinMax(memoryLoggerSize, 0U, memoryLoggerSizeMax);
   m_interfaceItems.add(memoryLoggerSize);
   Attributes::addCategory(enableFileLogger, Category::log);
   m_interfaceItems.add(enableFileLogger);
+  Attributes::addCategory(fileLoggerFlushInterval, Category::log);
+  Attributes::addMinMax(fileLoggerFlushInterval, fileLoggerFlushIntervalMin, fileLoggerFlushIntervalMax);
+  Attributes::addUnit(fileLoggerFlushInterval, "ms");
+  m_interfaceItems.add(fileLoggerFlushInterval);
+  Attributes::addCategory(fileLoggerRotateSize, Category::log);
+  Attributes::addMinMax(fileLoggerRotateSize, uint16_t{0}, fileLoggerRotateSizeMax);
+  Attributes::addUnit(fileLoggerRotateSize, "MiB");
+  m_interfaceItems.add(fileLoggerRotateSize);
 
   Attributes::addCategory(saveWorldUncompressed, Category::developer);
   m_interfaceItems.add(saveWorldUncompressed);
+  Attributes::addCategory(ioThreadPoolSize, Category::developer);
+  Attributes::addMinMax(ioThreadPoolSize, uint8_t{0}, ioThreadPoolSizeMax);
+  m_interfaceItems.add(ioThreadPoolSize);
+  Attributes::addCategory(ioThreadPoolCpuPinning, Category::developer);
+  m_interfaceItems.add(ioThreadPoolCpuPinning);
 
   loadFromFile();
 }
@@ -32,19 +32,33 @@ class Settings : public Object
   private:
     static constexpr std::string_view filename = "settings.json";
     static constexpr uint32_t memoryLoggerSizeMax = 1'000'000;
+    static constexpr uint16_t fileLoggerFlushIntervalMin = 100; // ms
+    static constexpr uint16_t fileLoggerFlushIntervalMax = 10'000; // ms
+    static constexpr uint16_t fileLoggerRotateSizeMax = 1'000; // MiB
+    static constexpr uint8_t maxTableUpdateRateMin = 1; // Hz
+    static constexpr uint8_t maxTableUpdateRateMax = 100; // Hz
+    static constexpr uint8_t ioThreadPoolSizeMax = 64;
 
     struct Name
     {
       static constexpr const char* memoryLoggerSize = "memory_logger_size";
       static constexpr const char* enableFileLogger = "enable_file_logger";
+      static constexpr const char* fileLoggerFlushInterval = "file_logger_flush_interval";
+      static constexpr const char* fileLoggerRotateSize = "file_logger_rotate_size";
       static constexpr const char* language = "language";
+      static constexpr const char* ioThreadPoolSize = "io_thread_pool_size";
+      static constexpr const char* ioThreadPoolCpuPinning = "io_thread_pool_cpu_pinning";
     };
 
     struct Default
     {
       static constexpr uint32_t memoryLoggerSize = 1000;
       static constexpr bool enableFileLogger = false;
+      static constexpr uint16_t fileLoggerFlushInterval = 1'000; // ms
+      static constexpr uint16_t fileLoggerRotateSize = 10; // MiB
       static constexpr std::string_view language = "en-us";
+      static constexpr uint8_t ioThreadPoolSize = 0; // thread per interface
+      static constexpr bool ioThreadPoolCpuPinning = false;
     };
 
     const std::filesystem::path m_filename;
@@ -61,7 +75,11 @@ class Settings : public Object
     {
       uint32_t memoryLoggerSize = Default::memoryLoggerSize;
       bool enableFileLogger = Default::enableFileLogger;
+      uint16_t fileLoggerFlushInterval = Default::fileLoggerFlushInterval;
+      uint16_t fileLoggerRotateSize = Default::fileLoggerRotateSize;
       std::string language{Default::language};
+      uint8_t ioThreadPoolSize = Default::ioThreadPoolSize;
+      bool ioThreadPoolCpuPinning = Default::ioThreadPoolCpuPinning;
     };
 
     static constexpr std::string_view id = classId;
@@ -81,8 +99,13 @@ class Settings : public Object
     Property<bool> saveWorldUncompressed;
     Property<bool> allowClientServerRestart;
     Property<bool> allowClientServerShutdown;
+    Property<uint8_t> maxTableUpdateRate; //!< maximum number of table model updates per second, per client
     Property<uint32_t> memoryLoggerSize;
     Property<bool> enableFileLogger;
+    Property<uint16_t> fileLoggerFlushInterval;
+    Property<uint16_t> fileLoggerRotateSize;
+    Property<uint8_t> ioThreadPoolSize; //!< number of threads shared by all interfaces, zero for a thread per interface, applied on restart
+    Property<bool> ioThreadPoolCpuPinning; //!< applied on restart
 
     Settings(const std::filesystem::path& path);
 
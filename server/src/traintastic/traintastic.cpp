@@ -42,6 +42,7 @@
 #include "../log/log.hpp"
 #include "../log/logmessageexception.hpp"
 #include "../lua/getversion.hpp"
+#include "../lua/scriptlist.hpp"
 
 using nlohmann::json;
 
@@ -89,6 +90,8 @@ Traintastic::Traintastic(const std::filesystem::path& dataDir) :
 #ifndef NDEBUG
       std::weak_ptr<World> weakWorld = world.value();
 #endif
+      if(world)
+        world->waitForSave();
       world = World::create();
 #ifndef NDEBUG
       assert(weakWorld.expired());
@@ -121,6 +124,8 @@ Traintastic::Traintastic(const std::filesystem::path& dataDir) :
 #ifndef NDEBUG
       std::weak_ptr<World> weakWorld = world.value();
 #endif
+      if(world)
+        world->waitForSave();
       world = nullptr;
 #ifndef NDEBUG
       assert(weakWorld.expired());
@@ -190,6 +195,14 @@ std::string Traintastic::getInfo()
       zlibVersion(),
       Lua::getVersion()
     ));
+  if(instance && instance->world && !instance->world->luaScripts->empty())
+  {
+    info.append("\n### Lua scripts ###\n");
+    for(const auto& script : *instance->world->luaScripts)
+    {
+      info.append(script->id.value()).append(": ").append(script->profiler().report());
+    }
+  }
   return info;
 }
 
@@ -200,6 +213,8 @@ void Traintastic::importWorld(const std::vector<std::byte>& worldData)
 #ifndef NDEBUG
     std::weak_ptr<World> weakWorld = world.value();
 #endif
+    if(world)
+      world->waitForSave();
     world = WorldLoader(worldData).world();
 #ifndef NDEBUG
     assert(weakWorld.expired());
@@ -294,9 +309,13 @@ void Traintastic::exit()
   else
     Log::log(*this, LogMessage::N1004_SHUTTING_DOWN);
 
-  if(settings->autoSaveWorldOnExit && world)
+  if(world)
   {
-    world->autoSave();
+    if(settings->autoSaveWorldOnExit)
+    {
+      world->autoSave();
+    }
+    world->waitForSave();
   }
 
   EventLoop::stop();
@@ -317,10 +336,13 @@ void Traintastic::loadWorldPath(const std::filesystem::path& path)
 #ifndef NDEBUG
     std::weak_ptr<World> weakWorld = world.value();
 #endif
+    if(world)
+      world->waitForSave(); // the world being saved may be the one that is loaded
     world = WorldLoader(path).world();
 #ifndef NDEBUG
     assert(weakWorld.expired());
 #endif
+    world->enableStateJournal(path, true);
     settings->lastWorld = world->uuid.value();
     Log::log(*this, LogMessage::N1027_LOADED_WORLD_X, world->name.value());
 
@@ -65,6 +65,7 @@ namespace DisplayName
     constexpr std::string_view node = "hardware:node";
     constexpr std::string_view outputKeyboard = "hardware:output_keyboard";
     constexpr std::string_view outputs = "hardware:outputs";
+    constexpr std::string_view outputScheduler = "hardware:output_scheduler";
     constexpr std::string_view speedSteps = "hardware:speed_steps";
     constexpr std::string_view throttles = "hardware:throttles";
     constexpr std::string_view trackDriver = "hardware:track_driver";
@@ -0,0 +1,94 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_UTILS_MPSCQUEUE_HPP
+#define TRAINTASTIC_SERVER_UTILS_MPSCQUEUE_HPP
+
+#include <atomic>
+
+//! \brief Intrusive lock-free multi producer single consumer queue.
+//!
+//! Based on Dmitry Vyukov's non-intrusive MPSC node based queue, \c T must have a member
+//! <tt>std::atomic<T*> next</tt> and be default constructible (used as stub node).
+//! push() may be called from any thread, pop() only from a single consumer thread.
+//! The queue doesn't own the nodes.
+template<class T>
+class MPSCQueue
+{
+  private:
+    T m_stub;
+    std::atomic<T*> m_head;
+    T* m_tail;
+
+  public:
+    MPSCQueue()
+      : m_head{&m_stub}
+      , m_tail{&m_stub}
+    {
+      m_stub.next.store(nullptr, std::memory_order_relaxed);
+    }
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator =(const MPSCQueue&) = delete;
+
+    void push(T* node)
+    {
+      node->next.store(nullptr, std::memory_order_relaxed);
+      T* prev = m_head.exchange(node, std::memory_order_acq_rel);
+      prev->next.store(node, std::memory_order_release);
+    }
+
+    //! \return Oldest node or \c nullptr if the queue is empty (or a push is in progress).
+    T* pop()
+    {
+      T* tail = m_tail;
+      T* next = tail->next.load(std::memory_order_acquire);
+      if(tail == &m_stub)
+      {
+        if(!next)
+        {
+          return nullptr;
+        }
+        m_tail = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+      }
+      if(next)
+      {
+        m_tail = next;
+        return tail;
+      }
+      if(tail != m_head.load(std::memory_order_acquire))
+      {
+        return nullptr; // a producer is in the middle of a push
+      }
+      push(&m_stub);
+      next = tail->next.load(std::memory_order_acquire);
+      if(next)
+      {
+        m_tail = next;
+        return tail;
+      }
+      return nullptr;
+    }
+};
+
+#endif
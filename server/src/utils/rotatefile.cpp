@@ -0,0 +1,41 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "rotatefile.hpp"
+#include <string>
+
+std::filesystem::path rotatedFilename(const std::filesystem::path& filename, unsigned int n)
+{
+  return filename.parent_path() / (filename.stem() += "." + std::to_string(n)) += filename.extension();
+}
+
+void rotateFile(const std::filesystem::path& filename, unsigned int count)
+{
+  std::error_code ec;
+  std::filesystem::remove(rotatedFilename(filename, count), ec);
+  for(unsigned int n = count; n > 1; n--)
+    std::filesystem::rename(rotatedFilename(filename, n - 1), rotatedFilename(filename, n), ec);
+  if(count > 0)
+    std::filesystem::rename(filename, rotatedFilename(filename, 1), ec);
+  else
+    std::filesystem::remove(filename, ec);
+}
@@ -0,0 +1,36 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#ifndef TRAINTASTIC_SERVER_UTILS_ROTATEFILE_HPP
+#define TRAINTASTIC_SERVER_UTILS_ROTATEFILE_HPP
+
+#include <filesystem>
+
+//! \return Filename of rotated file \a n, e.g. <tt>name.1.ext</tt> for <tt>name.ext</tt>.
+std::filesystem::path rotatedFilename(const std::filesystem::path& filename, unsigned int n);
+
+//! \brief Rename \a filename to <tt>name.1.ext</tt>, older files are shifted and the oldest is removed.
+//!
+//! Keeps at most \a count rotated files, with zero \a filename is removed. Errors are ignored.
+void rotateFile(const std::filesystem::path& filename, unsigned int count);
+
+#endif
@@ -41,7 +41,6 @@ PoweredRailVehicle::PoweredRailVehicle(World& world, std::string_view id_)
 
   Attributes::addDisplayName(power, DisplayName::Vehicle::Rail::power);
   Attributes::addEnabled(power, editable);
-  Attributes::addObjectEditor(power, false); // FIXME: remove once used
   m_interfaceItems.add(power);
 }
 
@@ -62,28 +61,37 @@ void PoweredRailVehicle::setSpeed(double kmph)
   if(!decoder)
     return;
 
+  decoder->throttle.setValue(speedToThrottle(kmph));
+}
+
+std::shared_ptr<Decoder> PoweredRailVehicle::setSpeedDeferred(double kmph)
+{
+  if(decoder && decoder->setThrottleDeferred(speedToThrottle(kmph)))
+    return decoder.value();
+
+  return {};
+}
+
+float PoweredRailVehicle::speedToThrottle(double kmph) const
+{
+  assert(decoder);
+
   if(almostZero(kmph))
-  {
-    decoder->throttle.setValue(0);
-    return;
-  }
+    return 0;
 
   //! \todo Implement speed profile
 
   // No speed profile -> linear
+  const double max = speedMax.getValue(SpeedUnit::KiloMeterPerHour);
+  if(max > 0)
   {
-    const double max = speedMax.getValue(SpeedUnit::KiloMeterPerHour);
-    if(max > 0)
-    {
-      const uint8_t steps = decoder->speedSteps;
-      if(steps == Decoder::speedStepsAuto)
-        decoder->throttle.setValue(kmph / max);
-      else
-        decoder->throttle.setValue(std::round(kmph / max * steps) / steps);
-    }
-    else
-      decoder->throttle.setValue(0);
+    const uint8_t steps = decoder->speedSteps;
+    if(steps == Decoder::speedStepsAuto)
+      return static_cast<float>(kmph / max);
+
+    return static_cast<float>(std::round(kmph / max * steps) / steps);
   }
+  return 0;
 }
 
 void PoweredRailVehicle::worldEvent(WorldState state, WorldEvent event)
@@ -29,6 +29,9 @@
 
 class PoweredRailVehicle : public RailVehicle
 {
+  private:
+    float speedToThrottle(double kmph) const;
+
   protected:
     PoweredRailVehicle(World& world, std::string_view id_);
 
@@ -40,6 +43,10 @@ class PoweredRailVehicle : public RailVehicle
     void setDirection(Direction value);
     void setEmergencyStop(bool value);
     void setSpeed(double kmph);
+
+    //! \brief Set speed, the decoder interface isn't notified
+    //! \return The decoder if its throttle is changed, else \c nullptr
+    std::shared_ptr<Decoder> setSpeedDeferred(double kmph);
 };
 
 #endif
@@ -48,30 +48,25 @@ RailVehicleListTableModel::RailVehicleListTableModel(ObjectList<RailVehicle>& li
     });
 }
 
-std::string RailVehicleListTableModel::getText(uint32_t column, uint32_t row) const
+std::string RailVehicleListTableModel::getItemText(uint32_t column, const RailVehicle& vehicle) const
 {
-  if(row < rowCount())
+  switch(column)
   {
-    const RailVehicle& vehicle = getItem(row);
+    case columnId:
+      return vehicle.id;
 
-    switch(column)
-    {
-      case columnId:
-        return vehicle.id;
+    case columnName:
+      return vehicle.name;
 
-      case columnName:
-        return vehicle.name;
+    case columnType:
+      return std::string("$class_id:").append(vehicle.getClassId()).append("$");
 
-      case columnType:
-        return std::string("$class_id:").append(vehicle.getClassId()).append("$");
+    case columnLength:
+      return toString(vehicle.length);
 
-      case columnLength:
-        return toString(vehicle.length);
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
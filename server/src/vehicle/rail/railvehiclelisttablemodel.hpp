@@ -42,7 +42,7 @@ class RailVehicleListTableModel : public ObjectListTableModel<RailVehicle>
 
     RailVehicleListTableModel(ObjectList<RailVehicle>& list);
 
-    std::string getText(uint32_t column, uint32_t row) const final;
+    std::string getItemText(uint32_t column, const RailVehicle& vehicle) const final;
 };
 
 #endif
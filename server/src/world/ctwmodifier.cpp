@@ -25,11 +25,13 @@
 CTWModifier::CTWModifier(const std::filesystem::path& filename)
   : CTWReader(filename)
 {
+  readAll();
 }
 
 CTWModifier::CTWModifier(const std::vector<std::byte>& memory)
   : CTWReader(memory)
 {
+  readAll();
 }
 
 bool CTWModifier::updateFile(const std::filesystem::path& filename, const nlohmann::json& data)
@@ -37,6 +39,12 @@ bool CTWModifier::updateFile(const std::filesystem::path& filename, const nlohma
   return updateFile(filename, data.dump());
 }
 
+bool CTWModifier::updateFileCBOR(const std::filesystem::path& filename, const nlohmann::json& data)
+{
+  const auto bytes = nlohmann::json::to_cbor(data);
+  return updateFile(filename, {reinterpret_cast<const std::byte*>(bytes.data()), bytes.size()});
+}
+
 bool CTWModifier::updateFile(const std::filesystem::path& filename, const std::string& text)
 {
   return updateFile(filename, {reinterpret_cast<const std::byte*>(text.c_str()), text.size()});
@@ -34,6 +34,7 @@ public:
   CTWModifier(const std::vector<std::byte>& memory);
 
   bool updateFile(const std::filesystem::path& filename, const nlohmann::json& data);
+  bool updateFileCBOR(const std::filesystem::path& filename, const nlohmann::json& data);
   bool updateFile(const std::filesystem::path& filename, const std::string& text);
   bool updateFile(const std::filesystem::path& filename, std::span<const std::byte> bytes);
 
@@ -21,12 +21,111 @@
  */
 
 #include "ctwreader.hpp"
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <istream>
+#include <mutex>
+#include <thread>
 #include <archive.h>
 #include <archive_entry.h>
 #include "libarchiveerror.hpp"
 
 using nlohmann::json;
 
+namespace {
+
+//! Stream buffer that decompresses an archive entry on a separate thread, so decompression and parsing overlap.
+class EntryStreamBuf : public std::streambuf
+{
+private:
+  static constexpr size_t chunkSize = 256 * 1024;
+  static constexpr size_t queueSizeMax = 8;
+
+  archive* m_archive;
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  std::deque<std::vector<char>> m_chunks;
+  std::vector<char> m_chunk;
+  std::exception_ptr m_error;
+  bool m_done = false;
+  bool m_abort = false;
+  std::thread m_thread;
+
+  void run()
+  {
+    try
+    {
+      while(true)
+      {
+        std::vector<char> chunk(chunkSize);
+        const auto count = archive_read_data(m_archive, chunk.data(), chunk.size());
+        if(count < 0)
+          throw LibArchiveError(m_archive);
+        if(count == 0)
+          break;
+        chunk.resize(static_cast<size_t>(count));
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_abort || m_chunks.size() < queueSizeMax; });
+        if(m_abort)
+          return;
+        m_chunks.emplace_back(std::move(chunk));
+        m_condition.notify_all();
+      }
+    }
+    catch(...)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_error = std::current_exception();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_done = true;
+    m_condition.notify_all();
+  }
+
+protected:
+  int_type underflow() final
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_condition.wait(lock, [this]() { return m_done || !m_chunks.empty(); });
+    if(m_chunks.empty())
+    {
+      if(m_error)
+        std::rethrow_exception(m_error);
+      return traits_type::eof();
+    }
+    m_chunk = std::move(m_chunks.front());
+    m_chunks.pop_front();
+    m_condition.notify_all();
+    lock.unlock();
+
+    setg(m_chunk.data(), m_chunk.data(), m_chunk.data() + m_chunk.size());
+    return traits_type::to_int_type(*gptr());
+  }
+
+public:
+  EntryStreamBuf(archive* a)
+    : m_archive{a}
+    , m_thread(&EntryStreamBuf::run, this)
+  {
+  }
+
+  ~EntryStreamBuf() final
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_abort = true; // parser is done or failed, stop decompressing
+    }
+    m_condition.notify_all();
+    m_thread.join();
+  }
+};
+
+}
+
 CTWReader::CTWReader() :
   m_archive{archive_read_new(),
     [](archive* a)
@@ -46,8 +145,6 @@ CTWReader::CTWReader(const std::filesystem::path& filename)
 {
   if(archive_read_open_filename(m_archive.get(), filename.string().c_str(), 10240) != ARCHIVE_OK)
     throw LibArchiveError(m_archive.get());
-
-  readFiles();
 }
 
 CTWReader::CTWReader(const std::vector<std::byte>& memory)
@@ -55,60 +152,147 @@ CTWReader::CTWReader(const std::vector<std::byte>& memory)
 {
   if(archive_read_open_memory(m_archive.get(), memory.data(), memory.size()) != ARCHIVE_OK)
     throw LibArchiveError(m_archive.get());
+}
 
-  readFiles();
+void CTWReader::readAll()
+{
+  findEntry([](std::string_view) { return false; }); // reads all remaining entries
 }
 
-void CTWReader::readFiles()
+std::optional<std::filesystem::path> CTWReader::findFile(std::initializer_list<std::string_view> filenames)
 {
-  // load everything in memory:
-  archive_entry* entry = nullptr;
-  while(true)
-  {
-    const int r = archive_read_next_header(m_archive.get(), &entry);
-    if(r == ARCHIVE_EOF)
-      break;
-    if(r < ARCHIVE_OK)
-      throw LibArchiveError(m_archive.get());
+  for(auto filename : filenames)
+    if(m_files.find(std::string(filename)) != m_files.end())
+      return filename;
 
-    std::vector<std::byte> data;
-    data.resize(archive_entry_size(entry));
+  const auto match =
+    [&filenames](std::string_view name)
+    {
+      return std::find(filenames.begin(), filenames.end(), name) != filenames.end();
+    };
 
-    size_t pos = 0;
-    while(pos < data.size())
+  if(archive_entry* entry = findEntry(match))
+    return archive_entry_pathname(entry);
+
+  return std::nullopt;
+}
+
+archive_entry* CTWReader::findEntry(const std::function<bool(std::string_view)>& match)
+{
+  while(m_archive)
+  {
+    if(!m_entry)
     {
-      const auto count = archive_read_data(m_archive.get(), data.data() + pos, data.size() - pos);
-      if(count < 0)
+      const int r = archive_read_next_header(m_archive.get(), &m_entry);
+      if(r == ARCHIVE_EOF)
+      {
+        m_entry = nullptr;
+        m_archive.reset();
+        break;
+      }
+      if(r < ARCHIVE_OK)
         throw LibArchiveError(m_archive.get());
-      if(count == 0)
-        break; // should not happen
-      pos += static_cast<size_t>(count);
     }
 
-    if(pos == data.size())
-      m_files.emplace(archive_entry_pathname(entry), std::move(data));
+    if(match(archive_entry_pathname(m_entry)))
+      return m_entry; // stays the current entry until its data is read
+
+    // keep it, it might be requested later:
+    std::string name = archive_entry_pathname(m_entry);
+    if(std::vector<std::byte> data; readEntry(data))
+      m_files.emplace(std::move(name), std::move(data));
   }
+  return nullptr;
+}
+
+bool CTWReader::readEntry(std::vector<std::byte>& data)
+{
+  assert(m_entry);
+  data.resize(archive_entry_size(m_entry));
+  m_entry = nullptr;
 
-  m_archive.reset();
+  size_t pos = 0;
+  while(pos < data.size())
+  {
+    const auto count = archive_read_data(m_archive.get(), data.data() + pos, data.size() - pos);
+    if(count < 0)
+      throw LibArchiveError(m_archive.get());
+    if(count == 0)
+      break; // should not happen
+    pos += static_cast<size_t>(count);
+  }
+
+  return pos == data.size();
 }
 
-bool CTWReader::readFile(const std::filesystem::path& filename, nlohmann::json& data)
+template<class Parse>
+bool CTWReader::parseFile(const std::filesystem::path& filename, Parse&& parse)
 {
-  auto it = m_files.find(filename.string());
-  if(it == m_files.end())
+  const auto name = filename.generic_string();
+
+  if(auto it = m_files.find(name); it != m_files.end())
+  {
+    const auto* begin = reinterpret_cast<const char*>(it->second.data());
+    parse(begin, begin + it->second.size());
+    return true;
+  }
+
+  archive_entry* entry = findEntry([&name](std::string_view entryName) { return entryName == name; });
+  if(!entry)
     return false;
 
-  std::string_view sv{reinterpret_cast<const char*>(it->second.data()), it->second.size()};
-  data = json::parse(sv.begin(), sv.end());
+  if(archive_entry_size(entry) < streamSizeMin)
+  {
+    std::vector<std::byte> bytes;
+    if(!readEntry(bytes))
+      return false;
+    const auto* begin = reinterpret_cast<const char*>(bytes.data());
+    parse(begin, begin + bytes.size());
+  }
+  else
+  {
+    m_entry = nullptr; // data is consumed by the stream
+    EntryStreamBuf buffer(m_archive.get());
+    std::istream stream(&buffer);
+    parse(stream);
+  }
   return true;
 }
 
+bool CTWReader::readFile(const std::filesystem::path& filename, nlohmann::json& data, const nlohmann::json::parser_callback_t& callback)
+{
+  return parseFile(filename,
+    [&data, &callback](auto&&... input)
+    {
+      data = json::parse(std::forward<decltype(input)>(input)..., callback);
+    });
+}
+
+bool CTWReader::readFileCBOR(const std::filesystem::path& filename, nlohmann::json& data)
+{
+  return parseFile(filename,
+    [&data](auto&&... input)
+    {
+      data = json::from_cbor(std::forward<decltype(input)>(input)...);
+    });
+}
+
 bool CTWReader::readFile(const std::filesystem::path& filename, std::string& text)
 {
-  auto it = m_files.find(filename.generic_string());
-  if(it == m_files.end())
+  const auto name = filename.generic_string();
+
+  if(auto it = m_files.find(name); it != m_files.end())
+  {
+    text.assign(reinterpret_cast<const char*>(it->second.data()), it->second.size());
+    return true;
+  }
+
+  if(!findEntry([&name](std::string_view entryName) { return entryName == name; }))
     return false;
 
-  text.assign(reinterpret_cast<const char*>(it->second.data()), it->second.size());
+  std::vector<std::byte> bytes;
+  if(!readEntry(bytes))
+    return false;
+  text.assign(reinterpret_cast<const char*>(bytes.data()), bytes.size());
   return true;
 }
@@ -25,28 +25,55 @@
 #include <unordered_map>
 #include <vector>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <string_view>
 #include <traintastic/utils/stdfilesystem.hpp>
 #include <nlohmann/json.hpp>
 
 struct archive;
+struct archive_entry;
 
+/**
+ * \brief Reader for Traintastic world files (.ctw)
+ *
+ * The archive is read forward only, an entry is decompressed when it is requested.
+ * Entries passed while searching are kept in memory, so they can be requested later.
+ * \note When reading from memory, the memory must stay valid while the reader exists.
+ */
 class CTWReader
 {
 public:
   CTWReader(const std::filesystem::path& filename);
   CTWReader(const std::vector<std::byte>& memory);
 
-  bool readFile(const std::filesystem::path& filename, nlohmann::json& data);
+  bool readFile(const std::filesystem::path& filename, nlohmann::json& data, const nlohmann::json::parser_callback_t& callback = nullptr);
+  bool readFileCBOR(const std::filesystem::path& filename, nlohmann::json& data);
   bool readFile(const std::filesystem::path& filename, std::string& text);
 
+  //! \brief Find which of the given files is in the archive, if more are present the first one in the archive is returned.
+  std::optional<std::filesystem::path> findFile(std::initializer_list<std::string_view> filenames);
+
 protected:
-  std::unordered_map<std::string, std::vector<std::byte>> m_files;
+  std::unordered_map<std::string, std::vector<std::byte>> m_files; //!< Files passed while searching, or all files after readAll().
+
+  void readAll();
 
 private:
+  //! Entries larger than this are decompressed on a separate thread while being parsed.
+  static constexpr int64_t streamSizeMin = 1024 * 1024;
+
   std::unique_ptr<archive, void(*)(archive*)> m_archive;
+  archive_entry* m_entry = nullptr; //!< Entry of which the header is read, but not its data.
 
   CTWReader();
-  void readFiles();
+  archive_entry* findEntry(const std::function<bool(std::string_view)>& match);
+  bool readEntry(std::vector<std::byte>& data);
+  template<class Parse>
+  bool parseFile(const std::filesystem::path& filename, Parse&& parse);
 };
 
 #endif
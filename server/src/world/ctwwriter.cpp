@@ -80,6 +80,12 @@ void CTWWriter::writeFile(const std::filesystem::path& filename, const nlohmann:
   writeFile(filename, data.dump());
 }
 
+void CTWWriter::writeFileCBOR(const std::filesystem::path& filename, const nlohmann::json& data)
+{
+  const auto bytes = nlohmann::json::to_cbor(data);
+  writeFile(filename, {reinterpret_cast<const std::byte*>(bytes.data()), bytes.size()});
+}
+
 void CTWWriter::writeFile(const std::filesystem::path& filename, const std::string& text)
 {
   writeFile(filename, {reinterpret_cast<const std::byte*>(text.c_str()), text.size()});
@@ -42,6 +42,7 @@ class CTWWriter
     CTWWriter(std::vector<std::byte>& memory);
 
     void writeFile(const std::filesystem::path& filename, const nlohmann::json& data);
+    void writeFileCBOR(const std::filesystem::path& filename, const nlohmann::json& data);
     void writeFile(const std::filesystem::path& filename, const std::string& text);
     void writeFile(const std::filesystem::path& filename, std::span<const std::byte> bytes);
 };
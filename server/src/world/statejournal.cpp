@@ -0,0 +1,356 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include "statejournal.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+#ifdef WIN32
+  #include <io.h>
+#else
+  #include <unistd.h>
+#endif
+#include "../core/abstractproperty.hpp"
+#include "../core/abstractvectorproperty.hpp"
+#include "../core/eventloop.hpp"
+#include "../core/object.hpp"
+#include "../utils/setthreadname.hpp"
+
+namespace {
+
+constexpr char magic[4] = {'T', 'T', 'S', 'J'};
+constexpr uint8_t version = 1;
+
+using Size = uint32_t;
+using Sequence = uint64_t;
+constexpr size_t recordHeaderSize = sizeof(Size) + sizeof(Sequence);
+
+std::string header(std::string_view worldUUID)
+{
+  std::string data(magic, sizeof(magic));
+  data.push_back(static_cast<char>(version));
+  data.push_back(static_cast<char>(worldUUID.size()));
+  data.append(worldUUID);
+  return data;
+}
+
+nlohmann::json stateValue(const BaseProperty& baseProperty)
+{
+  if(baseProperty.type() == ValueType::Object)
+  {
+    // store object ids, same as in the world file:
+    if(const auto* property = dynamic_cast<const AbstractProperty*>(&baseProperty))
+    {
+      if(ObjectPtr value = property->toObject())
+        return value->getObjectId();
+      return nullptr;
+    }
+
+    if(const auto* vectorProperty = dynamic_cast<const AbstractVectorProperty*>(&baseProperty))
+    {
+      nlohmann::json values(nlohmann::json::value_t::array);
+      for(size_t i = 0; i < vectorProperty->size(); i++)
+      {
+        if(ObjectPtr value = vectorProperty->getObject(i))
+          values.emplace_back(value->getObjectId());
+        else
+          values.emplace_back(nullptr);
+      }
+      return values;
+    }
+  }
+  return baseProperty.toJSON();
+}
+
+}
+
+StateJournal* StateJournal::s_active = nullptr;
+int StateJournal::s_suspended = 0;
+
+std::filesystem::path StateJournal::filename(const std::filesystem::path& worldPath)
+{
+  return std::filesystem::path(worldPath).replace_extension(dotJournal);
+}
+
+uint64_t StateJournal::read(const std::filesystem::path& filename, std::string_view worldUUID, uint64_t sequence, const ReadCallback& callback)
+{
+  std::ifstream file(filename, std::ios::binary);
+  if(!file.is_open())
+    return sequence;
+
+  std::vector<char> data{std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+  std::string_view view{data.data(), data.size()};
+
+  const std::string expectedHeader = header(worldUUID);
+  if(view.substr(0, expectedHeader.size()) != expectedHeader)
+    return sequence; // not a journal or of another world
+
+  view.remove_prefix(expectedHeader.size());
+
+  uint64_t last = sequence;
+  while(view.size() >= recordHeaderSize)
+  {
+    Size size;
+    Sequence recordSequence;
+    std::memcpy(&size, view.data(), sizeof(size));
+    std::memcpy(&recordSequence, view.data() + sizeof(size), sizeof(recordSequence));
+    if(size < sizeof(Sequence) || view.size() - sizeof(Size) < size)
+      break; // incomplete
+
+    const auto payload = view.substr(recordHeaderSize, size - sizeof(Sequence));
+    view.remove_prefix(sizeof(Size) + size);
+
+    const auto values = nlohmann::json::from_cbor(payload.begin(), payload.end(), true, false);
+    if(!values.is_array() || values.size() != 3 || !values[0].is_string() || !values[1].is_string())
+      break; // invalid
+
+    if(recordSequence <= sequence)
+      continue;
+
+    callback(recordSequence, values[0].get<std::string_view>(), values[1].get<std::string_view>(), values[2]);
+    last = std::max(last, recordSequence);
+  }
+
+  return last;
+}
+
+void StateJournal::record(const BaseProperty& property)
+{
+  if(!s_active || s_suspended != 0 || contains(property.flags(), PropertyFlags::SubObject))
+    return;
+
+  s_active->add(property.object().getObjectId(), property.name(), stateValue(property));
+}
+
+StateJournal::StateJournal(std::filesystem::path filename, std::string worldUUID, uint64_t sequence, bool replay)
+  : m_filename{std::move(filename)}
+  , m_worldUUID{std::move(worldUUID)}
+  , m_sequence{sequence}
+  , m_compactSequence{sequence}
+{
+  if(replay)
+  {
+    m_sequence = read(m_filename, m_worldUUID, sequence,
+      [this](uint64_t recordSequence, std::string_view objectId, std::string_view propertyName, const nlohmann::json& value)
+      {
+        addEntry(objectId, propertyName, recordSequence, encode(recordSequence, objectId, propertyName, value));
+      });
+  }
+
+  // start with a compacted journal:
+  std::string records;
+  for(const auto& it : m_entries)
+    records.append(it.second.record);
+  rewrite(records);
+
+  m_thread = std::thread(&StateJournal::run, this);
+}
+
+StateJournal::~StateJournal()
+{
+  if(s_active == this)
+    s_active = nullptr;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_wakeup.notify_one();
+  m_thread.join();
+  close();
+}
+
+void StateJournal::activate()
+{
+  assert(isEventLoopThread());
+  s_active = this;
+}
+
+void StateJournal::add(std::string_view objectId, std::string_view propertyName, const nlohmann::json& value)
+{
+  const uint64_t sequence = ++m_sequence;
+  std::string record = encode(sequence, objectId, propertyName, value);
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_buffer.append(record);
+  addEntry(objectId, propertyName, sequence, std::move(record));
+}
+
+void StateJournal::compact(uint64_t sequence)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_compactSequence = std::max(m_compactSequence, sequence);
+    m_compact = true;
+  }
+  m_wakeup.notify_one();
+}
+
+std::string StateJournal::encode(uint64_t sequence, std::string_view objectId, std::string_view propertyName, const nlohmann::json& value)
+{
+  std::string record(recordHeaderSize, '\0');
+  nlohmann::json::to_cbor(nlohmann::json::array({objectId, propertyName, value}), record);
+  assert(record.size() - sizeof(Size) <= std::numeric_limits<Size>::max());
+  const Size size = static_cast<Size>(record.size() - sizeof(Size));
+  std::memcpy(record.data(), &size, sizeof(size));
+  std::memcpy(record.data() + sizeof(size), &sequence, sizeof(sequence));
+  return record;
+}
+
+void StateJournal::sync(std::FILE* file)
+{
+  std::fflush(file);
+#ifdef WIN32
+  _commit(_fileno(file));
+#else
+  fsync(fileno(file));
+#endif
+}
+
+void StateJournal::addEntry(std::string_view objectId, std::string_view propertyName, uint64_t sequence, std::string record)
+{
+  std::string key;
+  key.reserve(objectId.size() + 1 + propertyName.size());
+  key.append(objectId).append(1, '\n').append(propertyName);
+
+  auto& entry = m_entries[std::move(key)];
+  m_entriesSize += record.size();
+  m_entriesSize -= entry.record.size();
+  entry.sequence = sequence;
+  entry.record = std::move(record);
+}
+
+void StateJournal::run()
+{
+  setThreadName("statejournal");
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  while(!m_stop)
+  {
+    m_wakeup.wait_for(lock, flushInterval, [this]() { return m_stop || m_compact; });
+    write(lock);
+  }
+  write(lock); // remaining
+}
+
+void StateJournal::write(std::unique_lock<std::mutex>& lock)
+{
+  if(!m_compact && m_fileSize > std::max<uintmax_t>(compactSizeMin, 2 * m_entriesSize))
+    m_compact = true; // mostly superseded records
+
+  if(m_compact)
+  {
+    m_compact = false;
+    m_buffer.clear(); // all pending records are in m_entries
+
+    std::vector<const Entry*> entries;
+    for(auto it = m_entries.begin(); it != m_entries.end();)
+    {
+      if(it->second.sequence <= m_compactSequence)
+      {
+        m_entriesSize -= it->second.record.size();
+        it = m_entries.erase(it);
+      }
+      else
+      {
+        entries.emplace_back(&it->second);
+        ++it;
+      }
+    }
+
+    // keep record order, so replaying gives the same result:
+    std::sort(entries.begin(), entries.end(),
+      [](const Entry* a, const Entry* b)
+      {
+        return a->sequence < b->sequence;
+      });
+
+    std::string records;
+    records.reserve(m_entriesSize);
+    for(const auto* entry : entries)
+      records.append(entry->record);
+
+    lock.unlock();
+    rewrite(records);
+    lock.lock();
+  }
+  else if(!m_buffer.empty())
+  {
+    std::string buffer;
+    buffer.swap(m_buffer);
+
+    lock.unlock();
+    if(m_file)
+    {
+      std::fwrite(buffer.data(), 1, buffer.size(), m_file);
+      sync(m_file);
+      m_fileSize += buffer.size();
+    }
+    lock.lock();
+  }
+}
+
+void StateJournal::rewrite(const std::string& records)
+{
+  close();
+
+  // write a new file and replace the journal, so there is always a complete journal on disk:
+  std::filesystem::path tmpFilename = m_filename;
+  tmpFilename += ".tmp";
+
+  if(std::FILE* file = std::fopen(tmpFilename.string().c_str(), "wb"))
+  {
+    const std::string data = header(m_worldUUID);
+    std::fwrite(data.data(), 1, data.size(), file);
+    std::fwrite(records.data(), 1, records.size(), file);
+    sync(file);
+    std::fclose(file);
+
+    std::error_code ec;
+    std::filesystem::rename(tmpFilename, m_filename, ec);
+  }
+
+  open();
+}
+
+void StateJournal::open()
+{
+  assert(!m_file);
+  m_file = std::fopen(m_filename.string().c_str(), "ab");
+  if(m_file)
+  {
+    std::error_code ec;
+    m_fileSize = std::filesystem::file_size(m_filename, ec);
+  }
+}
+
+void StateJournal::close()
+{
+  if(m_file)
+  {
+    sync(m_file);
+    std::fclose(m_file);
+    m_file = nullptr;
+  }
+}
@@ -0,0 +1,148 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#ifndef TRAINTASTIC_SERVER_WORLD_STATEJOURNAL_HPP
+#define TRAINTASTIC_SERVER_WORLD_STATEJOURNAL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <traintastic/utils/stdfilesystem.hpp>
+#include "../utils/json.hpp"
+
+class BaseProperty;
+
+/**
+ * \brief Append-only journal of state property changes.
+ *
+ * Every change of a \ref PropertyFlags::StoreState property is appended to the journal, a writer
+ * thread writes and fsyncs the records in groups every flush interval. When loading a world the
+ * journal is replayed on top of the state stored in the world file, so runtime state survives a
+ * crash without saving the world often.
+ *
+ * Records are numbered, the world file stores the last number included in it. After a successful
+ * save the journal is compacted to the records that aren't part of the saved world. When the journal
+ * grows it is compacted to the last record of every property.
+ *
+ * File layout: magic, version, world UUID, followed by the records. A record is its size (uint32),
+ * its number (uint64) and a CBOR encoded array: object id, property name, value.
+ */
+class StateJournal
+{
+  public:
+    static constexpr std::string_view dotJournal = ".journal";
+    static constexpr std::chrono::milliseconds flushInterval{250};
+    static constexpr uintmax_t compactSizeMin = 1024 * 1024; //!< in bytes
+
+    //! \brief Suspends recording, e.g. while loading a world.
+    class Suspend
+    {
+      public:
+        Suspend() { s_suspended++; }
+        ~Suspend() { s_suspended--; }
+    };
+
+    using ReadCallback = std::function<void(uint64_t sequence, std::string_view objectId, std::string_view propertyName, const nlohmann::json& value)>;
+
+  private:
+    struct Entry
+    {
+      uint64_t sequence;
+      std::string record;
+    };
+
+    static StateJournal* s_active;
+    static int s_suspended;
+
+    const std::filesystem::path m_filename;
+    const std::string m_worldUUID;
+    uint64_t m_sequence; //!< last record number, event loop only
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::string m_buffer; //!< records not yet written
+    std::unordered_map<std::string, Entry> m_entries; //!< last record per property, key: object id + '\n' + property name
+    size_t m_entriesSize = 0; //!< sum of record sizes in m_entries
+    uint64_t m_compactSequence = 0; //!< records up to this number are no longer needed
+    bool m_compact = false;
+    bool m_stop = false;
+    std::thread m_thread;
+
+    // writer thread only (after construction):
+    std::FILE* m_file = nullptr;
+    uintmax_t m_fileSize = 0;
+
+    static std::string encode(uint64_t sequence, std::string_view objectId, std::string_view propertyName, const nlohmann::json& value);
+    static void sync(std::FILE* file);
+
+    void addEntry(std::string_view objectId, std::string_view propertyName, uint64_t sequence, std::string record);
+    void run();
+    void write(std::unique_lock<std::mutex>& lock);
+    void rewrite(const std::string& records);
+    void open();
+    void close();
+
+  public:
+    //! \brief Journal filename for a world saved at \a worldPath.
+    static std::filesystem::path filename(const std::filesystem::path& worldPath);
+
+    /**
+     * \brief Read records from a journal.
+     * \param[in] sequence Only records after this number are passed to \a callback.
+     * \return Number of the last record read, \a sequence if none.
+     *
+     * A journal of another world is ignored, reading stops at the first incomplete or invalid
+     * record (e.g. the last one after a crash).
+     */
+    static uint64_t read(const std::filesystem::path& filename, std::string_view worldUUID, uint64_t sequence, const ReadCallback& callback);
+
+    //! \brief Record a state property change in the active journal.
+    static void record(const BaseProperty& property);
+
+    /**
+     * \param[in] sequence Last record number included in the world file.
+     * \param[in] replay Keep records after \a sequence of an existing journal, else start empty.
+     */
+    StateJournal(std::filesystem::path filename, std::string worldUUID, uint64_t sequence, bool replay);
+    StateJournal(const StateJournal&) = delete;
+    ~StateJournal();
+
+    StateJournal& operator =(const StateJournal&) = delete;
+
+    //! \brief Make this the journal recording all state property changes.
+    void activate();
+
+    //! \brief Last record number.
+    uint64_t sequence() const { return m_sequence; }
+
+    void add(std::string_view objectId, std::string_view propertyName, const nlohmann::json& value);
+
+    //! \brief Drop all records up to and including \a sequence, call after they are saved in the world file.
+    void compact(uint64_t sequence);
+};
+
+#endif
@@ -0,0 +1,133 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include "telemetry.hpp"
+#include <algorithm>
+#include "world.hpp"
+#include "../core/eventloop.hpp"
+#include "../core/property.hpp"
+
+Telemetry::Telemetry(World& world)
+  : m_world{world}
+  , m_timer{EventLoop::ioContext()}
+{
+  add(m_world, eventLoopLatency,
+    [this]()
+    {
+      return m_eventLoopLatency;
+    });
+
+  m_timer.expires_after(sampleInterval);
+  startTimer();
+}
+
+Telemetry::~Telemetry()
+{
+  m_timer.cancel();
+}
+
+void Telemetry::add(const Object& object, std::string_view name, Probe probe)
+{
+  assert(isEventLoopThread());
+  assert(probe);
+  assert(!find(object, name));
+
+  auto& source = m_sources[&object];
+  if(&object != &m_world)
+  {
+    source.object = object.weak_from_this();
+    assert(!source.object.expired());
+  }
+  source.series.emplace_back(Series{std::string(name), std::move(probe), {}});
+}
+
+void Telemetry::add(const Property<float>& property)
+{
+  add(property.object(), property.name(),
+    [&property]()
+    {
+      return property.value();
+    });
+}
+
+void Telemetry::remove(const Object& object)
+{
+  assert(isEventLoopThread());
+  m_sources.erase(&object);
+}
+
+const TimeSeries* Telemetry::find(const Object& object, std::string_view name) const
+{
+  if(auto it = m_sources.find(&object); it != m_sources.end())
+  {
+    auto series = std::find_if(it->second.series.begin(), it->second.series.end(),
+      [name](const Series& item)
+      {
+        return item.name == name;
+      });
+    if(series != it->second.series.end())
+    {
+      return &series->data;
+    }
+  }
+  return nullptr;
+}
+
+void Telemetry::sample(int64_t time)
+{
+  for(auto it = m_sources.begin(); it != m_sources.end();)
+  {
+    if(it->first != &m_world && it->second.object.expired()) // object is gone, without remove()
+    {
+      it = m_sources.erase(it);
+      continue;
+    }
+
+    for(auto& series : it->second.series)
+    {
+      series.data.add(time, series.probe());
+    }
+    ++it;
+  }
+}
+
+void Telemetry::startTimer()
+{
+  m_timer.async_wait(
+    [this](const boost::system::error_code& ec)
+    {
+      if(!ec)
+      {
+        tick();
+      }
+    });
+}
+
+void Telemetry::tick()
+{
+  m_eventLoopLatency = std::chrono::duration<float, std::milli>(Clock::now() - m_timer.expiry()).count();
+
+  sample(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+  m_timer.expires_at(std::max(m_timer.expiry() + sampleInterval, Clock::now())); // fixed tick, don't drift, but don't catch up either
+  startTimer();
+}
@@ -0,0 +1,109 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+
+#ifndef TRAINTASTIC_SERVER_WORLD_TELEMETRY_HPP
+#define TRAINTASTIC_SERVER_WORLD_TELEMETRY_HPP
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <boost/asio/steady_timer.hpp>
+#include "../core/timeseries.hpp"
+
+class World;
+class Object;
+template<typename T>
+class Property;
+
+/**
+ * \brief Keeps history of status values, e.g. booster load or interface message rates
+ *
+ * Every registered probe is sampled once a second into a \ref TimeSeries, series are
+ * identified by the object they belong to and a name. The world itself has the
+ * event loop latency series.
+ *
+ * \note Telemetry must only be used in the event loop thread.
+ */
+class Telemetry
+{
+  public:
+    using Probe = std::function<float()>; //!< returns NaN if there is no value
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr auto sampleInterval = std::chrono::seconds(1);
+    static constexpr std::string_view eventLoopLatency = "event_loop_latency"; //!< [ms]
+
+  private:
+    struct Series
+    {
+      std::string name;
+      Probe probe;
+      TimeSeries data;
+    };
+
+    struct Source
+    {
+      std::weak_ptr<const Object> object; //!< empty for the world
+      std::vector<Series> series;
+    };
+
+    World& m_world;
+    boost::asio::steady_timer m_timer;
+    float m_eventLoopLatency = 0; //!< [ms]
+    std::unordered_map<const Object*, Source> m_sources;
+
+    void startTimer();
+    void tick();
+
+  public:
+    Telemetry(World& world);
+    ~Telemetry();
+
+    /**
+     * \brief Add a series
+     *
+     * \param[in] object Object the series belongs to, the series is removed when the object no longer exists.
+     * \param[in] name Series name, unique per object.
+     * \param[in] probe Called every sample interval.
+     */
+    void add(const Object& object, std::string_view name, Probe probe);
+
+    //! \brief Add a series of a property value, the series name is the property name.
+    void add(const Property<float>& property);
+
+    //! \brief Remove all series of an object
+    void remove(const Object& object);
+
+    //! \return Series or \c nullptr if it doesn't exist.
+    const TimeSeries* find(const Object& object, std::string_view name) const;
+
+    //! \brief Sample all probes
+    //! \param[in] time Seconds since epoch.
+    void sample(int64_t time);
+};
+
+#endif
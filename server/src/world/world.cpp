@@ -27,7 +27,11 @@
 #include <boost/uuid/uuid_io.hpp>
 
 #include "worldsaver.hpp"
+#include "statejournal.hpp"
+#include "telemetry.hpp"
 
+#include "../core/eventloop.hpp"
+#include "../core/timerwheel.hpp"
 #include "../log/log.hpp"
 #include "../log/logmessageexception.hpp"
 #include "../utils/datetimestr.hpp"
@@ -73,6 +77,7 @@
 #include "../throttle/list/throttlelist.hpp"
 #include "../train/train.hpp"
 #include "../train/trainlist.hpp"
+#include "../train/trainmotionscheduler.hpp"
 #include "../vehicle/rail/railvehiclelist.hpp"
 #include "../lua/scriptlist.hpp"
 #include "../status/simulationstatus.hpp"
@@ -154,6 +159,9 @@ void World::init(World& world)
 }
 
 World::World(Private /*unused*/) :
+  m_trainMotionScheduler{std::make_unique<TrainMotionScheduler>(*this)},
+  m_timerWheel{std::make_unique<TimerWheel>()},
+  m_telemetry{std::make_unique<Telemetry>(*this)},
   uuid{this, "uuid", to_string(boost::uuids::random_generator()()), PropertyFlags::ReadOnly | PropertyFlags::NoStore | PropertyFlags::ScriptReadOnly},
   name{this, "name", "", PropertyFlags::ReadWrite | PropertyFlags::Store | PropertyFlags::ScriptReadOnly},
   scale{this, "scale", WorldScale::H0, PropertyFlags::ReadWrite | PropertyFlags::Store | PropertyFlags::ScriptReadOnly, [this](WorldScale /*value*/){ updateScaleRatio(); }},
@@ -178,6 +186,7 @@ World::World(Private /*unused*/) :
   correctOutputPosWhenLocked{this, "correct_output_pos_when_locked", true, PropertyFlags::ReadWrite | PropertyFlags::Store | PropertyFlags::NoScript},
   extOutputChangeAction{this, "ext_output_change_action", ExternalOutputChangeAction::EmergencyStopTrain, PropertyFlags::ReadWrite | PropertyFlags::Store | PropertyFlags::NoScript},
   pathReleaseDelay{this, "path_release_delay", 5000, PropertyFlags::ReadWrite | PropertyFlags::Store | PropertyFlags::NoScript},
+  trainMotionInterval{this, "train_motion_interval", 100, PropertyFlags::ReadWrite | PropertyFlags::Store | PropertyFlags::NoScript},
     featureScripting{this, "feature_scripting", true, PropertyFlags::ReadWrite | PropertyFlags::Store,
     [this](bool value)
     {
@@ -339,6 +348,11 @@ World::World(Private /*unused*/) :
   Attributes::addMinMax(pathReleaseDelay, {0, 15000}); // Up to 15 seconds
   m_interfaceItems.add(pathReleaseDelay);
 
+  Attributes::addCategory(trainMotionInterval, Category::trains);
+  Attributes::addEnabled(trainMotionInterval, true);
+  Attributes::addMinMax(trainMotionInterval, {20, 1000}); // 50 Hz down to 1 Hz
+  m_interfaceItems.add(trainMotionInterval);
+
   // Features:
   Attributes::addCategory(featureScripting, Category::features);
   m_interfaceItems.add(featureScripting);
@@ -444,6 +458,7 @@ World::World(Private /*unused*/) :
 
   m_interfaceItems.add(simulationStatus);
 
+  Attributes::addEnabled(save, true);
   Attributes::addObjectEditor(save, false);
   m_interfaceItems.add(save);
 
@@ -460,6 +475,11 @@ World::World(Private /*unused*/) :
 
 World::~World()
 {
+  if(m_saveThread.joinable())
+    m_saveThread.join();
+
+  m_stateJournal.reset(); // stop recording, destroying objects isn't a state change
+
   luaScripts->stopAll(); // no surprise event actions during destruction
 
   deleteAll(*interfaces);
@@ -683,54 +703,157 @@ void World::setFeature(WorldFeature feature, bool value)
 
 void World::backupAndSave(bool isAutoSave)
 {
+  assert(isEventLoopThread());
+
+  if(m_saveThread.joinable()) // already saving, save again when finished
+  {
+    m_savePending = m_savePending ? (*m_savePending && isAutoSave) : isAutoSave;
+    return;
+  }
+
   try
   {
-    // backup world:
     const std::filesystem::path worldDir = Traintastic::instance->worldDir();
     const std::filesystem::path worldBackupDir = Traintastic::instance->worldBackupDir();
+    const std::string worldUUID = uuid.value();
 
-    if(!std::filesystem::is_directory(worldBackupDir))
-    {
-      std::error_code ec;
-      std::filesystem::create_directories(worldBackupDir, ec);
-      if(ec)
-        Log::log(*this, LogMessage::C1007_CREATING_WORLD_BACKUP_DIRECTORY_FAILED_X, ec);
-    }
-
-    if(std::filesystem::is_directory(worldDir / uuid.value()))
-    {
-      std::error_code ec;
-      std::filesystem::rename(worldDir / uuid.value(), worldBackupDir / uuid.value() += dateTimeStr(), ec);
-      if(ec)
-        Log::log(*this, LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, ec);
-    }
-
-    if(std::filesystem::is_regular_file(worldDir / uuid.value() += dotCTW))
-    {
-      std::error_code ec;
-      std::filesystem::rename(worldDir / uuid.value() += dotCTW, worldBackupDir / uuid.value() += dateTimeStr() += dotCTW, ec);
-      if(ec)
-        Log::log(*this, LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, ec);
-    }
-
-    // save world:
-    std::filesystem::path savePath = worldDir / uuid.value();
+    std::filesystem::path savePath = worldDir / worldUUID;
     if(!Traintastic::instance->settings->saveWorldUncompressed)
       savePath += dotCTW;
 
-    WorldSaver saver(*this, savePath,
+    // take a snapshot of the world, it is written to disk by the save thread:
+    auto saver = std::make_shared<WorldSaver>(*this,
       WorldSaver::Options{
         .isAutoSave = isAutoSave,
         .isExport = false,
+        .isBinary = isAutoSave, // auto saves aren't read by humans, binary is faster and smaller
+      });
+
+    m_saveResult = SaveResult{savePath, isAutoSave, m_stateJournal ? m_stateJournal->sequence() : m_stateJournalSequence, {}, nullptr};
+    Attributes::setEnabled(save, false);
+
+    m_saveThread = std::thread(
+      [this, saver, worldDir, worldBackupDir, worldUUID, savePath, weak=weak_from_this()]()
+      {
+        try
+        {
+          // write to a temporary first, so a failing save doesn't affect the current world or its backup:
+          std::filesystem::path tmpPath = worldDir / worldUUID;
+          tmpPath += dotTmp;
+          std::filesystem::remove_all(tmpPath);
+
+          if(savePath.extension() == dotCTW)
+            saver->saveCTW(tmpPath);
+          else
+            saver->saveDirectory(tmpPath);
+
+          // backup world:
+          if(!std::filesystem::is_directory(worldBackupDir))
+          {
+            std::error_code ec;
+            std::filesystem::create_directories(worldBackupDir, ec);
+            if(ec)
+              m_saveResult.errors.emplace_back(LogMessage::C1007_CREATING_WORLD_BACKUP_DIRECTORY_FAILED_X, ec);
+          }
+
+          const std::string backupName = worldUUID + dateTimeStr();
+
+          if(std::filesystem::is_directory(worldDir / worldUUID))
+          {
+            std::error_code ec;
+            std::filesystem::rename(worldDir / worldUUID, worldBackupDir / backupName, ec);
+            if(ec)
+              m_saveResult.errors.emplace_back(LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, ec);
+          }
+
+          if(std::filesystem::is_regular_file(worldDir / worldUUID += dotCTW))
+          {
+            std::error_code ec;
+            std::filesystem::rename(worldDir / worldUUID += dotCTW, worldBackupDir / backupName += dotCTW, ec);
+            if(ec)
+              m_saveResult.errors.emplace_back(LogMessage::C1006_CREATING_WORLD_BACKUP_FAILED_X, ec);
+          }
+
+          // move saved world in place:
+          std::filesystem::rename(tmpPath, savePath);
+        }
+        catch(...)
+        {
+          m_saveResult.exception = std::current_exception();
+        }
+
+        EventLoop::call(
+          [weak]()
+          {
+            if(auto world = std::static_pointer_cast<World>(weak.lock()))
+              world->saveFinished();
+          });
       });
+  }
+  catch(const std::exception& e)
+  {
+    Log::log(*this, LogMessage::C1005_SAVING_WORLD_FAILED_X, e);
+  }
+}
+
+void World::saveFinished()
+{
+  assert(isEventLoopThread());
+
+  if(!m_saveThread.joinable()) // already handled by waitForSave()
+    return;
+
+  m_saveThread.join();
+  Attributes::setEnabled(save, true);
+
+  for(const auto& [message, ec] : m_saveResult.errors)
+    Log::log(*this, message, ec);
+
+  if(m_saveResult.exception)
+  {
+    try
+    {
+      std::rethrow_exception(m_saveResult.exception);
+    }
+    catch(const std::exception& e)
+    {
+      Log::log(*this, LogMessage::C1005_SAVING_WORLD_FAILED_X, e);
+    }
+  }
+  else
+  {
+    // the journal only has to contain what isn't saved:
+    m_stateJournalSequence = m_saveResult.stateJournalSequence;
+    if(m_stateJournal)
+      m_stateJournal->compact(m_stateJournalSequence);
 
     if(Traintastic::instance)
     {
       Traintastic::instance->settings->lastWorld = uuid.value();
-      Traintastic::instance->worldList->update(*this, savePath);
+      Traintastic::instance->worldList->update(*this, m_saveResult.path);
+
+      if(!m_stateJournal)
+        enableStateJournal(m_saveResult.path, false);
     }
 
-    Log::log(*this, isAutoSave ? LogMessage::I1010_AUTO_SAVED_WORLD_X : LogMessage::N1022_SAVED_WORLD_X, name.value());
+    Log::log(*this, m_saveResult.isAutoSave ? LogMessage::I1010_AUTO_SAVED_WORLD_X : LogMessage::N1022_SAVED_WORLD_X, name.value());
+  }
+
+  if(m_savePending)
+  {
+    const bool isAutoSave = *m_savePending;
+    m_savePending.reset();
+    backupAndSave(isAutoSave);
+  }
+}
+
+void World::enableStateJournal(const std::filesystem::path& worldPath, bool replay)
+{
+  try
+  {
+    m_stateJournal.reset();
+    m_stateJournal = std::make_unique<StateJournal>(StateJournal::filename(worldPath), uuid.value(), m_stateJournalSequence, replay);
+    m_stateJournal->activate();
   }
   catch(const std::exception& e)
   {
@@ -738,6 +861,12 @@ void World::backupAndSave(bool isAutoSave)
   }
 }
 
+void World::waitForSave()
+{
+  while(m_saveThread.joinable())
+    saveFinished(); // also starts a pending save, so loop
+}
+
 void World::updateEnabled()
 {
   const bool isOnline = contains(state.value(), WorldState::Online);
@@ -29,8 +29,13 @@
 #include "../core/objectvectorproperty.hpp"
 #include "../core/method.hpp"
 #include "../core/event.hpp"
+#include <exception>
+#include <optional>
+#include <thread>
 #include <unordered_map>
 #include <boost/uuid/uuid.hpp>
+#include <traintastic/enum/logmessage.hpp>
+#include <traintastic/utils/stdfilesystem.hpp>
 #include <traintastic/enum/externaloutputchangeaction.hpp>
 #include <traintastic/enum/worldevent.hpp>
 #include "../enum/worldscale.hpp"
@@ -38,6 +43,7 @@
 #include <traintastic/set/worldstate.hpp>
 
 class WorldLoader;
+class StateJournal;
 class LNCVProgrammer;
 class DecoderController;
 class InputController;
@@ -60,6 +66,9 @@ class LinkRailTileList;
 class TurnoutLinkableRailTileList;
 class NXManager;
 class TrainPathFinder;
+class TrainMotionScheduler;
+class TimerWheel;
+class Telemetry;
 class Clock;
 class ThrottleList;
 class TrainList;
@@ -85,8 +94,28 @@ class World : public Object
     struct Private {};
 
     WorldFeatures m_features;
+    std::unique_ptr<TrainMotionScheduler> m_trainMotionScheduler;
+    std::unique_ptr<TimerWheel> m_timerWheel;
+    std::unique_ptr<Telemetry> m_telemetry;
+
+    //! \brief State of the background save, see backupAndSave()
+    struct SaveResult
+    {
+      std::filesystem::path path;
+      bool isAutoSave;
+      uint64_t stateJournalSequence; //!< last state journal record included in the saved world
+      std::vector<std::pair<LogMessage, std::error_code>> errors; //!< non fatal (backup) errors
+      std::exception_ptr exception;
+    };
+
+    std::thread m_saveThread;
+    SaveResult m_saveResult;
+    std::optional<bool> m_savePending; //!< save requested while saving, value is isAutoSave
+    std::unique_ptr<StateJournal> m_stateJournal;
+    uint64_t m_stateJournalSequence = 0; //!< last state journal record included in the loaded/saved world
 
     void backupAndSave(bool isAutoSave);
+    void saveFinished();
 
     void updateEnabled();
     void updateFeatures();
@@ -109,8 +138,11 @@ class World : public Object
 
     static constexpr std::string_view id = classId;
     static constexpr std::string_view dotCTW = ".ctw";
+    static constexpr std::string_view dotTmp = ".tmp";
     static constexpr std::string_view filename = "traintastic.json";
     static constexpr std::string_view filenameState = "traintastic.state.json";
+    static constexpr std::string_view filenameBinary = "traintastic.cbor";
+    static constexpr std::string_view filenameStateBinary = "traintastic.state.cbor";
 
     static std::shared_ptr<World> create();
 
@@ -125,6 +157,7 @@ class World : public Object
     Property<bool> correctOutputPosWhenLocked;
     Property<ExternalOutputChangeAction> extOutputChangeAction;
     Property<uint16_t> pathReleaseDelay;
+    Property<uint16_t> trainMotionInterval;
 
     Property<bool> featureScripting;
 
@@ -198,6 +231,23 @@ class World : public Object
       return m_features;
     }
 
+    TrainMotionScheduler& trainMotionScheduler()
+    {
+      return *m_trainMotionScheduler;
+    }
+
+    //! \brief Timers shared by all Lua scripts
+    TimerWheel& timerWheel()
+    {
+      return *m_timerWheel;
+    }
+
+    //! \brief History of status values, e.g. booster load
+    Telemetry& telemetry()
+    {
+      return *m_telemetry;
+    }
+
     void enableFeature(WorldFeature feature)
     {
       assert(isAutomaticFeature(feature));
@@ -218,6 +268,12 @@ class World : public Object
     ObjectPtr getObjectByPath(std::string_view path) const;
 
     void autoSave();
+    //! \brief Wait for a background save to finish.
+    void waitForSave();
+
+    //! \brief Record state changes in a journal, see \ref StateJournal.
+    //! \param[in] replay Continue an existing journal, only when the world was just loaded from \a worldPath.
+    void enableStateJournal(const std::filesystem::path& worldPath, bool replay);
     void export_(std::vector<std::byte>& data);
 };
 
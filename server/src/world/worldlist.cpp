@@ -21,6 +21,7 @@
 
 #include "worldlist.hpp"
 #include <fstream>
+#include <unordered_map>
 #include <boost/uuid/nil_generator.hpp>
 #include <boost/uuid/random_generator.hpp>
 #include <boost/uuid/string_generator.hpp>
@@ -28,6 +29,7 @@
 #include "../traintastic/traintastic.hpp"
 #include "../log/log.hpp"
 #include "worldlisttablemodel.hpp"
+#include "statejournal.hpp"
 #include "ctwreader.hpp"
 #include "ctwmodifier.hpp"
 #include "libarchiveerror.hpp"
@@ -60,6 +62,7 @@ WorldList::WorldList(const std::filesystem::path& path)
           return false;
         }
 
+        // the state journal isn't copied, the duplicate starts with the state of the saved world:
         const auto newUUID = boost::uuids::random_generator()();
 
         auto patchWorld =
@@ -77,9 +80,20 @@ WorldList::WorldList(const std::filesystem::path& path)
           {
             CTWModifier ctw(info->path);
 
+            const bool isBinary = ctw.findFile({World::filenameBinary, World::filename}) == World::filenameBinary;
+            const auto filename = isBinary ? World::filenameBinary : World::filename;
+            const auto filenameState = isBinary ? World::filenameStateBinary : World::filenameState;
+
             nlohmann::json worldData;
             nlohmann::json worldState;
-            if(!ctw.readFile(World::filename, worldData) || !ctw.readFile(World::filenameState, worldState))
+            if(isBinary)
+            {
+              if(!ctw.readFileCBOR(filename, worldData) || !ctw.readFileCBOR(filenameState, worldState))
+              {
+                return false;
+              }
+            }
+            else if(!ctw.readFile(filename, worldData) || !ctw.readFile(filenameState, worldState))
             {
               return false;
             }
@@ -88,9 +102,19 @@ WorldList::WorldList(const std::filesystem::path& path)
 
             const auto newFile = (m_path / to_string(newUUID)) += World::dotCTW;
 
-            if(!ctw.updateFile(World::filename, worldData) ||
-                !ctw.updateFile(World::filenameState, worldState) ||
-                !ctw.save(newFile))
+            if(isBinary)
+            {
+              if(!ctw.updateFileCBOR(filename, worldData) || !ctw.updateFileCBOR(filenameState, worldState))
+              {
+                return false;
+              }
+            }
+            else if(!ctw.updateFile(filename, worldData) || !ctw.updateFile(filenameState, worldState))
+            {
+              return false;
+            }
+
+            if(!ctw.save(newFile))
             {
               return false;
             }
@@ -183,8 +207,14 @@ WorldList::WorldList(const std::filesystem::path& path)
           return false;
         }
 
+        {
+          std::error_code ec;
+          std::filesystem::remove(StateJournal::filename(it->path), ec); // not fatal, a journal of another world is ignored
+        }
+
         m_items.erase(it);
         itemsChanged();
+        saveIndex();
         return true;
       }}
 {
@@ -212,19 +242,67 @@ void WorldList::buildIndex()
 
   m_items.clear();
 
+  // load cached index, key is the filename within the worlds directory:
+  std::unordered_map<std::string, WorldInfo> cache;
+  if(auto index = readFileJSON(m_path / indexFilename); index && index->value("version", 0) == indexVersion)
+  {
+    try
+    {
+      for(const auto& item : index->value("worlds", json::array()))
+      {
+        WorldInfo info;
+        info.fileSize = item.at("size");
+        info.fileTime = item.at("time");
+        if(readInfo(item, info))
+          cache.emplace(item.at("file").get<std::string>(), std::move(info));
+      }
+    }
+    catch(const std::exception&) // invalid index, rebuild it
+    {
+      cache.clear();
+    }
+  }
+
+  bool indexChanged = false;
+  size_t cacheHits = 0;
   WorldInfo info;
   for(const auto& it : std::filesystem::directory_iterator(m_path))
   {
     info.path = it.path();
 
-    if(info.path.extension() == World::dotCTW)
+    if(info.path.extension() == World::dotTmp) // incomplete save
+      continue;
+
+    const bool isCTW = (info.path.extension() == World::dotCTW);
+    const auto worldFile = info.path / World::filename;
+    if(!isCTW && !(std::filesystem::is_directory(info.path) && std::filesystem::is_regular_file(worldFile)))
+      continue;
+
+    if(!getFileStat(info.path, info))
+      continue;
+
+    if(auto cached = cache.find(info.path.filename().string()); cached != cache.end() &&
+        cached->second.fileSize == info.fileSize && cached->second.fileTime == info.fileTime)
+    {
+      info.uuid = cached->second.uuid;
+      info.name = cached->second.name;
+      m_items.push_back(info);
+      cacheHits++;
+      continue;
+    }
+
+    indexChanged = true;
+
+    if(isCTW)
     {
       try
       {
         CTWReader ctw(info.path);
 
         json world;
-        if(ctw.readFile(World::filename, world) && readInfo(world, info))
+        const auto filename = ctw.findFile({World::filenameBinary, World::filename});
+        const bool isRead = filename && ((*filename == World::filenameBinary) ? ctw.readFileCBOR(*filename, world) : ctw.readFile(*filename, world));
+        if(isRead && readInfo(world, info))
           m_items.push_back(info);
       }
       catch(const LibArchiveError& e)
@@ -234,50 +312,54 @@ void WorldList::buildIndex()
       continue;
     }
 
-    const auto worldFile = info.path / World::filename;
-    if(std::filesystem::is_directory(info.path) && std::filesystem::is_regular_file(worldFile))
+    std::ifstream file(worldFile);
+    if(file.is_open())
     {
-      std::ifstream file(worldFile);
-      if(file.is_open())
+      try
       {
-        try
-        {
-          json world = json::parse(file);
+        json world = json::parse(file);
 
-          if(readInfo(world, info))
-            m_items.push_back(info);
-        }
-        catch(const std::exception& e)
-        {
-          Log::log(Traintastic::classId, LogMessage::C1004_READING_WORLD_FAILED_X_X, e, worldFile);
-        }
+        if(readInfo(world, info))
+          m_items.push_back(info);
+      }
+      catch(const std::exception& e)
+      {
+        Log::log(Traintastic::classId, LogMessage::C1004_READING_WORLD_FAILED_X_X, e, worldFile);
       }
     }
   }
 
   sort();
+
+  if(indexChanged || cacheHits != cache.size()) // changed, added or removed worlds
+    saveIndex();
 }
 
 void WorldList::add(WorldInfo info)
 {
+  getFileStat(info.path, info);
   m_items.emplace_back(std::move(info));
   sort();
   itemsChanged();
+  saveIndex();
 }
 
 void WorldList::update(World& world, const std::filesystem::path& path)
 {
   const auto uuid = boost::uuids::string_generator()(world.uuid.value());
 
-  if(auto it = findItem(uuid); it != m_items.end())
+  auto it = findItem(uuid);
+  if(it != m_items.end())
   {
     it->name = world.name;
     it->path = path;
   }
   else // new world
   {
-    m_items.emplace_back(WorldInfo{uuid, world.name.value(), path});
+    it = m_items.emplace(m_items.end(), WorldInfo{uuid, world.name.value(), path});
   }
+  getFileStat(path, *it);
+  saveIndex();
 }
 
 TableModelPtr WorldList::getModel()
@@ -300,6 +382,46 @@ bool WorldList::readInfo(const json& world, WorldInfo& info)
   return !info.uuid.is_nil();
 }
 
+std::filesystem::path WorldList::indexedFile(const std::filesystem::path& path)
+{
+  if(path.extension() == World::dotCTW)
+    return path;
+  return path / World::filename;
+}
+
+bool WorldList::getFileStat(const std::filesystem::path& path, WorldInfo& info)
+{
+  const auto file = indexedFile(path);
+  std::error_code ec;
+  const auto size = std::filesystem::file_size(file, ec);
+  if(ec)
+    return false;
+  const auto time = std::filesystem::last_write_time(file, ec);
+  if(ec)
+    return false;
+  info.fileSize = size;
+  info.fileTime = static_cast<int64_t>(time.time_since_epoch().count());
+  return true;
+}
+
+void WorldList::saveIndex()
+{
+  json worlds = json::array();
+  for(const auto& item : m_items)
+  {
+    worlds.push_back({
+      {"file", item.path.filename().string()},
+      {"size", item.fileSize},
+      {"time", item.fileTime},
+      {"uuid", to_string(item.uuid)},
+      {"name", item.name},
+    });
+  }
+
+  // the index is a cache only, if writing fails the next index build reads all worlds:
+  writeFileJSON(m_path / indexFilename, {{"version", indexVersion}, {"worlds", std::move(worlds)}});
+}
+
 WorldList::Items::iterator WorldList::findItem(const boost::uuids::uuid& uuid)
 {
   return std::find_if(m_items.begin(), m_items.end(),
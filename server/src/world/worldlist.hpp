@@ -42,6 +42,8 @@ class WorldList : public Object, public Table
       boost::uuids::uuid uuid;
       std::string name;
       std::filesystem::path path;
+      std::uintmax_t fileSize = 0; //!< size of the indexed file, see indexedFile()
+      int64_t fileTime = 0; //!< last write time of the indexed file, see indexedFile()
 
       bool operator >(const WorldInfo& that) const
       {
@@ -54,9 +56,17 @@ class WorldList : public Object, public Table
     };
 
   private:
+    static constexpr std::string_view indexFilename = "index.json";
+    static constexpr int indexVersion = 1;
+
     void itemsChanged();
     void sort();
 
+    //! \brief File used to validate the index entry of a world, the .ctw file or the world JSON of a world directory.
+    static std::filesystem::path indexedFile(const std::filesystem::path& path);
+    static bool getFileStat(const std::filesystem::path& path, WorldInfo& info);
+    void saveIndex();
+
   protected:
     using Items = std::vector<WorldInfo>;
 
@@ -83,6 +93,12 @@ class WorldList : public Object, public Table
 
     const WorldInfo* find(const boost::uuids::uuid& uuid);
 
+    /**
+     * \brief Build the world index
+     *
+     * The index is cached in the worlds directory, only worlds of which the size or
+     * modification time differs from the cached entry are read.
+     */
     void buildIndex();
 
     void update(World& world, const std::filesystem::path& path);
@@ -22,6 +22,7 @@
 
 #include "worldloader.hpp"
 #include <fstream>
+#include <future>
 #include <boost/algorithm/string.hpp>
 #include <boost/uuid/string_generator.hpp>
 #include <boost/uuid/uuid_io.hpp>
@@ -30,6 +31,7 @@
 #include "../utils/startswith.hpp"
 #include "../utils/stripsuffix.hpp"
 #include "ctwreader.hpp"
+#include "statejournal.hpp"
 #include "../log/logmessageexception.hpp"
 #include <version.hpp>
 
@@ -58,6 +60,8 @@ WorldLoader::WorldLoader()
 WorldLoader::WorldLoader(std::filesystem::path path)
   : WorldLoader()
 {
+  m_stateJournalFilename = StateJournal::filename(path);
+
   if(path.extension() == World::dotCTW)
     m_ctw = std::make_unique<CTWReader>(path);
   else
@@ -109,32 +113,13 @@ json WorldLoader::getState(const std::string& id) const
 
 void WorldLoader::load()
 {
-  m_states = json::object();
-
-  json data;
-  json state;
+  StateJournal::Suspend suspendStateJournal; // loading doesn't change state
 
-  // load file(s):
-  if(m_ctw)
-  {
-    if(!m_ctw->readFile(World::filename, data))
-      throw std::runtime_error(std::string("can't read ").append(World::filename));
-
-    if(!m_ctw->readFile(World::filenameState, state))
-      throw std::runtime_error(std::string("can't read ").append(World::filenameState));
-  }
-  else
-  {
-    std::ifstream file(m_path / World::filename);
-    if(!file.is_open())
-      throw std::runtime_error("can't open " + (m_path / World::filename).string());
-    data = json::parse(file);
+  m_states = json::object();
 
-    std::ifstream stateFile(m_path / World::filenameState);
-    if(!stateFile.is_open())
-      throw std::runtime_error("can't open " + (m_path / World::filenameState).string());
-    state = json::parse(stateFile);
-  }
+  // load file(s), objects are collected while parsing, so the large objects array isn't build and copied:
+  std::vector<json> objects;
+  json data = readObjectsFile(World::filename, World::filenameBinary, objects);
 
   // check if UUID is valid:
   m_world->uuid.setValueInternal(to_string(boost::uuids::string_generator()(std::string(data["uuid"]))));
@@ -163,34 +148,19 @@ void WorldLoader::load()
     }
   }
 
-  // state data
-  if(state.is_object() && state["uuid"] == data["uuid"])
-  {
-    m_states = state["states"];
-    auto stateObjects = state.value("objects", json::array());
-    data["objects"].insert(data["objects"].end(), stateObjects.begin(), stateObjects.end());
-  }
+  const json uuid = data["uuid"];
 
-  // create a list of all objects
-  m_objects.insert({m_world->getObjectId(), {data, m_world, false}});
-  for(json object : data["objects"])
-  {
-    //! \todo Remove in v0.4
-    if(object["class_id"].get<std::string_view>() == "output") // don't create Output objects, no longer stored in file.
+  // the state is parsed while the objects are created, objects itself aren't thread safe so they are created here:
+  std::vector<json> stateObjects;
+  auto stateFuture = std::async(std::launch::async,
+    [this, &stateObjects]()
     {
-      continue;
-    }
+      return readObjectsFile(World::filenameState, World::filenameStateBinary, stateObjects);
+    });
 
-    if(auto it = object.find("id"); it != object.end())
-    {
-      auto id = it.value().get<std::string>();
-      if(!isValidObjectId(id))
-        throw std::runtime_error("invalid object id value");
-      m_objects.insert({std::move(id), {object, nullptr, false}});
-    }
-    else
-      throw std::runtime_error("id missing");
-  }
+  // create a list of all objects
+  m_objects.insert({m_world->getObjectId(), {std::move(data), m_world, false}});
+  addObjects(std::move(objects));
 
   //! \todo Remove in v0.4
   {
@@ -324,6 +294,31 @@ void WorldLoader::load()
     if(!it.second.object)
       createObject(it.second);
 
+  // state data
+  if(json state = stateFuture.get(); state.is_object() && state["uuid"] == uuid)
+  {
+    m_states = state["states"];
+
+    // state changes after the world was saved:
+    m_world->m_stateJournalSequence = state.value("journal_sequence", static_cast<uint64_t>(0));
+    if(!m_stateJournalFilename.empty())
+    {
+      if(!m_states.is_object())
+        m_states = json::object();
+
+      StateJournal::read(m_stateJournalFilename, m_world->uuid.value(), m_world->m_stateJournalSequence,
+        [this](uint64_t /*sequence*/, std::string_view objectId, std::string_view propertyName, const json& value)
+        {
+          m_states[std::string(objectId)][std::string(propertyName)] = value;
+        });
+    }
+
+    // state objects refer to objects in the world, so they are created last:
+    for(auto& object : addObjects(std::move(stateObjects)))
+      if(!object->object)
+        createObject(*object);
+  }
+
   // and load their data/state
   for(auto& it : m_objects)
     if(!it.second.loaded)
@@ -334,6 +329,82 @@ void WorldLoader::load()
     it.second.object->loaded();
 }
 
+json WorldLoader::readObjectsFile(std::string_view filename, std::string_view filenameBinary, std::vector<json>& objects)
+{
+  bool inObjects = false;
+  const json::parser_callback_t callback =
+    [&objects, &inObjects](int depth, json::parse_event_t event, json& parsed)
+    {
+      if(depth == 1 && event == json::parse_event_t::key)
+      {
+        inObjects = (parsed == "objects");
+      }
+      else if(inObjects && depth == 2 && event == json::parse_event_t::object_end)
+      {
+        objects.emplace_back(std::move(parsed));
+        return false; // moved, don't add it to the objects array
+      }
+      return true;
+    };
+
+  json data;
+  if(m_ctw)
+  {
+    const auto found = m_ctw->findFile({filenameBinary, filename});
+    if(found && *found == filenameBinary)
+    {
+      if(!m_ctw->readFileCBOR(*found, data))
+        throw std::runtime_error(std::string("can't read ").append(filenameBinary));
+
+      // CBOR can't be parsed with a callback, move the objects afterwards:
+      if(auto it = data.find("objects"); it != data.end() && it->is_array())
+      {
+        objects.reserve(it->size());
+        std::move(it->begin(), it->end(), std::back_inserter(objects));
+        data.erase(it);
+      }
+    }
+    else if(!found || !m_ctw->readFile(*found, data, callback))
+      throw std::runtime_error(std::string("can't read ").append(filename));
+  }
+  else
+  {
+    std::ifstream file(m_path / filename); // directories are always stored as JSON
+    if(!file.is_open())
+      throw std::runtime_error("can't open " + (m_path / filename).string());
+    data = json::parse(file, callback);
+  }
+  return data;
+}
+
+std::vector<WorldLoader::ObjectData*> WorldLoader::addObjects(std::vector<json> objects)
+{
+  std::vector<ObjectData*> added;
+  added.reserve(objects.size());
+  m_objects.reserve(m_objects.size() + objects.size());
+
+  for(json& object : objects)
+  {
+    //! \todo Remove in v0.4
+    if(object["class_id"].get<std::string_view>() == "output") // don't create Output objects, no longer stored in file.
+    {
+      continue;
+    }
+
+    if(auto it = object.find("id"); it != object.end())
+    {
+      auto id = it.value().get<std::string>();
+      if(!isValidObjectId(id))
+        throw std::runtime_error("invalid object id value");
+      added.emplace_back(&m_objects.insert({std::move(id), {std::move(object), nullptr, false}}).first->second);
+    }
+    else
+      throw std::runtime_error("id missing");
+  }
+
+  return added;
+}
+
 void WorldLoader::createObject(ObjectData& objectData)
 {
   assert(!objectData.object);
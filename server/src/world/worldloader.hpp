@@ -46,6 +46,7 @@ class WorldLoader
     };
 
     std::filesystem::path m_path;
+    std::filesystem::path m_stateJournalFilename;
     std::unique_ptr<CTWReader> m_ctw;
     std::shared_ptr<World> m_world;
     std::unordered_map<std::string, ObjectData> m_objects;
@@ -54,6 +55,8 @@ class WorldLoader
     WorldLoader();
     void load();
 
+    nlohmann::json readObjectsFile(std::string_view filename, std::string_view filenameBinary, std::vector<nlohmann::json>& objects);
+    std::vector<ObjectData*> addObjects(std::vector<nlohmann::json> objects);
     void createObject(ObjectData& objectData);
     void loadObject(ObjectData& objectData);
 
@@ -24,6 +24,7 @@
 #include <boost/uuid/uuid_io.hpp>
 #include <version.hpp>
 #include "world.hpp"
+#include "statejournal.hpp"
 #include "../core/stateobject.hpp"
 #include "../core/objectproperty.tpp"
 #include "../status/simulationstatus.hpp"
@@ -33,6 +34,7 @@
 using nlohmann::json;
 
 WorldSaver::WorldSaver(const World& world, Options options)
+  : m_binary{options.isBinary}
 {
   m_states = json::object();
   m_data = json::object();
@@ -61,6 +63,8 @@ WorldSaver::WorldSaver(const World& world, Options options)
 
   m_data["uuid"] = m_state["uuid"] = world.uuid.value();
 
+  m_state["journal_sequence"] = world.m_stateJournal ? world.m_stateJournal->sequence() : world.m_stateJournalSequence;
+
   m_data["is_auto_save"] = options.isAutoSave;
   m_data["is_export"] = options.isExport;
 
@@ -101,15 +105,9 @@ WorldSaver::WorldSaver(const World& world, Options options)
       }
     }
 
-    std::sort(objects.begin(), objects.end(),
-      [](const json& a, const json& b)
-      {
-        return (a["id"] < b["id"]);
-      });
-
-    m_data["objects"] = objects;
-    m_state["objects"] = stateObjects;
-    m_state["states"] = m_states;
+    m_data["objects"] = std::move(objects);
+    m_state["objects"] = std::move(stateObjects);
+    m_state["states"] = std::move(m_states);
   }
 }
 
@@ -117,30 +115,66 @@ WorldSaver::WorldSaver(const World& world, const std::filesystem::path& path, Op
   : WorldSaver(world, options)
 {
   if(path.extension() == World::dotCTW)
-  {
-    CTWWriter ctw(path);
-    writeCTW(ctw);
-  }
+    saveCTW(path);
   else
-  {
-    saveToDisk(m_data, path / World::filename);
-    saveToDisk(m_state, path / World::filenameState);
-    deleteFiles(path);
-    writeFiles(path);
-  }
+    saveDirectory(path);
 }
 
 WorldSaver::WorldSaver(const World& world, std::vector<std::byte>& memory, Options options)
   : WorldSaver(world, options)
+{
+  saveCTW(memory);
+}
+
+void WorldSaver::saveCTW(const std::filesystem::path& filename)
+{
+  CTWWriter ctw(filename);
+  writeCTW(ctw);
+}
+
+void WorldSaver::saveCTW(std::vector<std::byte>& memory)
 {
   CTWWriter ctw(memory);
   writeCTW(ctw);
 }
 
+void WorldSaver::saveDirectory(const std::filesystem::path& path)
+{
+  sortObjects();
+  saveToDisk(m_data, path / World::filename);
+  saveToDisk(m_state, path / World::filenameState);
+  deleteFiles(path);
+  writeFiles(path);
+}
+
+void WorldSaver::sortObjects()
+{
+  // sorting isn't required for loading, it keeps the output stable, so it is done when writing instead of when taking the snapshot:
+  if(m_sorted)
+    return;
+
+  auto& objects = m_data["objects"];
+  std::sort(objects.begin(), objects.end(),
+    [](const json& a, const json& b)
+    {
+      return (a["id"] < b["id"]);
+    });
+  m_sorted = true;
+}
+
 void WorldSaver::writeCTW(CTWWriter& ctw)
 {
-  ctw.writeFile(World::filename, m_data);
-  ctw.writeFile(World::filenameState, m_state);
+  if(m_binary)
+  {
+    ctw.writeFileCBOR(World::filenameBinary, m_data);
+    ctw.writeFileCBOR(World::filenameStateBinary, m_state);
+  }
+  else
+  {
+    sortObjects();
+    ctw.writeFile(World::filename, m_data);
+    ctw.writeFile(World::filenameState, m_state);
+  }
   for(const auto& file : m_writeFiles)
     ctw.writeFile(file.first, file.second);
 }
@@ -38,6 +38,7 @@ public:
   {
     bool isAutoSave;
     bool isExport;
+    bool isBinary = false; //!< Store world and state as CBOR instead of JSON, CTW only.
   };
 
   private:
@@ -46,9 +47,10 @@ public:
     nlohmann::json m_state;
     std::list<std::filesystem::path> m_deleteFiles;
     std::list<std::pair<std::filesystem::path, std::string>> m_writeFiles;
+    bool m_sorted = false;
+    bool m_binary;
 
-    WorldSaver(const World& world, Options options);
-
+    void sortObjects();
     void writeCTW(CTWWriter& ctw);
 
     void deleteFiles(const std::filesystem::path& basePath);
@@ -57,9 +59,20 @@ public:
     static void saveToDisk(const std::string& data, const std::filesystem::path& filename);
 
   public:
+    /**
+     * \brief Take a snapshot of the world, without writing it.
+     *
+     * Only the snapshot must be taken on the event loop thread, writing it using
+     * saveCTW() or saveDirectory() doesn't access the world and can be done by any thread.
+     */
+    WorldSaver(const World& world, Options options);
     WorldSaver(const World& world, const std::filesystem::path& path, Options options);
     WorldSaver(const World& world, std::vector<std::byte>& memory, Options options);
 
+    void saveCTW(const std::filesystem::path& filename);
+    void saveCTW(std::vector<std::byte>& memory);
+    void saveDirectory(const std::filesystem::path& path);
+
     nlohmann::json saveObject(const ObjectPtr& object);
     nlohmann::json saveStateObject(const std::shared_ptr<StateObject>& object);
 
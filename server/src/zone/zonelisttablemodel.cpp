@@ -45,24 +45,19 @@ ZoneListTableModel::ZoneListTableModel(ObjectList<Zone>& list) :
     });
 }
 
-std::string ZoneListTableModel::getText(uint32_t column, uint32_t row) const
+std::string ZoneListTableModel::getItemText(uint32_t column, const Zone& zone) const
 {
-  if(row < rowCount())
+  switch(column)
   {
-    const Zone& zone = getItem(row);
+    case columnId:
+      return zone.id;
 
-    switch(column)
-    {
-      case columnId:
-        return zone.id;
+    case columnName:
+      return zone.name;
 
-      case columnName:
-        return zone.name;
-
-      default:
-        assert(false);
-        break;
-    }
+    default:
+      assert(false);
+      break;
   }
 
   return "";
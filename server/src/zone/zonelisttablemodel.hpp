@@ -40,7 +40,7 @@ public:
 
   ZoneListTableModel(ObjectList<Zone>& list);
 
-  std::string getText(uint32_t column, uint32_t row) const final;
+  std::string getItemText(uint32_t column, const Zone& zone) const final;
 };
 
 #endif
@@ -0,0 +1,161 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include "../src/core/eventloop.hpp"
+#include "../src/world/world.hpp"
+#include "../src/world/worldloader.hpp"
+#include "../src/world/worldsaver.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/board/board.hpp"
+#include "../src/board/boardlist.hpp"
+#include "../src/board/map/link.hpp"
+#include "../src/board/map/node.hpp"
+#include "../src/board/tile/rail/blockrailtile.hpp"
+#include "../src/board/tile/rail/curve45railtile.hpp"
+#include "../src/board/tile/rail/straightrailtile.hpp"
+#include "../src/board/tile/rail/turnout/turnoutleft45railtile.hpp"
+#include "../src/board/tile/rail/turnout/turnoutright45railtile.hpp"
+
+namespace {
+
+using Network = std::map<std::pair<int16_t, int16_t>, std::string>;
+
+std::string toString(const Tile& tile)
+{
+  return std::to_string(tile.x.value()).append(",").append(std::to_string(tile.y.value()));
+}
+
+//! Describe all links of all nodes, so two networks can be compared.
+Network getNetwork(const Board& board)
+{
+  Network network;
+  for(const auto& [l, tile] : board.tileMap())
+  {
+    if(l != tile->location() || !tile->node())
+      continue;
+
+    const Node& node = tile->node()->get();
+    std::string s;
+    for(const auto& link : node.links())
+    {
+      s.append("[");
+      if(link)
+      {
+        const Node& next = link->getNext(node);
+        s.append(toString(next.tile())).append("#").append(std::to_string(next.getIndex(*link)));
+        for(const auto& linkTile : link->tiles())
+          s.append(" ").append(toString(*linkTile));
+      }
+      s.append("]");
+    }
+    if(const auto* block = dynamic_cast<const BlockRailTile*>(tile.get()))
+      s.append(" paths=").append(std::to_string(block->paths().size()));
+
+    network.emplace(std::pair{l.x, l.y}, std::move(s));
+  }
+  return network;
+}
+
+}
+
+TEST_CASE("Board: Incremental update equals full rebuild", "[board]")
+{
+  EventLoop::reset();
+
+  std::filesystem::path ctw;
+  Network network;
+
+  {
+    auto world = World::create();
+    std::weak_ptr<Board> boardWeak = world->boards->create();
+
+    // Board:
+    // +--------+          +--------+
+    // | block1 |---\  /---| block2 |
+    // +--------+    \/    +--------+
+    // +--------+    /\    +--------+
+    // | block3 |---/--\---| block4 |
+    // +--------+          +--------+
+    //
+    // +--------+          +--------+
+    // | block5 |----------| block6 |
+    // +--------+          +--------+
+    REQUIRE(boardWeak.lock()->addTile(0, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+    REQUIRE(boardWeak.lock()->addTile(1, 0, TileRotate::Deg315, Curve45RailTile::classId, false));
+    REQUIRE(boardWeak.lock()->addTile(2, 0, TileRotate::Deg270, Curve45RailTile::classId, false));
+    REQUIRE(boardWeak.lock()->addTile(3, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+
+    REQUIRE(boardWeak.lock()->addTile(0, 1, TileRotate::Deg90, BlockRailTile::classId, false));
+    REQUIRE(boardWeak.lock()->addTile(1, 1, TileRotate::Deg90, TurnoutLeft45RailTile::classId, false));
+    REQUIRE(boardWeak.lock()->addTile(2, 1, TileRotate::Deg270, TurnoutRight45RailTile::classId, false));
+    REQUIRE(boardWeak.lock()->addTile(3, 1, TileRotate::Deg90, BlockRailTile::classId, false));
+
+    REQUIRE(boardWeak.lock()->addTile(0, 3, TileRotate::Deg90, BlockRailTile::classId, false));
+    REQUIRE(boardWeak.lock()->addTile(1, 3, TileRotate::Deg90, StraightRailTile::classId, false));
+    REQUIRE(boardWeak.lock()->addTile(2, 3, TileRotate::Deg90, StraightRailTile::classId, false));
+    REQUIRE(boardWeak.lock()->addTile(3, 3, TileRotate::Deg90, BlockRailTile::classId, false));
+
+    world->run(); // this will build the board network
+    world->stop();
+
+    // modify the board, replace turnouts by curves:
+    REQUIRE(boardWeak.lock()->addTile(1, 1, TileRotate::Deg90, Curve45RailTile::classId, true));
+    REQUIRE(boardWeak.lock()->addTile(2, 1, TileRotate::Deg135, Curve45RailTile::classId, true));
+
+    // shorten the bottom line and move block6 next to the remaining straight:
+    REQUIRE(boardWeak.lock()->deleteTile(2, 3));
+    REQUIRE(boardWeak.lock()->moveTile(3, 3, 2, 3, TileRotate::Deg90, false));
+
+    // add a dead end to block5:
+    REQUIRE(boardWeak.lock()->addTile(-1, 3, TileRotate::Deg90, StraightRailTile::classId, false));
+
+    world->run(); // this will update the board network
+    world->stop();
+
+    REQUIRE(boardWeak.lock()->railCrossOver().find({1, 0}) != boardWeak.lock()->railCrossOver().end());
+    network = getNetwork(*boardWeak.lock());
+    REQUIRE_FALSE(network.empty());
+
+    ctw = std::filesystem::temp_directory_path() / std::string(world->uuid.value()).append(World::dotCTW);
+    WorldSaver saver(*world, ctw,
+      WorldSaver::Options{
+        .isAutoSave = false,
+        .isExport = false,
+      });
+  }
+
+  {
+    // loading rebuilds the complete network:
+    WorldLoader loader(ctw);
+    auto world = loader.world();
+    REQUIRE(world);
+    REQUIRE(world->boards->length == 1);
+
+    const auto board = world->boards->operator[](0);
+    REQUIRE(board);
+    REQUIRE(getNetwork(*board) == network);
+  }
+
+  REQUIRE(std::filesystem::remove(ctw));
+}
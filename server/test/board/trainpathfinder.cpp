@@ -633,3 +633,235 @@ TEST_CASE("Board/TrainPathFinder: Direct block to block, variant 8", "[board][tr
   REQUIRE(locomotive1.expired());
   REQUIRE(train1.expired());
 }
+
+TEST_CASE("Board/TrainPathFinder: Multiple blocks", "[board][train-path-finder]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  std::weak_ptr<World> worldWeak = world;
+
+  // Board:
+  // +-----+    +-----+    +-----+
+  // |A 1 B|----|A 2 B|----|A 3 B|
+  // +-----+    +-----+    +-----+
+  std::weak_ptr<Board> boardWeak = world->boards->create();
+
+  REQUIRE(boardWeak.lock()->addTile(0, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+  REQUIRE(boardWeak.lock()->addTile(1, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(boardWeak.lock()->addTile(2, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+  REQUIRE(boardWeak.lock()->addTile(3, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(boardWeak.lock()->addTile(4, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+
+  std::weak_ptr<BlockRailTile> block1 = std::dynamic_pointer_cast<BlockRailTile>(boardWeak.lock()->getTile({0, 0}));
+  REQUIRE_FALSE(block1.expired());
+  std::weak_ptr<BlockRailTile> block2 = std::dynamic_pointer_cast<BlockRailTile>(boardWeak.lock()->getTile({2, 0}));
+  REQUIRE_FALSE(block2.expired());
+  std::weak_ptr<BlockRailTile> block3 = std::dynamic_pointer_cast<BlockRailTile>(boardWeak.lock()->getTile({4, 0}));
+  REQUIRE_FALSE(block3.expired());
+
+  // Set blocks free:
+  REQUIRE(block1.lock()->setStateFree());
+  REQUIRE(block1.lock()->state == BlockState::Free);
+  REQUIRE(block2.lock()->setStateFree());
+  REQUIRE(block2.lock()->state == BlockState::Free);
+  REQUIRE(block3.lock()->setStateFree());
+  REQUIRE(block3.lock()->state == BlockState::Free);
+
+  // Create a train:
+  std::weak_ptr<RailVehicle> locomotive1 = world->railVehicles->create(Locomotive::classId);
+  std::weak_ptr<Train> train1 = world->trains->create();
+  train1.lock()->vehicles->add(locomotive1.lock());
+  REQUIRE(train1.lock()->vehicles->length == 1);
+
+  // Assign train to block 1:
+  block1.lock()->assignTrain(train1.lock());
+  REQUIRE(block1.lock()->state == BlockState::Reserved);
+  REQUIRE(block1.lock()->trains.size() == 1);
+  REQUIRE(block1.lock()->trains.front()->direction.value() == BlockTrainDirection::TowardsB);
+
+  world->run(); // this will build the board network
+  world->stop();
+
+  // Block graph index:
+  {
+    const auto& graph = world->trainPathFinder->blockGraph();
+    REQUIRE(graph.isValid());
+    REQUIRE(graph.vertexCount() == 6);
+    REQUIRE(graph.edgeCount() == 4);
+    REQUIRE(graph.blockIndex(*block1.lock()) != BlockGraph::invalidIndex);
+  }
+
+  // Find the route:
+  REQUIRE(world->trainPathFinder->findRoute(block1.lock(), BlockTrainDirection::TowardsB, block3.lock(), BlockTrainDirection::TowardsB));
+  REQUIRE(world->trainPathFinder->route.size() == 3);
+  REQUIRE(world->trainPathFinder->route[0] == block1.lock());
+  REQUIRE(world->trainPathFinder->route[1] == block2.lock());
+  REQUIRE(world->trainPathFinder->route[2] == block3.lock());
+
+  // No route in the other direction:
+  REQUIRE_FALSE(world->trainPathFinder->findRoute(block1.lock(), BlockTrainDirection::TowardsA, block3.lock(), BlockTrainDirection::TowardsB));
+  REQUIRE(world->trainPathFinder->route.empty());
+
+  // Reserve the route:
+  REQUIRE(world->trainPathFinder->reserve(block1.lock(), BlockTrainDirection::TowardsB, block3.lock(), BlockTrainDirection::TowardsB));
+  REQUIRE(world->trainPathFinder->route.size() == 3);
+
+  REQUIRE(block2.lock()->state == BlockState::Reserved);
+  REQUIRE(block2.lock()->trains.size() == 1);
+  REQUIRE(block2.lock()->trains.front()->direction.value() == BlockTrainDirection::TowardsB);
+  REQUIRE(block3.lock()->state == BlockState::Reserved);
+  REQUIRE(block3.lock()->trains.size() == 1);
+  REQUIRE(block3.lock()->trains.front()->direction.value() == BlockTrainDirection::TowardsB);
+
+  // Already reserved:
+  REQUIRE_FALSE(world->trainPathFinder->reserve(block1.lock(), BlockTrainDirection::TowardsB, block3.lock(), BlockTrainDirection::TowardsB));
+
+  world.reset();
+  REQUIRE(worldWeak.expired());
+  REQUIRE(boardWeak.expired());
+  REQUIRE(block1.expired());
+  REQUIRE(block2.expired());
+  REQUIRE(block3.expired());
+  REQUIRE(locomotive1.expired());
+  REQUIRE(train1.expired());
+}
+
+TEST_CASE("Board/TrainPathFinder: Rollback of a partially reserved route", "[board][train-path-finder]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  std::weak_ptr<World> worldWeak = world;
+
+  // Board:
+  // +-----+    +-----+
+  // |A 1 B|----|A 2 B|
+  // +-----+    +-----+
+  std::weak_ptr<Board> boardWeak = world->boards->create();
+
+  REQUIRE(boardWeak.lock()->addTile(0, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+  REQUIRE(boardWeak.lock()->addTile(1, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(boardWeak.lock()->addTile(2, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+
+  std::weak_ptr<BlockRailTile> block1 = std::dynamic_pointer_cast<BlockRailTile>(boardWeak.lock()->getTile({0, 0}));
+  REQUIRE_FALSE(block1.expired());
+  std::weak_ptr<BlockRailTile> block2 = std::dynamic_pointer_cast<BlockRailTile>(boardWeak.lock()->getTile({2, 0}));
+  REQUIRE_FALSE(block2.expired());
+
+  REQUIRE(block1.lock()->setStateFree());
+  REQUIRE(block2.lock()->setStateFree());
+
+  // Create a train:
+  std::weak_ptr<RailVehicle> locomotive1 = world->railVehicles->create(Locomotive::classId);
+  std::weak_ptr<Train> train1 = world->trains->create();
+  train1.lock()->vehicles->add(locomotive1.lock());
+  REQUIRE(train1.lock()->vehicles->length == 1);
+
+  // Assign train to block 1:
+  block1.lock()->assignTrain(train1.lock());
+  REQUIRE(block1.lock()->state == BlockState::Reserved);
+  REQUIRE(block1.lock()->trains.front()->direction.value() == BlockTrainDirection::TowardsB);
+
+  world->run(); // this will build the board network
+  world->stop();
+
+  REQUIRE(block1.lock()->paths().size() == 1);
+  REQUIRE(block2.lock()->paths().size() == 1);
+  const auto path12 = block1.lock()->paths().front();
+  const auto path21 = block2.lock()->paths().front();
+
+  // Both paths pass the dry run, but the second one needs block 2 side A which is reserved by the first one:
+  TrainPathFinder::Route route;
+  route.paths = {path12, path21};
+  REQUIRE(path12->reserve(train1.lock(), true));
+  REQUIRE(path21->reserve(train1.lock(), true));
+  REQUIRE_FALSE(TrainPathFinder::reserveRoute(route, train1.lock()));
+
+  // Nothing of the first path may be left reserved:
+  REQUIRE_FALSE(path12->isReserved());
+  REQUIRE_FALSE(path21->isReserved());
+  REQUIRE_FALSE(block1.lock()->getReservedPath(BlockSide::B));
+  REQUIRE_FALSE(block2.lock()->getReservedPath(BlockSide::A));
+  REQUIRE(block1.lock()->trains.size() == 1);
+  REQUIRE(block2.lock()->trains.empty());
+  REQUIRE(block2.lock()->state == BlockState::Free);
+
+  // Reserving the first path must still be possible:
+  REQUIRE(world->trainPathFinder->reserve(block1.lock(), BlockTrainDirection::TowardsB, block2.lock(), BlockTrainDirection::TowardsB));
+  REQUIRE(block1.lock()->getReservedPath(BlockSide::B) == path12);
+  REQUIRE(block2.lock()->trains.size() == 1);
+
+  world.reset();
+  REQUIRE(worldWeak.expired());
+  REQUIRE(boardWeak.expired());
+  REQUIRE(block1.expired());
+  REQUIRE(block2.expired());
+  REQUIRE(locomotive1.expired());
+  REQUIRE(train1.expired());
+}
+
+TEST_CASE("Board/TrainPathFinder: Block graph index is updated for changed paths", "[board][train-path-finder]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  std::weak_ptr<World> worldWeak = world;
+
+  // Board:
+  // +-----+    +-----+    +-----+
+  // |A 1 B|----|A 2 B|----|A 3 B|
+  // +-----+    +-----+    +-----+
+  std::weak_ptr<Board> boardWeak = world->boards->create();
+
+  REQUIRE(boardWeak.lock()->addTile(0, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+  REQUIRE(boardWeak.lock()->addTile(1, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(boardWeak.lock()->addTile(2, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+  REQUIRE(boardWeak.lock()->addTile(3, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+  REQUIRE(boardWeak.lock()->addTile(4, 0, TileRotate::Deg90, BlockRailTile::classId, false));
+
+  std::weak_ptr<BlockRailTile> block1 = std::dynamic_pointer_cast<BlockRailTile>(boardWeak.lock()->getTile({0, 0}));
+  REQUIRE_FALSE(block1.expired());
+  std::weak_ptr<BlockRailTile> block2 = std::dynamic_pointer_cast<BlockRailTile>(boardWeak.lock()->getTile({2, 0}));
+  REQUIRE_FALSE(block2.expired());
+  std::weak_ptr<BlockRailTile> block3 = std::dynamic_pointer_cast<BlockRailTile>(boardWeak.lock()->getTile({4, 0}));
+  REQUIRE_FALSE(block3.expired());
+
+  world->run(); // this will build the board network
+  world->stop();
+
+  const auto& graph = world->trainPathFinder->blockGraph();
+  REQUIRE(graph.isValid());
+  REQUIRE(graph.edgeCount() == 4);
+  const auto block2Index = graph.blockIndex(*block2.lock());
+  REQUIRE(block2Index != BlockGraph::invalidIndex);
+  REQUIRE(graph.edges(BlockGraph::vertex(block2Index, BlockSide::B)).size() == 1);
+
+  // disconnect block 2 and 3, only their edges are replaced:
+  REQUIRE(boardWeak.lock()->deleteTile(3, 0));
+  world->run(); // this will update the board network
+  world->stop();
+
+  REQUIRE(world->trainPathFinder->blockGraph().isValid());
+  REQUIRE_FALSE(graph.isOutdated());
+  REQUIRE(graph.blockIndex(*block2.lock()) == block2Index);
+  REQUIRE(graph.edges(BlockGraph::vertex(block2Index, BlockSide::B)).empty());
+  REQUIRE(graph.edges(BlockGraph::vertex(block2Index, BlockSide::A)).size() == 1);
+  REQUIRE(graph.edgeCount() == 4); // replaced in place, not rebuilt
+  REQUIRE(world->trainPathFinder->findRoute(block1.lock(), BlockTrainDirection::TowardsB, block2.lock(), BlockTrainDirection::TowardsB));
+  REQUIRE_FALSE(world->trainPathFinder->findRoute(block1.lock(), BlockTrainDirection::TowardsB, block3.lock(), BlockTrainDirection::TowardsB));
+
+  // connect them again:
+  REQUIRE(boardWeak.lock()->addTile(3, 0, TileRotate::Deg90, StraightRailTile::classId, false));
+  world->run();
+  world->stop();
+
+  REQUIRE(world->trainPathFinder->blockGraph().isValid());
+  REQUIRE(graph.edges(BlockGraph::vertex(block2Index, BlockSide::B)).size() == 1);
+  REQUIRE(world->trainPathFinder->findRoute(block1.lock(), BlockTrainDirection::TowardsB, block3.lock(), BlockTrainDirection::TowardsB));
+  REQUIRE(world->trainPathFinder->route.size() == 3);
+
+  world.reset();
+  REQUIRE(worldWeak.expired());
+  REQUIRE(boardWeak.expired());
+}
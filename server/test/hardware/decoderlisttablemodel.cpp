@@ -0,0 +1,141 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/world/world.hpp"
+#include "../../src/hardware/decoder/decoder.hpp"
+#include "../../src/hardware/decoder/list/decoderlist.hpp"
+#include "../../src/hardware/decoder/list/decoderlisttablemodel.hpp"
+#include "../../src/utils/displayname.hpp"
+
+namespace {
+
+std::vector<std::string> getIds(const TableModel& model)
+{
+  std::vector<std::string> ids;
+  for(uint32_t row = 0; row < model.rowCount(); row++)
+    ids.emplace_back(model.getText(0, row));
+  return ids;
+}
+
+}
+
+TEST_CASE("DecoderListTableModel: sort, search and filter", "[hardware][tablemodel]")
+{
+  using Ids = std::vector<std::string>;
+
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto decoderC = Decoder::create(*world);
+  decoderC->id = "dec_c";
+  auto decoderA = Decoder::create(*world);
+  decoderA->id = "dec_a";
+  auto decoderB = Decoder::create(*world);
+  decoderB->id = "dec_b";
+
+  auto model = std::dynamic_pointer_cast<DecoderListTableModel>(world->decoders->getModel());
+  REQUIRE(model);
+  REQUIRE(model->isViewSupported());
+  REQUIRE(model->columnHeaders()[0] == DisplayName::Object::id);
+  REQUIRE(getIds(*model) == Ids{"dec_c", "dec_a", "dec_b"});
+
+  model->setSort(0, false);
+  REQUIRE(getIds(*model) == Ids{"dec_a", "dec_b", "dec_c"});
+
+  model->setSort(0, true);
+  REQUIRE(getIds(*model) == Ids{"dec_c", "dec_b", "dec_a"});
+
+  model->setSort(0, false);
+  model->setSearch("C_B");
+  REQUIRE(getIds(*model) == Ids{"dec_b"});
+
+  model->setSearch("dec_");
+  REQUIRE(getIds(*model) == Ids{"dec_a", "dec_b", "dec_c"});
+
+  // changed item moves to its sorted row:
+  decoderB->id = "dec_d";
+  REQUIRE(getIds(*model) == Ids{"dec_a", "dec_c", "dec_d"});
+
+  // added item is inserted at its sorted row, or left out if it doesn't match:
+  auto decoderE = Decoder::create(*world);
+  decoderE->id = "dec_b";
+  REQUIRE(getIds(*model) == Ids{"dec_a", "dec_b", "dec_c", "dec_d"});
+  auto decoderF = Decoder::create(*world);
+  REQUIRE(getIds(*model) == Ids{"dec_a", "dec_b", "dec_c", "dec_d"});
+  decoderF->id = "dec_0";
+  REQUIRE(getIds(*model) == Ids{"dec_0", "dec_a", "dec_b", "dec_c", "dec_d"});
+
+  // removed item:
+  decoderA->destroy();
+  decoderA.reset();
+  REQUIRE(getIds(*model) == Ids{"dec_0", "dec_b", "dec_c", "dec_d"});
+
+  model->setFilter(
+    [](const Decoder& decoder)
+    {
+      return decoder.id.value() != "dec_c";
+    });
+  REQUIRE(getIds(*model) == Ids{"dec_0", "dec_b", "dec_d"});
+
+  // translated texts, like the protocol, aren't searched:
+  model->setView(0, true, "protocol");
+  REQUIRE(getIds(*model).empty());
+  model->setView(0, true, "dec_");
+  REQUIRE(getIds(*model) == Ids{"dec_d", "dec_b", "dec_0"});
+
+  // no view, list order:
+  model->setFilter(nullptr);
+  model->setSearch("");
+  model->setSort(TableModel::invalidColumn, false);
+  REQUIRE(getIds(*model) == Ids{"dec_c", "dec_d", "dec_b", "dec_0"});
+}
+
+TEST_CASE("DecoderListTableModel: typed values", "[hardware][tablemodel]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto decoder = Decoder::create(*world);
+  decoder->id = "dec";
+
+  auto model = std::dynamic_pointer_cast<DecoderListTableModel>(world->decoders->getModel());
+  REQUIRE(model);
+  REQUIRE(model->rowCount() == 1);
+
+  const auto& headers = model->columnHeaders();
+  const auto addressColumn = static_cast<uint32_t>(std::distance(headers.begin(), std::find(headers.begin(), headers.end(), DisplayName::Hardware::address)));
+  REQUIRE(addressColumn < model->columnCount());
+
+  REQUIRE(model->getValue(0, 0) == TableModel::Value{std::string("dec")});
+
+  decoder->protocol.setValueInternal(DecoderProtocol::None);
+  REQUIRE(model->getValue(addressColumn, 0) == TableModel::Value{std::string()});
+
+  decoder->protocol.setValueInternal(DecoderProtocol::DCCLong);
+  decoder->address.setValueInternal(1234);
+  REQUIRE(model->getValue(addressColumn, 0) == TableModel::Value{int64_t{1234}});
+  REQUIRE(model->getText(addressColumn, 0) == "1234");
+}
@@ -0,0 +1,162 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <future>
+#include "../src/core/eventloop.hpp"
+#include "../src/core/iothreadpool.hpp"
+#include "../src/hardware/protocol/kernelbase.hpp"
+
+namespace {
+
+class TestKernel final : public KernelBase
+{
+  public:
+    TestKernel()
+      : KernelBase("test")
+    {
+    }
+
+    void start()
+    {
+      startExecutor("test");
+    }
+
+    void stop(std::function<void()> lastHandler = [](){})
+    {
+      stopExecutor(std::move(lastHandler));
+    }
+
+    template<class F>
+    void post(F&& f)
+    {
+      boost::asio::post(m_executor, std::forward<F>(f));
+    }
+};
+
+constexpr int serializedCount = 10'000;
+
+struct SerializedResult
+{
+  int count;
+  bool overlap;
+  bool notKernelThread;
+  bool callerIsKernelThread;
+};
+
+//! \brief Post handlers to the kernel, doesn't use REQUIRE so it can run on any thread.
+SerializedResult runSerialized(TestKernel& kernel)
+{
+  std::atomic_int running = 0;
+  std::atomic_bool overlap = false;
+  std::atomic_bool notKernelThread = false;
+  int counter = 0; // only accessed from kernel handlers
+  std::promise<int> done;
+
+  for(int i = 0; i < serializedCount; i++)
+  {
+    kernel.post(
+      [&]()
+      {
+        if(running.fetch_add(1) != 0)
+          overlap = true;
+        if(!kernel.isKernelThread())
+          notKernelThread = true;
+        const bool last = (++counter == serializedCount);
+        running.fetch_sub(1);
+        if(last)
+          done.set_value(counter);
+      });
+  }
+
+  const int n = done.get_future().get();
+  return {n, overlap, notKernelThread, kernel.isKernelThread()};
+}
+
+void requireSerialized(const SerializedResult& result)
+{
+  REQUIRE(result.count == serializedCount);
+  REQUIRE_FALSE(result.overlap);
+  REQUIRE_FALSE(result.notKernelThread);
+  REQUIRE_FALSE(result.callerIsKernelThread);
+}
+
+}
+
+TEST_CASE("Kernel executor: dedicated thread", "[kernel]")
+{
+  EventLoop::threadId = std::this_thread::get_id();
+  REQUIRE_FALSE(IOThreadPool::isRunning());
+
+  auto kernel = std::make_unique<TestKernel>();
+  kernel->start();
+  requireSerialized(runSerialized(*kernel));
+
+  bool lastHandlerRun = false;
+  kernel->stop([&lastHandlerRun]() { lastHandlerRun = true; });
+  REQUIRE(lastHandlerRun);
+  REQUIRE_FALSE(kernel->isExecutorActive());
+
+  bool discarded = true;
+  kernel->post([&discarded]() { discarded = false; });
+  kernel.reset();
+  REQUIRE(discarded);
+}
+
+TEST_CASE("Kernel executor: IO thread pool", "[kernel]")
+{
+  EventLoop::threadId = std::this_thread::get_id();
+  IOThreadPool::start(4, false);
+  REQUIRE(IOThreadPool::threadCount() == 4);
+
+  std::atomic_bool discarded = true;
+  {
+    TestKernel kernelA;
+    TestKernel kernelB;
+    kernelA.start();
+    kernelB.start();
+
+    auto a = std::async(std::launch::async, [&kernelA]() { return runSerialized(kernelA); });
+    const auto resultB = runSerialized(kernelB);
+    requireSerialized(a.get());
+    requireSerialized(resultB);
+
+    bool lastHandlerRun = false;
+    kernelA.stop([&lastHandlerRun]() { lastHandlerRun = true; });
+    REQUIRE(lastHandlerRun);
+    REQUIRE_FALSE(kernelA.isExecutorActive());
+    REQUIRE(kernelB.isExecutorActive());
+
+    // kernel B keeps running on the pool:
+    std::promise<void> done;
+    kernelB.post([&done]() { done.set_value(); });
+    done.get_future().get();
+
+    kernelA.post([&discarded]() { discarded = false; });
+    kernelB.stop();
+  }
+
+  IOThreadPool::stop(); // runs all queued handlers
+  REQUIRE_FALSE(IOThreadPool::isRunning());
+  REQUIRE(discarded);
+}
@@ -0,0 +1,123 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <catch2/catch_test_macros.hpp>
+#include "../src/core/eventloop.hpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/world/world.hpp"
+#include "../src/hardware/interface/interfacelist.hpp"
+#include "../src/hardware/interface/loconetinterface.hpp"
+#include "../src/hardware/output/outputscheduler.hpp"
+
+namespace {
+
+void runUntil(const bool& done)
+{
+  for(int i = 0; !done && i < 100; i++)
+  {
+    EventLoop::ioContext().run_one_for(std::chrono::milliseconds(100));
+  }
+}
+
+}
+
+TEST_CASE("OutputScheduler: pass through by default", "[output][scheduler]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto interface = std::dynamic_pointer_cast<LocoNetInterface>(world->interfaces->create(LocoNetInterface::classId));
+  REQUIRE(interface);
+  auto& scheduler = *interface->outputScheduler;
+
+  bool completed = false;
+  {
+    OutputScheduler::Group group([&completed]() { completed = true; });
+    REQUIRE_FALSE(scheduler.schedule(OutputChannel::Accessory, OutputAddress{1}, OutputPairValue::First)); // offline
+    REQUIRE(scheduler.queueSize() == 0);
+    REQUIRE(scheduler.activeCount() == 0);
+    REQUIRE_FALSE(completed);
+  }
+  REQUIRE(completed);
+}
+
+TEST_CASE("OutputScheduler: pace group", "[output][scheduler]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto interface = std::dynamic_pointer_cast<LocoNetInterface>(world->interfaces->create(LocoNetInterface::classId));
+  REQUIRE(interface);
+  auto& scheduler = *interface->outputScheduler;
+  scheduler.maxActiveCommands = 1;
+  scheduler.activationTime = 20;
+
+  bool completed = false;
+  {
+    OutputScheduler::Group group([&completed]() { completed = true; });
+
+    REQUIRE(scheduler.schedule(OutputChannel::Accessory, OutputAddress{1}, OutputPairValue::First));
+    REQUIRE(scheduler.queueSize() == 0);
+    REQUIRE(scheduler.activeCount() == 1);
+
+    REQUIRE(scheduler.schedule(OutputChannel::Accessory, OutputAddress{2}, OutputPairValue::First));
+    REQUIRE(scheduler.queueSize() == 1);
+
+    // same output is coalesced:
+    REQUIRE(scheduler.schedule(OutputChannel::Accessory, OutputAddress{2}, OutputPairValue::Second));
+    REQUIRE(scheduler.queueSize() == 1);
+
+    // low priority waits for the normal priority commands of the group:
+    group.setPriority(OutputScheduler::Priority::Low);
+    REQUIRE(scheduler.schedule(OutputChannel::Accessory, OutputAddress{3}, OutputPairValue::Second));
+    REQUIRE(scheduler.queueSize() == 1);
+    REQUIRE(scheduler.activeCount() == 1);
+  }
+  REQUIRE_FALSE(completed);
+
+  runUntil(completed);
+  REQUIRE(completed);
+  REQUIRE(scheduler.queueSize() == 0);
+  REQUIRE(scheduler.activeCount() == 0);
+}
+
+TEST_CASE("OutputScheduler: destroy completes group", "[output][scheduler]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto interface = std::dynamic_pointer_cast<LocoNetInterface>(world->interfaces->create(LocoNetInterface::classId));
+  REQUIRE(interface);
+  interface->outputScheduler->commandInterval = 1000;
+
+  bool completed = false;
+  {
+    OutputScheduler::Group group([&completed]() { completed = true; });
+    REQUIRE(interface->outputScheduler->schedule(OutputChannel::Accessory, OutputAddress{1}, OutputPairValue::First));
+    REQUIRE(interface->outputScheduler->schedule(OutputChannel::Accessory, OutputAddress{2}, OutputPairValue::First));
+    REQUIRE(interface->outputScheduler->queueSize() == 1);
+  }
+  REQUIRE_FALSE(completed);
+
+  world->interfaces->delete_(interface);
+  REQUIRE(completed);
+}
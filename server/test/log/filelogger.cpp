@@ -0,0 +1,150 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <iterator>
+#include <thread>
+#include <traintastic/locale/locale.hpp>
+#include "../../src/log/filelogger.hpp"
+
+namespace {
+
+class TestEnvironment
+{
+  public:
+    const std::filesystem::path dir;
+    const std::filesystem::path filename;
+
+    TestEnvironment(std::string_view name)
+      : dir{std::filesystem::temp_directory_path() / "traintastic-test-filelogger" / name}
+      , filename{dir / "traintastic.txt"}
+    {
+      std::filesystem::remove_all(dir);
+      std::filesystem::create_directories(dir);
+
+      // the file logger uses the locale to format the messages:
+      const auto localeFilename = dir / "test.lang";
+      {
+        std::ofstream file(localeFilename, std::ios::binary);
+        write(file, "message:I1001");
+        write(file, "Traintastic v%1");
+        write(file, "message:C1004");
+        write(file, "Reading world %1 failed: %2");
+      }
+      Locale::instance = std::make_unique<Locale>(localeFilename);
+    }
+
+    ~TestEnvironment()
+    {
+      Locale::instance.reset();
+      std::error_code ec;
+      std::filesystem::remove_all(dir, ec);
+    }
+
+    static std::string read(const std::filesystem::path& path)
+    {
+      std::ifstream file(path, std::ios::binary);
+      return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+  private:
+    static void write(std::ofstream& file, std::string_view value)
+    {
+      const auto length = static_cast<uint32_t>(value.size());
+      file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+      file.write(value.data(), static_cast<std::streamsize>(value.size()));
+      file.write("\0\0\0", (4 - length % 4) % 4);
+    }
+};
+
+}
+
+TEST_CASE("FileLogger: flush on destruction", "[log]")
+{
+  TestEnvironment env("flush");
+
+  FileLogger::Options options;
+  options.flushInterval = std::chrono::hours(1);
+
+  {
+    FileLogger logger(env.filename, options);
+    const auto now = std::chrono::system_clock::now();
+
+    // critical messages are written immediately:
+    logger.log(now, "world", LogMessage::C1004_READING_WORLD_FAILED_X_X, {"test.ctw", std::string(200, 'x')});
+    for(int i = 0; i < 500 && TestEnvironment::read(env.filename).find("C1004") == std::string::npos; i++)
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    REQUIRE(TestEnvironment::read(env.filename).find(";world;C1004;Reading world test.ctw failed: " + std::string(200, 'x') + "\n") != std::string::npos);
+
+    // these wait for the flush interval, they may reuse the written record:
+    logger.log(now, "a", LogMessage::I1001_TRAINTASTIC_VX, {"1"});
+    logger.log(now, "b", LogMessage::I1001_TRAINTASTIC_VX);
+    REQUIRE(TestEnvironment::read(env.filename).find(";a;I1001;") == std::string::npos);
+  }
+
+  const std::string log = TestEnvironment::read(env.filename);
+  REQUIRE(log.starts_with("=== Traintastic v"));
+  REQUIRE(log.find(";a;I1001;Traintastic v1\n") != std::string::npos);
+  REQUIRE(log.find(";b;I1001;Traintastic v%1\n") != std::string::npos);
+}
+
+TEST_CASE("FileLogger: rotation", "[log]")
+{
+  TestEnvironment env("rotation");
+
+  FileLogger::Options options;
+  options.rotateSize = 256;
+  options.rotateCount = 2;
+
+  const auto rotated =
+    [&env](unsigned int n)
+    {
+      return env.dir / ("traintastic." + std::to_string(n) + ".txt");
+    };
+
+  // every run exceeds the rotate size, the remaining messages are written and the file is rotated on destruction:
+  for(int run = 1; run <= 3; run++)
+  {
+    FileLogger logger(env.filename, options);
+    const auto now = std::chrono::system_clock::now();
+    for(int i = 0; i < 10; i++)
+      logger.log(now, "run" + std::to_string(run), LogMessage::I1001_TRAINTASTIC_VX, {std::to_string(i)});
+  }
+
+  REQUIRE(std::filesystem::exists(env.filename));
+  REQUIRE(std::filesystem::exists(rotated(1)));
+  REQUIRE(std::filesystem::exists(rotated(2)));
+  REQUIRE_FALSE(std::filesystem::exists(rotated(3)));
+
+  const std::string current = TestEnvironment::read(env.filename);
+  REQUIRE(current.starts_with("=== Traintastic v"));
+  REQUIRE(current.find(";run") == std::string::npos);
+
+  const std::string last = TestEnvironment::read(rotated(1));
+  REQUIRE(last.find(";run3;I1001;Traintastic v9\n") != std::string::npos);
+  REQUIRE(last.find(";run2;") == std::string::npos);
+
+  const std::string previous = TestEnvironment::read(rotated(2));
+  REQUIRE(previous.find(";run2;I1001;Traintastic v0\n") != std::string::npos);
+  REQUIRE(previous.find(";run1;") == std::string::npos);
+}
@@ -0,0 +1,97 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/log/memorylogger.hpp"
+
+TEST_CASE("MemoryLogger: ring buffer", "[log]")
+{
+  EventLoop::threadId = std::this_thread::get_id();
+
+  MemoryLogger logger(3);
+  uint32_t totalAdded = 0;
+  uint32_t totalRemoved = 0;
+  logger.changed.connect(
+    [&totalAdded, &totalRemoved](const MemoryLogger& /*logger*/, uint32_t added, uint32_t removed)
+    {
+      totalAdded += added;
+      totalRemoved += removed;
+    });
+
+  const auto now = std::chrono::system_clock::now();
+  for(int i = 0; i < 5; i++)
+  {
+    logger.log(now, (i % 2 == 0) ? "even" : "odd", LogMessage::I1001_TRAINTASTIC_VX, {std::to_string(i)});
+  }
+
+  REQUIRE(logger.size() == 3);
+  REQUIRE(totalAdded == 5);
+  REQUIRE(totalRemoved == 2);
+
+  // oldest first:
+  for(uint32_t i = 0; i < logger.size(); i++)
+  {
+    const auto log = logger[i];
+    REQUIRE(log.objectId == ((i % 2 == 0) ? "even" : "odd"));
+    REQUIRE(log.args.size() == 1);
+    REQUIRE(log.args[0] == std::to_string(i + 2));
+  }
+
+  // overwritten slot without arguments:
+  logger.log(now, "even", LogMessage::I1001_TRAINTASTIC_VX);
+  REQUIRE(logger.size() == 3);
+  REQUIRE(logger[0].args[0] == "3");
+  REQUIRE(logger[2].args.empty());
+
+  uint32_t count = 0;
+  for(const auto& log : logger)
+  {
+    REQUIRE(log.message == LogMessage::I1001_TRAINTASTIC_VX);
+    count++;
+  }
+  REQUIRE(count == 3);
+}
+
+TEST_CASE("MemoryLogger: object ids are released", "[log]")
+{
+  EventLoop::threadId = std::this_thread::get_id();
+
+  MemoryLogger logger(2);
+  const auto now = std::chrono::system_clock::now();
+  for(int i = 0; i < 100; i++)
+  {
+    logger.log(now, "object_" + std::to_string(i), LogMessage::I1001_TRAINTASTIC_VX, {std::to_string(i)});
+    REQUIRE(logger.objectIdCount() <= 2);
+  }
+
+  REQUIRE(logger[0].objectId == "object_98");
+  REQUIRE(logger[1].objectId == "object_99");
+
+  // same id in all slots:
+  logger.log(now, "world", LogMessage::I1001_TRAINTASTIC_VX);
+  logger.log(now, "world", LogMessage::I1001_TRAINTASTIC_VX);
+  REQUIRE(logger.objectIdCount() == 1);
+  logger.log(now, "world", LogMessage::I1001_TRAINTASTIC_VX);
+  REQUIRE(logger.objectIdCount() == 1);
+  REQUIRE(logger[0].objectId == "world");
+  REQUIRE(logger[1].objectId == "world");
+}
@@ -0,0 +1,130 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/lua/object.hpp"
+#include "../../src/lua/object/object.hpp"
+#include "../../src/lua/sandbox.hpp"
+#include "../../src/lua/scriptlist.hpp"
+#include "../../src/lua/to.hpp"
+#include "../../src/world/world.hpp"
+
+using namespace std::string_view_literals;
+
+TEST_CASE("Lua object: index", "[lua][lua-object]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  world->name = "Test";
+  auto script = world->luaScripts->create();
+
+  auto sandbox = Lua::Sandbox::create(*script);
+  lua_State* L = sandbox.get();
+
+  Lua::Object::push(L, world);
+  const int top = lua_gettop(L);
+
+  // read twice, the second read uses the dispatch table:
+  for(int i = 0; i < 2; i++)
+  {
+    lua_pushliteral(L, "name");
+    REQUIRE(Lua::Object::Object::index(L, *world) == 1);
+    REQUIRE(lua_tostring(L, -1) == "Test"sv);
+    lua_settop(L, top);
+
+    lua_pushliteral(L, "power_off");
+    REQUIRE(Lua::Object::Object::index(L, *world) == 1);
+    REQUIRE(lua_type(L, -1) == LUA_TUSERDATA);
+    lua_settop(L, top);
+
+    lua_pushliteral(L, "on_changed");
+    REQUIRE(Lua::Object::Object::index(L, *world) == 1);
+    REQUIRE(lua_type(L, -1) == LUA_TFUNCTION);
+    lua_settop(L, top);
+
+    lua_pushliteral(L, "unknown");
+    REQUIRE(Lua::Object::Object::index(L, *world) == 1);
+    REQUIRE(lua_isnil(L, -1));
+    lua_settop(L, top);
+
+    lua_pushinteger(L, 1);
+    REQUIRE(Lua::Object::Object::index(L, *world) == 1);
+    REQUIRE(lua_isnil(L, -1));
+    lua_settop(L, top);
+  }
+
+  // values are never cached:
+  world->name = "Changed";
+  lua_pushliteral(L, "name");
+  REQUIRE(Lua::Object::Object::index(L, *world) == 1);
+  REQUIRE(lua_tostring(L, -1) == "Changed"sv);
+  lua_settop(L, 0);
+
+  sandbox.reset();
+  world.reset();
+}
+
+TEST_CASE("Lua object: index benchmark", "[.benchmark][lua][lua-object]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto script = world->luaScripts->create();
+
+  auto sandbox = Lua::Sandbox::create(*script);
+  lua_State* L = sandbox.get();
+
+  Lua::Object::push(L, world);
+  lua_pushliteral(L, "scale_ratio");
+
+  BENCHMARK("Name lookup")
+  {
+    // the lookup as done before dispatch tables:
+    const auto key = Lua::to<std::string_view>(L, 2);
+    if(key == "on_changed")
+    {
+      return 0;
+    }
+    if(auto* property = dynamic_cast<AbstractProperty*>(world->getItem(key)))
+    {
+      Lua::Object::Object::pushPropertyValue(L, *property);
+    }
+    lua_pop(L, 1);
+    return 1;
+  };
+
+  BENCHMARK("Dispatch table")
+  {
+    const int r = Lua::Object::Object::index(L, *world);
+    lua_pop(L, 1);
+    return r;
+  };
+
+  lua_settop(L, 0);
+  sandbox.reset();
+  world.reset();
+}
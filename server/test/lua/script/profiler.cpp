@@ -0,0 +1,99 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../../src/core/eventloop.hpp"
+#include "../../../src/core/method.tpp"
+#include "../../../src/core/objectproperty.tpp"
+#include "../../../src/lua/scriptlist.hpp"
+#include "../../../src/world/world.hpp"
+
+TEST_CASE("Lua script: profiler", "[lua][lua-script][lua-script-profiler]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto script = world->luaScripts->create();
+
+  script->code =
+    "local t = {}\n"
+    "for i = 1, 10000 do\n"
+    "  t[i] = i\n"
+    "end\n"
+    "delay(0, function () local s = 0 end)";
+  script->start();
+  INFO(script->error.value());
+  REQUIRE(script->state.value() == LuaScriptState::Running);
+
+  const auto& handlers = script->profiler().handlers();
+  REQUIRE(handlers.contains("main"));
+  const auto& main = handlers.find("main")->second;
+  REQUIRE(main.calls == 1);
+  REQUIRE(main.instructions > 0);
+  REQUIRE(main.allocated > 0);
+  REQUIRE(main.percentile(0.99) <= main.max);
+  REQUIRE(script->profiler().lines().empty());
+
+  EventLoop::ioContext().run_for(std::chrono::milliseconds(100));
+  REQUIRE(handlers.contains("timer:5"));
+  REQUIRE(script->profiler().total().calls == 2);
+
+  script->stop();
+  REQUIRE(script->state.value() == LuaScriptState::Stopped);
+  REQUIRE(script->calls.value() == 2);
+  REQUIRE(script->instructions.value() > 0);
+  REQUIRE(script->memoryAllocated.value() > 0);
+
+  script->resetProfile();
+  REQUIRE(script->calls.value() == 0);
+  REQUIRE(script->profiler().handlers().empty());
+}
+
+TEST_CASE("Lua script: profiler sampling", "[lua][lua-script][lua-script-profiler]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto script = world->luaScripts->create();
+
+  script->profileSampling = true;
+  script->code =
+    "local x = 0\n"
+    "for i = 1, 20000 do\n"
+    "  x = x + i\n"
+    "end";
+  script->start();
+  INFO(script->error.value());
+  REQUIRE(script->state.value() == LuaScriptState::Running);
+
+  const auto& lines = script->profiler().lines();
+  REQUIRE_FALSE(lines.empty());
+  for(const auto& [line, stats] : lines)
+  {
+    REQUIRE(line >= 2);
+    REQUIRE(line <= 4);
+    REQUIRE(stats.samples > 0);
+  }
+  REQUIRE(script->profiler().report().find("line ") != std::string::npos);
+
+  script->stop();
+}
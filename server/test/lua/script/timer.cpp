@@ -0,0 +1,155 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <catch2/catch_test_macros.hpp>
+#include "../../../src/core/eventloop.hpp"
+#include "../../../src/core/method.tpp"
+#include "../../../src/core/objectproperty.tpp"
+#include "../../../src/core/timerwheel.hpp"
+#include "../../../src/lua/scriptlist.hpp"
+#include "../../../src/world/world.hpp"
+
+TEST_CASE("Lua script: delay, every and wait", "[lua][lua-script][lua-script-timer]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto script = world->luaScripts->create();
+
+  script->code =
+    "pv.delay = 0\n"
+    "pv.every = 0\n"
+    "pv.wait = 0\n"
+    "delay(0.02, function (n) pv.delay = pv.delay + n end, 2)\n"
+    "local t\n"
+    "t = every(0.01,\n"
+    "  function ()\n"
+    "    pv.every = pv.every + 1\n"
+    "    if pv.every == 3 then\n"
+    "      t.cancel()\n"
+    "    end\n"
+    "  end)\n"
+    "assert(t.active)\n"
+    "delay(0,\n"
+    "  function ()\n"
+    "    pv.wait = 1\n"
+    "    wait(0.03)\n"
+    "    pv.wait = pv.wait + 1\n"
+    "  end)";
+  script->start();
+  INFO(script->error.value());
+  REQUIRE(script->state.value() == LuaScriptState::Running);
+  REQUIRE(world->timerWheel().size() == 3);
+
+  // run until all timers are done:
+  EventLoop::ioContext().run_for(std::chrono::milliseconds(500));
+  REQUIRE(world->timerWheel().size() == 0);
+
+  script->stop();
+  REQUIRE(script->state.value() == LuaScriptState::Stopped);
+
+  script->code =
+    "assert(pv.delay == 2)\n"
+    "assert(pv.every == 3)\n"
+    "assert(pv.wait == 2)";
+  script->start();
+  INFO(script->error.value());
+  REQUIRE(script->state.value() == LuaScriptState::Running);
+  script->stop();
+}
+
+TEST_CASE("Lua script: timers are cancelled when stopped", "[lua][lua-script][lua-script-timer]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto script = world->luaScripts->create();
+
+  script->code =
+    "for i = 1, 1000 do\n"
+    "  delay(10, function () end)\n"
+    "end\n"
+    "every(1, function () end)\n"
+    "delay(0, function () wait(10) end)";
+  script->start();
+  INFO(script->error.value());
+  REQUIRE(script->state.value() == LuaScriptState::Running);
+  REQUIRE(world->timerWheel().size() == 1002);
+
+  // let the last timer function start waiting:
+  EventLoop::ioContext().run_for(std::chrono::milliseconds(50));
+  REQUIRE(world->timerWheel().size() == 1002);
+
+  script->stop();
+  REQUIRE(script->state.value() == LuaScriptState::Stopped);
+  REQUIRE(world->timerWheel().size() == 0);
+}
+
+TEST_CASE("Lua script: wait outside a coroutine", "[lua][lua-script][lua-script-timer]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto script = world->luaScripts->create();
+
+  script->code = "wait(1)";
+  script->start();
+  REQUIRE(script->state.value() == LuaScriptState::Error);
+  REQUIRE(world->timerWheel().size() == 0);
+}
+
+TEST_CASE("Lua script: wait in a coroutine of the script", "[lua][lua-script][lua-script-timer]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto script = world->luaScripts->create();
+
+  script->code =
+    "local co = coroutine.create(function () wait(0.01) return 42 end)\n"
+    "local ok, err = coroutine.resume(co)\n"
+    "assert(not ok)\n"
+    "assert(string.find(err, 'wait can only be used in a function started by delay or every', 1, true))\n"
+    "assert(coroutine.status(co) == 'dead')\n"
+    "pv.nested = 0\n"
+    "delay(0,\n"
+    "  function ()\n"
+    "    local ok = coroutine.resume(coroutine.create(function () wait(0.01) end))\n"
+    "    pv.nested = ok and 1 or 2\n"
+    "    wait(0.01)\n"
+    "    pv.nested = pv.nested + 1\n"
+    "  end)";
+  script->start();
+  INFO(script->error.value());
+  REQUIRE(script->state.value() == LuaScriptState::Running);
+  REQUIRE(world->timerWheel().size() == 1);
+
+  EventLoop::ioContext().run_for(std::chrono::milliseconds(200));
+  REQUIRE(world->timerWheel().size() == 0);
+
+  script->stop();
+  script->code = "assert(pv.nested == 3)";
+  script->start();
+  INFO(script->error.value());
+  REQUIRE(script->state.value() == LuaScriptState::Running);
+  script->stop();
+}
@@ -0,0 +1,124 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <thread>
+#include "../../src/pcap/pcapfile.hpp"
+#include "../../src/utils/rotatefile.hpp"
+
+namespace {
+
+constexpr uint32_t network = 147; // DLT_USER0
+constexpr size_t globalHeaderSize = 24;
+constexpr size_t recordHeaderSize = 16;
+
+//! \return Payload of all records in the capture file.
+std::vector<std::string> readRecords(const std::filesystem::path& filename)
+{
+  std::vector<std::string> records;
+  std::ifstream file(filename, std::ios::binary);
+  file.seekg(globalHeaderSize);
+  uint32_t header[recordHeaderSize / sizeof(uint32_t)];
+  while(file.read(reinterpret_cast<char*>(header), sizeof(header)))
+  {
+    std::string payload(header[2], '\0'); // incl_len
+    if(!file.read(payload.data(), static_cast<std::streamsize>(payload.size())))
+      break;
+    records.emplace_back(std::move(payload));
+  }
+  return records;
+}
+
+std::filesystem::path testDirectory(std::string_view name)
+{
+  const auto dir = std::filesystem::temp_directory_path() / "traintastic-test-pcap" / name;
+  std::filesystem::remove_all(dir);
+  return dir;
+}
+
+}
+
+TEST_CASE("PCAPFile: write when the buffer is full", "[pcap]")
+{
+  const auto dir = testDirectory("buffer");
+  const auto filename = dir / "test.pcap";
+  const std::string payload(200, 'x');
+  const size_t count = 64 * 1024 / (recordHeaderSize + payload.size()) + 1; // just over the 64 KiB buffer size
+
+  {
+    PCAPFile pcap("pcap", filename, network);
+    for(size_t i = 0; i < count; i++)
+      pcap.writeRecord(payload.data(), static_cast<uint32_t>(payload.size()));
+
+    // the writer is woken by the full buffer, not the one second flush interval:
+    const auto start = std::chrono::steady_clock::now();
+    while(std::filesystem::file_size(filename) < globalHeaderSize + count * (recordHeaderSize + payload.size()) &&
+        std::chrono::steady_clock::now() - start < std::chrono::milliseconds(500))
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    REQUIRE(std::filesystem::file_size(filename) == globalHeaderSize + count * (recordHeaderSize + payload.size()));
+
+    // less than the buffer size, waits for the flush interval or destruction:
+    pcap.writeRecord("end", 3);
+  }
+
+  const auto records = readRecords(filename);
+  REQUIRE(records.size() == count + 1);
+  REQUIRE(records.front() == payload);
+  REQUIRE(records.back() == "end");
+
+  std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("PCAPFile: rotation", "[pcap]")
+{
+  const auto dir = testDirectory("rotation");
+  const auto filename = dir / "test.pcap";
+
+  PCAPFile::Options options;
+  options.rotateSize = 1000;
+  options.rotateCount = 2;
+
+  // every run exceeds the rotate size, the file is rotated when the remaining records are written on destruction:
+  for(char run = '1'; run <= '3'; run++)
+  {
+    PCAPFile pcap("pcap", filename, network, options);
+    const std::string payload(100, run);
+    for(int i = 0; i < 10; i++)
+      pcap.writeRecord(payload.data(), static_cast<uint32_t>(payload.size()));
+  }
+
+  REQUIRE(std::filesystem::file_size(filename) == globalHeaderSize);
+  REQUIRE_FALSE(std::filesystem::exists(rotatedFilename(filename, 3)));
+
+  const auto last = readRecords(rotatedFilename(filename, 1));
+  REQUIRE(last.size() == 10);
+  REQUIRE(last.front() == std::string(100, '3'));
+
+  const auto previous = readRecords(rotatedFilename(filename, 2));
+  REQUIRE(previous.size() == 10);
+  REQUIRE(previous.front() == std::string(100, '2'));
+
+  std::filesystem::remove_all(dir);
+}
@@ -29,6 +29,7 @@
 #include "../../src/vehicle/rail/locomotive.hpp"
 #include "../../src/train/trainlist.hpp"
 #include "../../src/train/train.hpp"
+#include "../../src/train/trainmotionscheduler.hpp"
 #include "../../src/train/trainvehiclelist.hpp"
 #include "../../src/hardware/decoder/decoder.hpp"
 #include "../../src/log/logmessageexception.hpp"
@@ -186,3 +187,58 @@ TEST_CASE("Delete rail vehicle in inactive train", "[train]")
   REQUIRE(trainWeak.expired());
   REQUIRE(worldWeak.expired());
 }
+
+TEST_CASE("Train motion: acceleration model", "[train]")
+{
+  TrainMotionScheduler::Motion motion{nullptr, 0, 20, 1.0, 0.5, 0};
+
+  // standstill, limited by acceleration rate:
+  const double a0 = TrainMotionScheduler::acceleration(motion);
+  REQUIRE(a0 > 0);
+  REQUIRE(a0 <= motion.accelerationRate);
+
+  // power limited, less acceleration at higher speed:
+  motion.powerPerMass = 5; // W/kg
+  motion.speed = 10;
+  const double a10 = TrainMotionScheduler::acceleration(motion);
+  REQUIRE(a10 < a0);
+  REQUIRE(a10 >= motion.accelerationRate * 0.1);
+
+  // target reached:
+  motion.speed = motion.targetSpeed;
+  REQUIRE(TrainMotionScheduler::acceleration(motion) == 0);
+
+  // braking, resistance adds to braking rate:
+  motion.targetSpeed = 0;
+  REQUIRE(TrainMotionScheduler::acceleration(motion) <= -motion.brakingRate);
+}
+
+TEST_CASE("Train motion: schedule and emergency stop", "[train]")
+{
+  EventLoop::reset();
+
+  auto world = World::create();
+  std::weak_ptr<World> worldWeak = world;
+
+  std::weak_ptr<RailVehicle> locomotiveWeak = world->railVehicles->create(Locomotive::classId);
+  std::weak_ptr<Train> trainWeak = world->trains->create();
+  trainWeak.lock()->vehicles->add(locomotiveWeak.lock());
+  trainWeak.lock()->active = true;
+  REQUIRE(trainWeak.lock()->active.value());
+  REQUIRE(trainWeak.lock()->isStopped.value());
+  REQUIRE(world->trainMotionScheduler().size() == 0);
+
+  trainWeak.lock()->throttleSpeed.setValue(50);
+  REQUIRE_FALSE(trainWeak.lock()->emergencyStop.value());
+  REQUIRE(world->trainMotionScheduler().size() == 1);
+  REQUIRE_FALSE(trainWeak.lock()->isStopped.value());
+
+  trainWeak.lock()->emergencyStop = true;
+  REQUIRE(world->trainMotionScheduler().size() == 0);
+  REQUIRE(trainWeak.lock()->isStopped.value());
+
+  world.reset();
+  REQUIRE(locomotiveWeak.expired());
+  REQUIRE(trainWeak.expired());
+  REQUIRE(worldWeak.expired());
+}
@@ -0,0 +1,141 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/world/world.hpp"
+#include "../../src/world/worldloader.hpp"
+#include "../../src/world/worldsaver.hpp"
+#include "../../src/board/board.hpp"
+#include "../../src/board/boardlist.hpp"
+#include "../../src/board/tile/rail/straightrailtile.hpp"
+#include "../../src/hardware/decoder/decoder.hpp"
+#include "../../src/hardware/decoder/decoderfunctions.hpp"
+#include "../../src/hardware/decoder/list/decoderlist.hpp"
+#include "../../src/train/train.hpp"
+#include "../../src/train/trainlist.hpp"
+#include "../../src/train/trainvehiclelist.hpp"
+#include "../../src/vehicle/rail/locomotive.hpp"
+#include "../../src/vehicle/rail/railvehiclelist.hpp"
+
+namespace {
+
+//! Create a world with a train, a locomotive and a decoder for each address and one large board.
+std::shared_ptr<World> createWorld(uint16_t trainCount)
+{
+  auto world = World::create();
+
+  for(uint16_t i = 1; i <= trainCount; i++)
+  {
+    auto locomotive = world->railVehicles->create(Locomotive::classId);
+    locomotive->createDecoder();
+    locomotive->decoder->address = i;
+    for(int f = 0; f < 8; f++)
+      locomotive->decoder->functions->create();
+
+    auto train = world->trains->create();
+    train->vehicles->add(locomotive);
+  }
+
+  auto board = world->boards->create();
+  for(int16_t y = 0; y < trainCount / 8; y++)
+    for(int16_t x = 0; x < 32; x++)
+      board->addTile(x, y, TileRotate::Deg90, StraightRailTile::classId, false);
+
+  return world;
+}
+
+std::filesystem::path saveWorld(const World& world, bool binary)
+{
+  auto ctw = std::filesystem::temp_directory_path() / std::string(world.uuid.value()).append(World::dotCTW);
+  WorldSaver saver(world, ctw,
+    WorldSaver::Options{
+      .isAutoSave = false,
+      .isExport = false,
+      .isBinary = binary,
+    });
+  return ctw;
+}
+
+}
+
+TEST_CASE("World: Load large world", "[world]")
+{
+  EventLoop::reset();
+
+  // large enough to stream the world file while parsing:
+  constexpr uint16_t trainCount = 1000;
+  const bool binary = GENERATE(false, true);
+  INFO("binary: " << binary);
+  const auto ctw = saveWorld(*createWorld(trainCount), binary);
+
+  {
+    WorldLoader loader(ctw);
+    auto world = loader.world();
+    REQUIRE(world);
+    REQUIRE(world->railVehicles->length == trainCount);
+    REQUIRE(world->trains->length == trainCount);
+    REQUIRE(world->decoders->length == trainCount);
+    REQUIRE(world->boards->length == 1);
+
+    for(const auto& train : *world->trains)
+    {
+      REQUIRE(train->vehicles->length == 1);
+    }
+    for(const auto& decoder : *world->decoders)
+    {
+      REQUIRE(decoder->functions->items.size() == 9);
+    }
+  }
+
+  REQUIRE(std::filesystem::remove(ctw));
+}
+
+TEST_CASE("World: Save/load benchmark", "[.benchmark][world]")
+{
+  EventLoop::reset();
+
+  const auto world = createWorld(5000);
+
+  for(const bool binary : {false, true})
+  {
+    const std::string format = binary ? "CBOR" : "JSON";
+
+    BENCHMARK("Save " + format)
+    {
+      return saveWorld(*world, binary);
+    };
+
+    const auto ctw = saveWorld(*world, binary);
+    WARN(format << " size: " << std::filesystem::file_size(ctw) << " bytes");
+
+    BENCHMARK("Load " + format)
+    {
+      return WorldLoader(ctw).world();
+    };
+
+    REQUIRE(std::filesystem::remove(ctw));
+  }
+}
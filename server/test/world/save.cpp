@@ -0,0 +1,66 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <catch2/catch_test_macros.hpp>
+#include <boost/uuid/string_generator.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/core/method.tpp"
+#include "../../src/core/objectproperty.tpp"
+#include "../../src/traintastic/settings.hpp"
+#include "../../src/traintastic/traintastic.hpp"
+#include "../../src/world/world.hpp"
+#include "../../src/world/worldlist.hpp"
+
+TEST_CASE("Load world while a save is pending", "[world][save]")
+{
+  EventLoop::reset();
+
+  const auto dataDir = std::filesystem::temp_directory_path() / "traintastic-k3w8vd";
+  std::filesystem::remove_all(dataDir);
+  {
+    Traintastic::instance = std::make_shared<Traintastic>(dataDir);
+    auto& traintastic = *Traintastic::instance;
+    traintastic.settings = std::make_shared<Settings>(dataDir);
+    traintastic.worldList = std::make_shared<WorldList>(traintastic.worldDir());
+
+    traintastic.newWorld();
+    REQUIRE(traintastic.world);
+    const std::string uuid = traintastic.world->uuid;
+
+    traintastic.world->name = "first";
+    traintastic.world->save();
+    traintastic.world->waitForSave();
+    REQUIRE(traintastic.worldList->find(boost::uuids::string_generator()(uuid)));
+
+    // save runs in the background, loading must wait for it:
+    traintastic.world->name = "second";
+    traintastic.world->save();
+    traintastic.loadWorld(uuid);
+    REQUIRE(traintastic.world);
+    REQUIRE(traintastic.world->name.value() == "second");
+
+    traintastic.closeWorld();
+    REQUIRE_FALSE(traintastic.world);
+    Traintastic::instance.reset();
+  }
+  std::filesystem::remove_all(dataDir);
+}
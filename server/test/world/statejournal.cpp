@@ -0,0 +1,106 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <map>
+#include "../src/core/eventloop.hpp"
+#include "../src/world/statejournal.hpp"
+
+namespace {
+
+constexpr std::string_view worldUUID = "00000000-0000-0000-0000-000000000001";
+
+using States = std::map<std::pair<std::string, std::string>, nlohmann::json>;
+
+States read(const std::filesystem::path& filename, uint64_t sequence, uint64_t* last = nullptr)
+{
+  States states;
+  const uint64_t n = StateJournal::read(filename, worldUUID, sequence,
+    [&states](uint64_t /*sequence*/, std::string_view objectId, std::string_view propertyName, const nlohmann::json& value)
+    {
+      states[{std::string(objectId), std::string(propertyName)}] = value;
+    });
+  if(last)
+    *last = n;
+  return states;
+}
+
+}
+
+TEST_CASE("StateJournal: replay and compact", "[world][statejournal]")
+{
+  EventLoop::threadId = std::this_thread::get_id();
+
+  const auto filename = std::filesystem::temp_directory_path() / "traintastic-test-statejournal.journal";
+  std::filesystem::remove(filename);
+
+  {
+    StateJournal journal(filename, std::string(worldUUID), 0, false);
+    journal.add("block_1", "state", "occupied");
+    journal.add("block_1", "state", "free");
+    journal.add("train_1", "speed", 12.5);
+    REQUIRE(journal.sequence() == 3);
+  } // destructor writes all records
+
+  uint64_t last = 0;
+  auto states = read(filename, 0, &last);
+  REQUIRE(last == 3);
+  REQUIRE(states.size() == 2);
+  REQUIRE(states[{"block_1", "state"}] == "free");
+  REQUIRE(states[{"train_1", "speed"}] == 12.5);
+
+  // records already in the world file are skipped:
+  states = read(filename, 2);
+  REQUIRE(states.size() == 1);
+  REQUIRE(states.count({"train_1", "speed"}) == 1);
+
+  // other world:
+  REQUIRE(StateJournal::read(filename, "00000000-0000-0000-0000-000000000002", 0, [](uint64_t, std::string_view, std::string_view, const nlohmann::json&) { FAIL(); }) == 0);
+
+  // continue journal, world file contains up to record 2:
+  {
+    StateJournal journal(filename, std::string(worldUUID), 2, true);
+    REQUIRE(journal.sequence() == 3);
+    journal.add("block_2", "state", "reserved");
+    REQUIRE(journal.sequence() == 4);
+
+    // world saved including record 3:
+    journal.compact(3);
+  }
+
+  states = read(filename, 0, &last);
+  REQUIRE(last == 4);
+  REQUIRE(states.size() == 1);
+  REQUIRE(states[{"block_2", "state"}] == "reserved");
+
+  // crash while writing, incomplete last record is ignored:
+  {
+    std::ofstream file(filename, std::ios::binary | std::ios::app);
+    const char partial[] = {0x20, 0x00, 0x00, 0x00, 0x05};
+    file.write(partial, sizeof(partial));
+  }
+  states = read(filename, 0, &last);
+  REQUIRE(last == 4);
+  REQUIRE(states.size() == 1);
+
+  REQUIRE(std::filesystem::remove(filename));
+}
@@ -0,0 +1,145 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+
+#include <catch2/catch_test_macros.hpp>
+#include <cmath>
+#include "../src/core/eventloop.hpp"
+#include "../src/core/method.tpp"
+#include "../src/core/objectproperty.tpp"
+#include "../src/core/timeseries.hpp"
+#include "../src/hardware/booster/list/boosterlist.hpp"
+#include "../src/hardware/interface/interfacelist.hpp"
+#include "../src/hardware/interface/loconetinterface.hpp"
+#include "../src/world/telemetry.hpp"
+#include "../src/world/world.hpp"
+
+TEST_CASE("TimeSeries: downsample", "[telemetry]")
+{
+  constexpr int64_t t0 = 1'700'000'000 - (1'700'000'000 % 3'600); // start of an hour
+
+  TimeSeries series;
+  REQUIRE(series.empty());
+
+  series.add(t0, std::numeric_limits<float>::quiet_NaN());
+  REQUIRE(series.empty());
+
+  for(int64_t t = 0; t < 120; t++)
+  {
+    series.add(t0 + t, static_cast<float>(t));
+  }
+  REQUIRE_FALSE(series.empty());
+
+  const auto seconds = series.window(TimeSeriesResolution::Second, t0 + 10, t0 + 19);
+  REQUIRE(seconds.start == t0 + 10);
+  REQUIRE(seconds.period == 1);
+  REQUIRE(seconds.buckets.size() == 10);
+  REQUIRE(seconds.buckets[0].count == 1);
+  REQUIRE(seconds.buckets[0].min == 10.0f);
+  REQUIRE(seconds.buckets[9].average() == 19.0f);
+
+  const auto minutes = series.window(TimeSeriesResolution::Minute, t0, t0 + 179);
+  REQUIRE(minutes.start == t0);
+  REQUIRE(minutes.period == 60);
+  REQUIRE(minutes.buckets.size() == 3);
+  REQUIRE(minutes.buckets[0].count == 60);
+  REQUIRE(minutes.buckets[0].min == 0.0f);
+  REQUIRE(minutes.buckets[0].max == 59.0f);
+  REQUIRE(minutes.buckets[0].average() == 29.5f);
+  REQUIRE(minutes.buckets[1].min == 60.0f);
+  REQUIRE(minutes.buckets[1].max == 119.0f);
+  REQUIRE(minutes.buckets[2].count == 0); // future
+  REQUIRE(std::isnan(minutes.buckets[2].average()));
+
+  const auto hours = series.window(TimeSeriesResolution::Hour, t0, t0);
+  REQUIRE(hours.buckets.size() == 1);
+  REQUIRE(hours.buckets[0].count == 120);
+}
+
+TEST_CASE("TimeSeries: ring buffer wraps", "[telemetry]")
+{
+  constexpr int64_t t0 = 1'700'000'000;
+  constexpr auto capacity = static_cast<int64_t>(TimeSeries::capacities[0]);
+
+  TimeSeries series;
+  series.add(t0, 1);
+  series.add(t0 + capacity + 10, 2);
+
+  // oldest buckets are dropped, the window is limited to what is kept:
+  const auto window = series.window(TimeSeriesResolution::Second, t0, t0 + capacity + 10);
+  REQUIRE(window.start == t0 + 11);
+  REQUIRE(window.buckets.size() == TimeSeries::capacities[0]);
+  REQUIRE(window.buckets.front().count == 0);
+  REQUIRE(window.buckets.back().count == 1);
+  REQUIRE(window.buckets.back().max == 2.0f);
+
+  // too old for the second resolution, still within the minute resolution:
+  series.add(t0 + 5, 3);
+  REQUIRE(series.window(TimeSeriesResolution::Second, t0 + 5, t0 + 5).buckets.empty());
+  const auto minutes = series.window(TimeSeriesResolution::Minute, t0, t0);
+  REQUIRE(minutes.buckets.size() == 1);
+  REQUIRE(minutes.buckets[0].count == 2);
+  REQUIRE(minutes.buckets[0].max == 3.0f);
+}
+
+TEST_CASE("Telemetry: world, booster and interface series", "[telemetry]")
+{
+  constexpr int64_t t0 = 1'700'000'000;
+
+  EventLoop::reset();
+
+  auto world = World::create();
+  auto& telemetry = world->telemetry();
+  REQUIRE(telemetry.find(*world, Telemetry::eventLoopLatency));
+
+  auto booster = world->boosters->create();
+  REQUIRE(booster);
+  REQUIRE(telemetry.find(*booster, "load"));
+  REQUIRE(telemetry.find(*booster, "inputVoltage"));
+
+  auto interface = world->interfaces->create(LocoNetInterface::classId);
+  REQUIRE(interface);
+  REQUIRE(telemetry.find(*interface, Interface::telemetryMessagesReceived));
+  REQUIRE(telemetry.find(*interface, Interface::telemetryMessagesSent));
+  REQUIRE(telemetry.find(*interface, Interface::telemetryUpdateQueueDepth));
+
+  booster->load_.setValueInternal(42.0f);
+  telemetry.sample(t0);
+  booster->load_.setValueInternal(44.0f);
+  telemetry.sample(t0 + 1);
+
+  const auto* load = telemetry.find(*booster, "load");
+  REQUIRE(load);
+  const auto window = load->window(TimeSeriesResolution::Minute, t0, t0);
+  REQUIRE(window.buckets.size() == 1);
+  REQUIRE(window.buckets[0].count == 2);
+  REQUIRE(window.buckets[0].average() == 43.0f);
+
+  // no value, nothing is recorded:
+  REQUIRE(telemetry.find(*booster, "temperature")->empty());
+  REQUIRE(telemetry.find(*interface, Interface::telemetryMessagesReceived)->empty()); // offline
+
+  world->boosters->delete_(booster);
+  REQUIRE_FALSE(telemetry.find(*booster, "load"));
+
+  world->interfaces->delete_(interface);
+  REQUIRE_FALSE(telemetry.find(*interface, Interface::telemetryMessagesReceived));
+}
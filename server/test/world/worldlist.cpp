@@ -0,0 +1,108 @@
+/**
+ * This file is part of Traintastic,
+ * see <https://github.com/traintastic/traintastic>.
+ *
+ * Copyright (C) 2026 Reinder Feenstra
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ */
+
+#include <catch2/catch_test_macros.hpp>
+#include <fstream>
+#include <boost/uuid/string_generator.hpp>
+#include "../../src/core/eventloop.hpp"
+#include "../../src/world/statejournal.hpp"
+#include "../../src/world/worldlist.hpp"
+#include "../../src/world/world.hpp"
+#include "../../src/utils/readfile.hpp"
+#include "../../src/utils/writefile.hpp"
+
+TEST_CASE("Worldlist index is cached", "[worldlist]")
+{
+  EventLoop::reset();
+
+  const auto path = std::filesystem::temp_directory_path() / "traintastic-w4k2qa";
+  std::filesystem::remove_all(path);
+  const auto worldFile = path / "test" / World::filename;
+  const std::string uuid = "6f1b7c2e-3d4a-4e5f-8a9b-0c1d2e3f4a5b";
+  REQUIRE(writeFileJSON(worldFile, {{"uuid", uuid}, {"name", "Test"}}));
+  {
+    auto worldList = std::make_shared<WorldList>(path);
+    const auto* info = worldList->find(boost::uuids::string_generator()(uuid));
+    REQUIRE(info);
+    REQUIRE(info->name == "Test");
+    REQUIRE(std::filesystem::is_regular_file(path / "index.json"));
+
+    // unchanged world, cached entry is used:
+    auto index = readFileJSON(path / "index.json");
+    REQUIRE(index);
+    (*index)["worlds"][0]["name"] = "Cached";
+    REQUIRE(writeFileJSON(path / "index.json", *index));
+    worldList->buildIndex();
+    info = worldList->find(boost::uuids::string_generator()(uuid));
+    REQUIRE(info);
+    REQUIRE(info->name == "Cached");
+
+    // changed world, it is read again:
+    REQUIRE(writeFileJSON(worldFile, {{"uuid", uuid}, {"name", "Changed world"}}));
+    worldList->buildIndex();
+    info = worldList->find(boost::uuids::string_generator()(uuid));
+    REQUIRE(info);
+    REQUIRE(info->name == "Changed world");
+
+    // removed world:
+    std::filesystem::remove_all(worldFile.parent_path());
+    worldList->buildIndex();
+    REQUIRE_FALSE(worldList->find(boost::uuids::string_generator()(uuid)));
+    index = readFileJSON(path / "index.json");
+    REQUIRE(index);
+    REQUIRE(index->at("worlds").empty());
+  }
+  std::filesystem::remove_all(path);
+}
+
+TEST_CASE("Worldlist duplicate and delete with state journal", "[worldlist]")
+{
+  EventLoop::reset();
+
+  const auto path = std::filesystem::temp_directory_path() / "traintastic-p7n3xe";
+  std::filesystem::remove_all(path);
+  const std::string uuid = "0a6c4d2e-1b3f-4c5d-9e8f-7a6b5c4d3e2f";
+  const auto worldDir = path / uuid;
+  REQUIRE(writeFileJSON(worldDir / World::filename, {{"uuid", uuid}, {"name", "Test"}}));
+  REQUIRE(writeFileJSON(worldDir / World::filenameState, {{"uuid", uuid}}));
+  const auto journal = StateJournal::filename(worldDir);
+  std::ofstream(journal) << "journal";
+  REQUIRE(std::filesystem::is_regular_file(journal));
+  {
+    auto worldList = std::make_shared<WorldList>(path);
+    REQUIRE(worldList->find(boost::uuids::string_generator()(uuid)));
+
+    // duplicate starts without journal:
+    REQUIRE(worldList->duplicate(uuid, "Copy"));
+    size_t journals = 0;
+    for(const auto& entry : std::filesystem::directory_iterator(path))
+      if(entry.path().extension() == StateJournal::dotJournal)
+        journals++;
+    REQUIRE(journals == 1);
+
+    // delete removes the journal:
+    REQUIRE(worldList->delete_(uuid));
+    REQUIRE_FALSE(worldList->find(boost::uuids::string_generator()(uuid)));
+    REQUIRE_FALSE(std::filesystem::exists(worldDir));
+    REQUIRE_FALSE(std::filesystem::exists(journal));
+  }
+  std::filesystem::remove_all(path);
+}
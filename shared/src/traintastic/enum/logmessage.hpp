@@ -177,6 +177,7 @@ enum class LogMessage : uint32_t
   W2026_READING_BOOSTER_X_TEMPERATURE_FAILED_X = LogMessageOffset::warning + 2026,
   W2027_READING_BOOSTER_X_LOAD_FAILED_X = LogMessageOffset::warning + 2027,
   W2028_NO_RESPONSE_WITHIN_X_MS_RESENDING_LAST_MESSAGE= LogMessageOffset::warning + 2028,
+  W2029_PCAP_DROPPED_X_RECORDS = LogMessageOffset::warning + 2029,
   W3001_NX_BUTTON_CONNECTED_TO_TWO_BLOCKS = LogMessageOffset::warning + 3001,
   W3002_NX_BUTTON_NOT_CONNECTED_TO_ANY_BLOCK = LogMessageOffset::warning + 3002,
   W3003_LOCKED_TURNOUT_CHANGED = LogMessageOffset::warning + 3003,
@@ -240,6 +241,7 @@ enum class LogMessage : uint32_t
   E3011_FEEDBACK_CONFLICT_MULTIPLE_OPTIONS_ARE_VALID = LogMessageOffset::error + 3011,
   E9001_X_DURING_EXECUTION_OF_X_EVENT_HANDLER = LogMessageOffset::error + 9001,
   E9002_X_DURING_EXECUTION_OF_X_ON_CHANGED_HANDLER = LogMessageOffset::error + 9002,
+  E9003_X_DURING_EXECUTION_OF_TIMER = LogMessageOffset::error + 9003,
   E9999_X = LogMessageOffset::error + 9999,
 
   // Critical:
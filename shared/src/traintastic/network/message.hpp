@@ -56,6 +56,7 @@ class Message
       ObjectSetUnitPropertyUnit = 26,
       ObjectSetObjectPropertyById = 27,
       ObjectPropertyChanged = 17,
+      ObjectPropertiesChanged = 49,
       ObjectAttributeChanged = 18,
       ObjectCallMethod = 25,
       ObjectDestroyed = 28,
@@ -67,6 +68,7 @@ class Message
       TableModelRowCountChanged = 22,
       TableModelSetRegion = 23,
       TableModelUpdateRegion = 24,
+      TableModelSetView = 50,
 
       InputMonitorGetInputInfo = 30,
 
@@ -83,6 +85,8 @@ class Message
       ObjectListGetObjects = 47,
       CallMethod = 48,
 
+      GetTimeSeries = 51,
+
       GetDiagnosticReport = 254,
       Discover = 255,
     };
@@ -409,6 +413,14 @@ class Message
       updateDataSize();
     }
 
+    //! \brief Discard everything written after \a size bytes of data.
+    void truncate(uint32_t size)
+    {
+      assert(size <= dataSize());
+      m_data.resize(sizeof(Header) + size);
+      updateDataSize();
+    }
+
     void writeBlock()
     {
       write<uint32_t>(0);